@@ -0,0 +1,87 @@
+// Author: Mac-Noble Brako-Kusi
+// File: Bench.h
+// Date: October 19, 2026
+// Purpose: Minimal registration and timing helpers shared by the benchmarks
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Registers a benchmark so that the driver in main.cpp can run it by name.
+ * @param name name used on the command line to select the benchmark
+ * @param run function running the benchmark and printing its results
+ * @return true, so that the result can initialize a static variable
+ */
+bool registerBenchmark(const char* name, void (*run)());
+
+/**
+ * Defines and registers a benchmark function.
+ */
+#define BENCHMARK(name)                                                                            \
+    static void name();                                                                            \
+    static const bool name##Registered = registerBenchmark(#name, name);                           \
+    static void name()
+
+/**
+ * Measures wall-clock time from construction or the last restart().
+ */
+class Stopwatch {
+public:
+    Stopwatch() : mStart(std::chrono::steady_clock::now()) {}
+
+    void restart() {
+        mStart = std::chrono::steady_clock::now();
+    }
+
+    [[nodiscard]] uint64_t elapsedNanos() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - mStart).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point mStart;
+};
+
+/**
+ * Prints one result line: the benchmark case, the nanoseconds per operation, and the total.
+ * @param label description of the measured case
+ * @param nanos total elapsed nanoseconds
+ * @param operations number of operations performed in that time
+ */
+inline void report(const std::string& label, uint64_t nanos, uint64_t operations) {
+    std::cout << "  " << label << ": " << static_cast<double>(nanos) / operations << " ns/op ("
+              << nanos / 1000000 << " ms total)" << std::endl;
+}
+
+/**
+ * Prints the latency distribution of individually timed operations: the median, the 99th and
+ * 99.9th percentiles, and the maximum.
+ * @param label description of the measured case
+ * @param samples nanoseconds taken by each operation, reordered by this call
+ */
+inline void reportLatency(const std::string& label, std::vector<uint64_t>& samples) {
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&samples](double fraction) {
+        return samples[static_cast<size_t>(fraction * (samples.size() - 1))];
+    };
+    std::cout << "  " << label << ": p50 " << percentile(0.5) << " ns, p99 " << percentile(0.99)
+              << " ns, p99.9 " << percentile(0.999) << " ns, max " << samples.back() << " ns"
+              << std::endl;
+}
+
+/**
+ * Keeps the compiler from optimizing away a computed value.
+ * @param value the value to keep
+ */
+template<typename T> inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+#endif // BENCH_H
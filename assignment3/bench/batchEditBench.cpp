@@ -0,0 +1,48 @@
+// Author: Mac-Noble Brako-Kusi
+// File: batchEditBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares applying a batch of mixed inserts and removals to an ArrayList one add() or
+//          remove() at a time and as one ArrayList::Batch
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include <random>
+
+namespace {
+const uint32_t kValues = 1U << 20;
+const uint32_t kEdits = 2000;
+} // Namespace
+
+BENCHMARK(batchEdit) {
+    ArrayList<uint64_t> original = ArrayList<uint64_t>::forOverwrite(kValues);
+    for (uint32_t i = 0; i < kValues; ++i)
+        original[i] = i;
+
+    std::minstd_rand random(13);
+    ArrayList<uint32_t> positions = ArrayList<uint32_t>::forOverwrite(kEdits);
+    for (uint32_t e = 0; e < kEdits; ++e)
+        positions[e] = random() % (kValues - kEdits);
+
+    ArrayList<uint64_t> oneByOne(original);
+    Stopwatch watch;
+    for (uint32_t e = 0; e < kEdits; ++e) {
+        if (e % 2 == 0)
+            oneByOne.add(positions[e], e);
+        else
+            oneByOne.remove(positions[e]);
+    }
+    report("add/remove one at a time", watch.elapsedNanos(), kEdits);
+
+    ArrayList<uint64_t> batched(original);
+    watch.restart();
+    ArrayList<uint64_t>::Batch batch;
+    for (uint32_t e = 0; e < kEdits; ++e) {
+        if (e % 2 == 0)
+            batch.insert(positions[e], e);
+        else
+            batch.remove(positions[e]);
+    }
+    batched.apply(batch);
+    report("ArrayList::Batch", watch.elapsedNanos(), kEdits);
+    doNotOptimize(batched.size() + oneByOne.size());
+}
@@ -0,0 +1,64 @@
+// Author: Mac-Noble Brako-Kusi
+// File: compressedIntBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares memory, appends, sequential scans and random reads of sorted timestamps in
+//          an ArrayList<uint64_t> and in a CompressedIntList
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include "CompressedIntList.h"
+#include <iostream>
+#include <random>
+
+namespace {
+const uint32_t kValues = 1U << 24;
+const uint32_t kReads = 1U << 22;
+} // Namespace
+
+BENCHMARK(compressedInt) {
+    std::mt19937_64 random(11);
+    ArrayList<uint64_t> plain;
+    uint64_t time = 1700000000000000000ULL;
+    for (uint32_t i = 0; i < kValues; ++i) {
+        time += random() % 1000;
+        plain.add(time);
+    }
+
+    Stopwatch watch;
+    CompressedIntList compressed;
+    for (uint32_t i = 0; i < kValues; ++i)
+        compressed.add(plain[i]);
+    report("CompressedIntList add", watch.elapsedNanos(), kValues);
+    std::cout << "  bytes per value: ArrayList " << double(plain.memoryFootprint()) / kValues
+              << ", CompressedIntList " << double(compressed.memoryFootprint()) / kValues
+              << std::endl;
+
+    watch.restart();
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < kValues; ++i)
+        sum += plain[i];
+    report("ArrayList scan", watch.elapsedNanos(), kValues);
+    doNotOptimize(sum);
+
+    watch.restart();
+    sum = 0;
+    compressed.forEach([&sum](uint64_t value) {sum += value;});
+    report("CompressedIntList forEach", watch.elapsedNanos(), kValues);
+    doNotOptimize(sum);
+
+    std::minstd_rand indices(3);
+    watch.restart();
+    sum = 0;
+    for (uint32_t i = 0; i < kReads; ++i)
+        sum += plain[indices() % kValues];
+    report("ArrayList random read", watch.elapsedNanos(), kReads);
+    doNotOptimize(sum);
+
+    indices.seed(3);
+    watch.restart();
+    sum = 0;
+    for (uint32_t i = 0; i < kReads; ++i)
+        sum += compressed[indices() % kValues];
+    report("CompressedIntList random read", watch.elapsedNanos(), kReads);
+    doNotOptimize(sum);
+}
@@ -0,0 +1,71 @@
+// Author: Mac-Noble Brako-Kusi
+// File: dictionaryBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares memory, copies and equality filters of a low-cardinality string column in
+//          an ArrayList<std::string> and in a DictionaryList
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include "DictionaryList.h"
+#include <iostream>
+#include <random>
+#include <string>
+
+namespace {
+const uint32_t kValues = 1U << 22;
+const uint32_t kDistinct = 200;
+} // Namespace
+
+BENCHMARK(dictionary) {
+    std::mt19937 random(5);
+    ArrayList<std::string> plain;
+    for (uint32_t i = 0; i < kValues; ++i)
+        plain.add("country-name-" + std::to_string(random() % kDistinct));
+    std::string wanted = plain[0];
+
+    Stopwatch watch;
+    DictionaryList encoded(plain);
+    report("DictionaryList build", watch.elapsedNanos(), kValues);
+
+    size_t plainBytes = plain.memoryFootprint();
+    for (uint32_t i = 0; i < kValues; ++i) {
+        if (plain[i].capacity() >= sizeof(std::string))
+            plainBytes += plain[i].capacity() + 1;
+    }
+    std::cout << "  bytes per value: ArrayList " << double(plainBytes) / kValues
+              << ", DictionaryList " << double(encoded.memoryFootprint()) / kValues << std::endl;
+
+    watch.restart();
+    uint32_t matches = 0;
+    for (uint32_t i = 0; i < kValues; ++i)
+        matches += plain[i] == wanted;
+    report("ArrayList equality count", watch.elapsedNanos(), kValues);
+    doNotOptimize(matches);
+
+    watch.restart();
+    matches = encoded.count(wanted);
+    report("DictionaryList count", watch.elapsedNanos(), kValues);
+    doNotOptimize(matches);
+
+    watch.restart();
+    BitArrayList filter = encoded.equals(wanted);
+    report("DictionaryList equals", watch.elapsedNanos(), kValues);
+    doNotOptimize(filter.count());
+
+    watch.restart();
+    ArrayList<std::string> plainCopy(plain);
+    report("ArrayList copy", watch.elapsedNanos(), kValues);
+    doNotOptimize(plainCopy.size());
+
+    watch.restart();
+    DictionaryList encodedCopy(encoded);
+    report("DictionaryList copy", watch.elapsedNanos(), kValues);
+    doNotOptimize(encodedCopy.size());
+
+    watch.restart();
+    size_t length = 0;
+    for (uint32_t i = 0; i < kValues; ++i)
+        length += encoded[i].size();
+    report("DictionaryList decode", watch.elapsedNanos(), kValues);
+    doNotOptimize(length);
+}
@@ -0,0 +1,54 @@
+// Author: Mac-Noble Brako-Kusi
+// File: gatherBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares random reads and writes through operator[] with gather() and scatter() at
+//          several prefetch distances, on a list much larger than the last-level cache
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+const uint32_t kElements = 1U << 26;
+const uint32_t kLookups = 1U << 24;
+} // Namespace
+
+BENCHMARK(gather) {
+    ArrayList<uint64_t> list(kElements);
+    for (uint32_t i = 0; i < kElements; ++i)
+        list[i] = i;
+    std::mt19937 random(42);
+    std::vector<uint32_t> indices(kLookups);
+    for (uint32_t& index : indices)
+        index = random() % kElements;
+    std::vector<uint64_t> out(kLookups);
+
+    Stopwatch watch;
+    for (uint32_t i = 0; i < kLookups; ++i)
+        out[i] = list[indices[i]];
+    report("operator[] read", watch.elapsedNanos(), kLookups);
+    doNotOptimize(out.data());
+
+    for (uint32_t distance : {0U, 8U, 16U, 32U, 64U}) {
+        watch.restart();
+        list.gather(indices.data(), kLookups, out.data(), distance);
+        report("gather, prefetch distance " + std::to_string(distance), watch.elapsedNanos(),
+               kLookups);
+        doNotOptimize(out.data());
+    }
+
+    watch.restart();
+    for (uint32_t i = 0; i < kLookups; ++i)
+        list[indices[i]] = out[i];
+    report("operator[] write", watch.elapsedNanos(), kLookups);
+
+    for (uint32_t distance : {0U, 16U, 64U}) {
+        watch.restart();
+        list.scatter(indices.data(), kLookups, out.data(), distance);
+        report("scatter, prefetch distance " + std::to_string(distance), watch.elapsedNanos(),
+               kLookups);
+    }
+    doNotOptimize(list.data());
+}
@@ -0,0 +1,41 @@
+// Author: Mac-Noble Brako-Kusi
+// File: growthLatencyBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares the per-add latency of ArrayList and IncrementalArrayList while they grow
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include "IncrementalArrayList.h"
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace {
+const uint32_t kElements = 1U << 25;
+
+template<typename List> void run(const std::string& name, List& list) {
+    std::vector<uint64_t> samples(kElements);
+    Stopwatch total;
+    for (uint32_t i = 0; i < kElements; ++i) {
+        Stopwatch watch;
+        list.add(i);
+        samples[i] = watch.elapsedNanos();
+    }
+    uint64_t nanos = total.elapsedNanos();
+    doNotOptimize(list[kElements / 2]);
+
+    report(name + " add", nanos, kElements);
+    reportLatency(name + " add", samples);
+}
+} // Namespace
+
+BENCHMARK(growthLatency) {
+    {
+        ArrayList<uint64_t> list;
+        run("ArrayList", list);
+    }
+    for (uint32_t step : {16U, 256U}) {
+        IncrementalArrayList<uint64_t> list(step);
+        run("IncrementalArrayList step " + std::to_string(step), list);
+    }
+}
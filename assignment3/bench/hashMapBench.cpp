@@ -0,0 +1,62 @@
+// Author: Mac-Noble Brako-Kusi
+// File: hashMapBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares FlatHashMap with std::unordered_map on insertion and hit/miss lookups
+
+#include "Bench.h"
+#include "FlatHashMap.h"
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+const uint32_t kEntries = 1000000;
+
+std::vector<uint64_t> randomKeys(uint32_t count, uint64_t seed) {
+    std::mt19937_64 random(seed);
+    std::vector<uint64_t> keys(count);
+    for (uint64_t& key : keys)
+        key = random();
+    return keys;
+}
+
+template<typename Map> void run(const char* name, Map& map) {
+    std::vector<uint64_t> keys = randomKeys(kEntries, 1);
+    std::vector<uint64_t> missing = randomKeys(kEntries, 2);
+    std::vector<uint64_t> shuffled = keys;
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937_64(3));
+
+    Stopwatch watch;
+    for (uint64_t key : keys)
+        map[key] = key;
+    report(std::string(name) + " insert", watch.elapsedNanos(), kEntries);
+
+    uint64_t sum = 0;
+    watch.restart();
+    for (uint64_t key : shuffled)
+        sum += map.find(key) != nullptr;
+    report(std::string(name) + " lookup hit", watch.elapsedNanos(), kEntries);
+
+    watch.restart();
+    for (uint64_t key : missing)
+        sum += map.find(key) != nullptr;
+    report(std::string(name) + " lookup miss", watch.elapsedNanos(), kEntries);
+    doNotOptimize(sum);
+}
+
+// Gives std::unordered_map the same pointer-returning find() as FlatHashMap.
+struct StdMap : std::unordered_map<uint64_t, uint64_t> {
+    const uint64_t* find(uint64_t key) const {
+        auto it = std::unordered_map<uint64_t, uint64_t>::find(key);
+        return it == end() ? nullptr : &it->second;
+    }
+};
+} // Namespace
+
+BENCHMARK(hashMap) {
+    FlatHashMap<uint64_t, uint64_t> flat;
+    run("FlatHashMap", flat);
+    StdMap standard;
+    run("std::unordered_map", standard);
+}
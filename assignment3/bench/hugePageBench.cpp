@@ -0,0 +1,55 @@
+// Author: Mac-Noble Brako-Kusi
+// File: hugePageBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares sequential and random scans of an ArrayList on regular and huge pages
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include "HugePageResource.h"
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+const uint32_t kElements = 1U << 25;
+const uint32_t kLookups = 1U << 24;
+
+void run(const std::string& name, ArrayList<uint64_t>& list) {
+    for (uint32_t i = 0; i < kElements; ++i)
+        list.add(i);
+
+    uint64_t sum = 0;
+    Stopwatch watch;
+    for (uint32_t i = 0; i < kElements; ++i)
+        sum += list[i];
+    report(name + " sequential scan", watch.elapsedNanos(), kElements);
+
+    std::mt19937 random(1);
+    std::vector<uint32_t> indices(kLookups);
+    for (uint32_t& index : indices)
+        index = random() % kElements;
+    watch.restart();
+    for (uint32_t index : indices)
+        sum += list[index];
+    report(name + " random reads", watch.elapsedNanos(), kLookups);
+    doNotOptimize(sum);
+}
+} // Namespace
+
+BENCHMARK(hugePages) {
+    {
+        ArrayList<uint64_t> list;
+        run("new[]", list);
+    }
+    {
+        HugePageResource resource(HugePageOptions{HugePages::None, 1 << 20,
+                                                  NumaPolicy::FirstTouch, 1});
+        ArrayList<uint64_t> list(resource);
+        run("HugePageResource 4 KB pages", list);
+    }
+    {
+        HugePageResource resource;
+        ArrayList<uint64_t> list(resource);
+        run("HugePageResource transparent huge pages", list);
+    }
+}
@@ -0,0 +1,95 @@
+// Author: Mac-Noble Brako-Kusi
+// File: ingestBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares loading a file of integers serially (read a chunk, parse it, add every
+//          element) with the overlapped ingestFile pipeline
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include "IngestPipeline.h"
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+const uint32_t kRecords = 10000000;
+const size_t kChunkBytes = 1U << 20;
+
+// Parses one unsigned integer per line
+void parseLines(const char* begin, const char* end, ArrayList<uint64_t>& out) {
+    uint64_t value = 0;
+    bool digits = false;
+    for (const char* c = begin; c < end; ++c) {
+        if (*c == '\n') {
+            out.add(value);
+            value = 0;
+            digits = false;
+        } else {
+            value = value * 10 + static_cast<uint64_t>(*c - '0');
+            digits = true;
+        }
+    }
+    if (digits)
+        out.add(value);
+}
+
+std::string writeFile() {
+    char name[] = "/tmp/ingestBenchXXXXXX";
+    int descriptor = mkstemp(name);
+    FILE* file = fdopen(descriptor, "wb");
+    for (uint32_t i = 0; i < kRecords; ++i)
+        std::fprintf(file, "%u\n", i * 2654435761U);
+    std::fclose(file);
+    return name;
+}
+
+// The loader being replaced: everything on one thread, one step after another
+void loadSerially(const std::string& path, ArrayList<uint64_t>& target) {
+    FILE* file = std::fopen(path.c_str(), "rb");
+    std::vector<char> buffer;
+    std::vector<char> carry;
+    std::vector<char> chunk(kChunkBytes);
+    ArrayList<uint64_t> parsed;
+    size_t got;
+    while ((got = std::fread(chunk.data(), 1, kChunkBytes, file)) > 0) {
+        buffer.assign(carry.begin(), carry.end());
+        buffer.insert(buffer.end(), chunk.begin(), chunk.begin() + got);
+        size_t split = buffer.size();
+        while (split > 0 && buffer[split - 1] != '\n')
+            --split;
+        carry.assign(buffer.begin() + split, buffer.end());
+        parsed.clear();
+        parseLines(buffer.data(), buffer.data() + split, parsed);
+        for (uint32_t i = 0; i < parsed.size(); ++i)
+            target.add(parsed[i]);
+    }
+    parsed.clear();
+    parseLines(carry.data(), carry.data() + carry.size(), parsed);
+    for (uint32_t i = 0; i < parsed.size(); ++i)
+        target.add(parsed[i]);
+    std::fclose(file);
+}
+} // Namespace
+
+BENCHMARK(ingest) {
+    std::string path = writeFile();
+
+    Stopwatch watch;
+    ArrayList<uint64_t> serial;
+    loadSerially(path, serial);
+    report("serial read/parse/add", watch.elapsedNanos(), serial.size());
+
+    for (uint32_t threads : {1U, 2U, 4U}) {
+        IngestOptions options;
+        options.parseThreads = threads;
+        watch.restart();
+        ArrayList<uint64_t> overlapped;
+        ingestFile(path, overlapped, parseLines, options);
+        report("ingestFile, " + std::to_string(threads) + " parse threads", watch.elapsedNanos(),
+               overlapped.size());
+        doNotOptimize(overlapped.data());
+    }
+    std::remove(path.c_str());
+}
@@ -0,0 +1,40 @@
+// Author: Mac-Noble Brako-Kusi
+// File: main.cpp
+// Date: October 19, 2026
+// Purpose: Benchmark driver. Runs every registered benchmark, or only those whose names
+//          contain one of the command-line arguments.
+
+#include "Bench.h"
+#include <cstring>
+#include <vector>
+
+namespace {
+struct Benchmark {
+    const char* name;
+    void (*run)();
+};
+
+std::vector<Benchmark>& benchmarks() {
+    static std::vector<Benchmark> registered;
+    return registered;
+}
+} // Namespace
+
+bool registerBenchmark(const char* name, void (*run)()) {
+    benchmarks().push_back(Benchmark{name, run});
+    return true;
+}
+
+int main(int argc, char** argv) {
+    for (const Benchmark& benchmark : benchmarks()) {
+        bool selected = argc == 1;
+        for (int i = 1; i < argc; ++i)
+            selected = selected || std::strstr(benchmark.name, argv[i]) != nullptr;
+        if (!selected)
+            continue;
+
+        std::cout << benchmark.name << std::endl;
+        benchmark.run();
+    }
+    return 0;
+}
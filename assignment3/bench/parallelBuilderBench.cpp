@@ -0,0 +1,59 @@
+// Author: Mac-Noble Brako-Kusi
+// File: parallelBuilderBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares collecting the output of several threads by appending under a mutex with
+//          ParallelBuilder's thread-local chunks, finished by build() or view()
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include "ParallelBuilder.h"
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+const uint32_t kElements = 1U << 24;
+
+template<typename Produce>
+void produce(uint32_t threads, Produce produce) {
+    std::vector<std::thread> workers;
+    for (uint32_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&produce, t, threads]() {
+            for (uint32_t i = t; i < kElements; i += threads)
+                produce(i);
+        });
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+}
+} // Namespace
+
+BENCHMARK(parallelBuilder) {
+    for (uint32_t threads : {1U, 2U, 4U}) {
+        std::string suffix = ", " + std::to_string(threads) + " threads";
+
+        Stopwatch watch;
+        ArrayList<uint64_t> shared;
+        std::mutex mutex;
+        produce(threads, [&](uint32_t i) {
+            std::lock_guard<std::mutex> lock(mutex);
+            shared.add(i);
+        });
+        report("mutex add" + suffix, watch.elapsedNanos(), kElements);
+        doNotOptimize(shared.data());
+
+        watch.restart();
+        ParallelBuilder<uint64_t> builder;
+        produce(threads, [&](uint32_t i) {builder.local().add(i);});
+        ArrayList<uint64_t> built = builder.build(threads);
+        report("local add + build" + suffix, watch.elapsedNanos(), kElements);
+        doNotOptimize(built.data());
+
+        watch.restart();
+        produce(threads, [&](uint32_t i) {builder.local().add(i);});
+        SegmentedView<uint64_t> view = builder.view();
+        report("local add + view" + suffix, watch.elapsedNanos(), kElements);
+        doNotOptimize(view.size());
+    }
+}
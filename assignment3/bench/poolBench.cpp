@@ -0,0 +1,43 @@
+// Author: Mac-Noble Brako-Kusi
+// File: poolBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares growing many short-lived ArrayLists on several threads with new[] and PoolResource
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include "PoolResource.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+const uint32_t kThreads = 8;
+const uint32_t kLists = 2000;
+const uint32_t kElements = 4000;
+
+template<typename MakeList> void run(const std::string& name, MakeList makeList) {
+    Stopwatch watch;
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&makeList]() {
+            uint64_t sum = 0;
+            for (uint32_t list = 0; list < kLists; ++list) {
+                ArrayList<uint32_t> values = makeList();
+                for (uint32_t i = 0; i < kElements; ++i)
+                    values.add(i);
+                sum += values[list % kElements];
+            }
+            doNotOptimize(sum);
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    report(name + " list built", watch.elapsedNanos(), uint64_t(kThreads) * kLists);
+}
+} // Namespace
+
+BENCHMARK(pool) {
+    run("new[]", []() {return ArrayList<uint32_t>();});
+    PoolResource pool;
+    run("PoolResource", [&pool]() {return ArrayList<uint32_t>(pool);});
+}
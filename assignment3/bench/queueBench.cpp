@@ -0,0 +1,136 @@
+// Author: Mac-Noble Brako-Kusi
+// File: queueBench.cpp
+// Date: October 19, 2026
+// Purpose: Measures message throughput from 1:1 to 16:16 producer and consumer threads, comparing
+//          a mutex-guarded ArrayList used as a queue with the blocking lock-free queues
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include "BlockingQueue.h"
+#include "MpmcQueue.h"
+#include "SpscQueue.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+const uint32_t kCapacity = 1024;
+const uint32_t kMessages = 1U << 21;
+const uint32_t kBatch = 32;
+
+// Runs producers pushing kMessages in total and consumers popping until 'pop' reports the end
+template<typename Push, typename Pop, typename Finish>
+void run(const std::string& name, uint32_t pairs, Push push, Pop pop, Finish finish) {
+    Stopwatch watch;
+    std::vector<std::thread> producers;
+    std::vector<std::thread> consumers;
+    for (uint32_t t = 0; t < pairs; ++t) {
+        producers.emplace_back([&push, t, pairs]() {
+            for (uint32_t i = t; i < kMessages; i += pairs)
+                push(i);
+        });
+        consumers.emplace_back([&pop]() {
+            uint64_t sum = 0;
+            while (pop(sum)) {}
+            doNotOptimize(sum);
+        });
+    }
+    for (std::thread& producer : producers)
+        producer.join();
+    finish();
+    for (std::thread& consumer : consumers)
+        consumer.join();
+    uint64_t nanos = watch.elapsedNanos();
+    report(name + ", " + std::to_string(pairs) + ":" + std::to_string(pairs), nanos, kMessages);
+    std::cout << "    " << static_cast<uint64_t>(kMessages * 1e9 / nanos) << " messages/s"
+              << std::endl;
+}
+
+// The queue being replaced: add() to the end and remove(0) from the front, under a mutex
+void mutexList(uint32_t pairs) {
+    ArrayList<uint32_t> list;
+    std::mutex mutex;
+    std::atomic<uint32_t> consumed(0);
+    run("mutex ArrayList add/remove(0)", pairs,
+        [&](uint32_t i) {
+            while (true) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (list.size() < kCapacity) {
+                        list.add(i);
+                        return;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        },
+        [&](uint64_t& sum) {
+            while (consumed.load(std::memory_order_relaxed) < kMessages) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!list.isEmpty()) {
+                        sum += list.remove(0);
+                        consumed.fetch_add(1, std::memory_order_relaxed);
+                        return true;
+                    }
+                }
+                std::this_thread::yield();
+            }
+            return false;
+        },
+        []() {});
+}
+
+template<typename Queue>
+void blocking(const std::string& name, uint32_t pairs) {
+    BlockingQueue<Queue> queue(kCapacity);
+    run(name, pairs, [&](uint32_t i) {queue.push(i);},
+        [&](uint64_t& sum) {
+            uint32_t value;
+            if (!queue.pop(value))
+                return false;
+            sum += value;
+            return true;
+        },
+        [&]() {queue.close();});
+}
+
+// Producers push runs of kBatch and consumers pop up to kBatch at a time
+template<typename Queue>
+void blockingBatches(const std::string& name, uint32_t pairs) {
+    BlockingQueue<Queue> queue(kCapacity);
+    run(name, pairs,
+        [&](uint32_t i) {
+            // Each producer sends every pairs-th message; batch them kBatch at a time
+            thread_local uint32_t batch[kBatch];
+            thread_local uint32_t count = 0;
+            batch[count++] = i;
+            if (count == kBatch || i + pairs >= kMessages) {
+                queue.pushBatch(batch, count);
+                count = 0;
+            }
+        },
+        [&](uint64_t& sum) {
+            uint32_t values[kBatch];
+            uint32_t popped = queue.popBatch(values, kBatch);
+            for (uint32_t i = 0; i < popped; ++i)
+                sum += values[i];
+            return popped > 0;
+        },
+        [&]() {queue.close();});
+}
+} // Namespace
+
+BENCHMARK(queue) {
+    for (uint32_t pairs : {1U, 2U, 4U, 8U, 16U}) {
+        mutexList(pairs);
+        if (pairs == 1) {
+            blocking<SpscQueue<uint32_t>>("BlockingQueue<SpscQueue>", pairs);
+            blockingBatches<SpscQueue<uint32_t>>("BlockingQueue<SpscQueue> batches", pairs);
+        }
+        blocking<MpmcQueue<uint32_t>>("BlockingQueue<MpmcQueue>", pairs);
+        blockingBatches<MpmcQueue<uint32_t>>("BlockingQueue<MpmcQueue> batches", pairs);
+    }
+}
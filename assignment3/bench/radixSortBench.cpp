@@ -0,0 +1,44 @@
+// Author: Mac-Noble Brako-Kusi
+// File: radixSortBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares radixSort with std::sort on random 32 and 64-bit keys. The largest size
+//          defaults to 100M keys; set RADIX_SORT_MAX_KEYS to go further (1B uint64_t keys need
+//          16 GB for the list and its scatter buffer).
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include "RadixSort.h"
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+namespace {
+template<typename T> void run(const std::string& type, uint64_t size) {
+    ArrayList<T> keys(static_cast<uint32_t>(size));
+    std::mt19937_64 random(size);
+    for (uint32_t i = 0; i < keys.size(); ++i)
+        keys[i] = static_cast<T>(random());
+    ArrayList<T> copy(keys);
+
+    std::string label = type + " x " + std::to_string(size) + " ";
+    Stopwatch watch;
+    std::sort(copy.data(), copy.data() + copy.size());
+    report(label + "std::sort", watch.elapsedNanos(), size);
+
+    watch.restart();
+    radixSort(keys);
+    report(label + "radixSort", watch.elapsedNanos(), size);
+    if (!std::equal(keys.data(), keys.data() + keys.size(), copy.data()))
+        std::cout << "  radixSort disagrees with std::sort" << std::endl;
+}
+} // Namespace
+
+BENCHMARK(radixSort) {
+    const char* limit = std::getenv("RADIX_SORT_MAX_KEYS");
+    uint64_t maxKeys = limit ? std::strtoull(limit, nullptr, 10) : 100000000;
+    for (uint64_t size = 1000000; size <= maxKeys && size < UINT32_MAX; size *= 10) {
+        run<uint32_t>("uint32_t", size);
+        run<uint64_t>("uint64_t", size);
+    }
+}
@@ -0,0 +1,74 @@
+// Author: Mac-Noble Brako-Kusi
+// File: rcuBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares read throughput of RcuArrayList snapshots with an ArrayList behind a
+//          std::shared_mutex, as reader threads are added next to one writer
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include "RcuArrayList.h"
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+const uint32_t kElements = 4096;
+const uint32_t kReadsPerThread = 2000000;
+const auto kWriteInterval = std::chrono::milliseconds(1);
+
+template<typename Read, typename Write>
+void run(const std::string& name, uint32_t readers, Read read, Write write) {
+    std::atomic<bool> done(false);
+    std::thread writer([&]() {
+        for (uint32_t i = 0; !done.load(std::memory_order_relaxed); ++i) {
+            write(i);
+            std::this_thread::sleep_for(kWriteInterval);
+        }
+    });
+
+    Stopwatch watch;
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < readers; ++t) {
+        threads.emplace_back([&read, t]() {
+            std::minstd_rand random(t + 1);
+            uint64_t sum = 0;
+            for (uint32_t i = 0; i < kReadsPerThread; ++i)
+                sum += read(random() % kElements);
+            doNotOptimize(sum);
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    uint64_t nanos = watch.elapsedNanos();
+    done = true;
+    writer.join();
+    report(name + ", " + std::to_string(readers) + " readers", nanos,
+           uint64_t(readers) * kReadsPerThread);
+}
+} // Namespace
+
+BENCHMARK(rcu) {
+    for (uint32_t readers : {1U, 2U, 4U, 8U}) {
+        ArrayList<uint64_t> locked(kElements, 1);
+        std::shared_mutex mutex;
+        run("shared_mutex read", readers,
+            [&](uint32_t index) {
+                std::shared_lock<std::shared_mutex> lock(mutex);
+                return locked[index];
+            },
+            [&](uint32_t i) {
+                std::unique_lock<std::shared_mutex> lock(mutex);
+                locked[i % kElements] = i;
+            });
+
+        RcuArrayList<uint64_t> rcu;
+        rcu.update([](ArrayList<uint64_t>& list) {list = ArrayList<uint64_t>(kElements, 1);});
+        run("RcuArrayList snapshot read", readers,
+            [&](uint32_t index) {return rcu.snapshot()[index];},
+            [&](uint32_t i) {rcu.set(i % kElements, i);});
+    }
+}
@@ -0,0 +1,75 @@
+// Author: Mac-Noble Brako-Kusi
+// File: sparseArrayBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares memory, writes, reads and scans of an ID-indexed table populated at 2% in an
+//          ArrayList and in a SparseArrayList
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include "SparseArrayList.h"
+#include <iostream>
+#include <random>
+
+namespace {
+const uint32_t kIds = 1U << 26;
+const uint32_t kWrites = kIds / 50;
+const uint32_t kReads = 1U << 22;
+} // Namespace
+
+BENCHMARK(sparseArray) {
+    std::minstd_rand random(9);
+    ArrayList<uint32_t> ids = ArrayList<uint32_t>::forOverwrite(kWrites);
+    for (uint32_t i = 0; i < kWrites; ++i)
+        ids[i] = random() % kIds;
+
+    Stopwatch watch;
+    ArrayList<uint64_t> dense;
+    for (uint32_t i = 0; i < kWrites; ++i) {
+        if (ids[i] < dense.size())
+            dense.set(ids[i], i);
+        else
+            dense.add(ids[i], i);
+    }
+    report("ArrayList ID writes", watch.elapsedNanos(), kWrites);
+
+    watch.restart();
+    SparseArrayList<uint64_t> sparse;
+    for (uint32_t i = 0; i < kWrites; ++i) {
+        if (ids[i] < sparse.size())
+            sparse.set(ids[i], i);
+        else
+            sparse.add(ids[i], i);
+    }
+    report("SparseArrayList ID writes", watch.elapsedNanos(), kWrites);
+    std::cout << "  bytes: ArrayList " << dense.memoryFootprint() << ", SparseArrayList "
+              << sparse.memoryFootprint() << " (density " << sparse.density() << ")" << std::endl;
+
+    watch.restart();
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < kReads; ++i)
+        sum += dense[ids[i % kWrites]];
+    report("ArrayList random read", watch.elapsedNanos(), kReads);
+    doNotOptimize(sum);
+
+    watch.restart();
+    sum = 0;
+    for (uint32_t i = 0; i < kReads; ++i)
+        sum += sparse[ids[i % kWrites]];
+    report("SparseArrayList random read", watch.elapsedNanos(), kReads);
+    doNotOptimize(sum);
+
+    watch.restart();
+    sum = 0;
+    for (uint32_t i = 0; i < dense.size(); ++i) {
+        if (dense[i] != 0)
+            sum += dense[i];
+    }
+    report("ArrayList scan for populated IDs", watch.elapsedNanos(), dense.size());
+    doNotOptimize(sum);
+
+    watch.restart();
+    sum = 0;
+    sparse.forEach([&sum](uint32_t, uint64_t value) {sum += value;});
+    report("SparseArrayList forEach", watch.elapsedNanos(), sparse.populated());
+    doNotOptimize(sum);
+}
@@ -0,0 +1,76 @@
+// Author: Mac-Noble Brako-Kusi
+// File: stringListBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares appends, copies, scans and memory of distinct short strings in an
+//          ArrayList<std::string> and in a StringList
+
+#include "ArrayList.h"
+#include "Bench.h"
+#include "StringList.h"
+#include <iostream>
+#include <string>
+
+namespace {
+const uint32_t kValues = 1U << 21;
+} // Namespace
+
+BENCHMARK(stringList) {
+    ArrayList<std::string> words;
+    for (uint32_t i = 0; i < kValues; ++i)
+        words.add("user-" + std::to_string(i * 2654435761U) + "@example.com");
+
+    Stopwatch watch;
+    ArrayList<std::string> plain;
+    for (uint32_t i = 0; i < kValues; ++i)
+        plain.add(words[i]);
+    report("ArrayList<std::string> add", watch.elapsedNanos(), kValues);
+
+    watch.restart();
+    StringList arena;
+    for (uint32_t i = 0; i < kValues; ++i)
+        arena.add(words[i]);
+    report("StringList add", watch.elapsedNanos(), kValues);
+
+    watch.restart();
+    StringList bulk(words);
+    report("StringList bulk add", watch.elapsedNanos(), kValues);
+
+    size_t plainBytes = plain.memoryFootprint();
+    for (uint32_t i = 0; i < kValues; ++i) {
+        const char* object = reinterpret_cast<const char*>(&plain[i]);
+        if (plain[i].data() < object || plain[i].data() >= object + sizeof(std::string))
+            plainBytes += plain[i].capacity() + 1;
+    }
+    std::cout << "  bytes per value: ArrayList " << double(plainBytes) / kValues
+              << ", StringList " << double(arena.memoryFootprint()) / kValues << std::endl;
+
+    watch.restart();
+    ArrayList<std::string> plainCopy(plain);
+    report("ArrayList<std::string> copy", watch.elapsedNanos(), kValues);
+    doNotOptimize(plainCopy.size());
+
+    watch.restart();
+    StringList arenaCopy(arena);
+    report("StringList copy", watch.elapsedNanos(), kValues);
+    doNotOptimize(arenaCopy.size());
+
+    watch.restart();
+    size_t length = 0;
+    for (uint32_t i = 0; i < kValues; ++i)
+        length += plain[i].size() + plain[i][0];
+    report("ArrayList<std::string> scan", watch.elapsedNanos(), kValues);
+    doNotOptimize(length);
+
+    watch.restart();
+    length = 0;
+    for (uint32_t i = 0; i < kValues; ++i)
+        length += arena[i].size() + arena[i][0];
+    report("StringList scan", watch.elapsedNanos(), kValues);
+    doNotOptimize(length);
+
+    for (uint32_t i = 0; i < kValues; i += 2)
+        arena.set(i, "");
+    watch.restart();
+    arena.compact();
+    report("StringList compact after emptying half", watch.elapsedNanos(), kValues);
+}
@@ -0,0 +1,54 @@
+// Author: Mac-Noble Brako-Kusi
+// File: viewBench.cpp
+// Date: October 19, 2026
+// Purpose: Compares a five-stage transformation materializing an ArrayList after every stage with
+//          the same stages fused by the lazy views
+
+#include "ArrayList.h"
+#include "ArrayListView.h"
+#include "Bench.h"
+
+namespace {
+const uint32_t kValues = 1U << 23;
+} // Namespace
+
+BENCHMARK(view) {
+    ArrayList<uint32_t> prices = ArrayList<uint32_t>::forOverwrite(kValues);
+    ArrayList<uint32_t> quantities = ArrayList<uint32_t>::forOverwrite(kValues);
+    for (uint32_t i = 0; i < kValues; ++i) {
+        prices[i] = (i * 2654435761U) % 1000;
+        quantities[i] = i % 7;
+    }
+
+    Stopwatch watch;
+    ArrayList<uint64_t> totals;
+    for (uint32_t i = 0; i < kValues; ++i)
+        totals.add(uint64_t(prices[i]) * quantities[i]);
+    ArrayList<uint64_t> large;
+    for (uint32_t i = 0; i < totals.size(); ++i) {
+        if (totals[i] > 500)
+            large.add(totals[i]);
+    }
+    ArrayList<uint64_t> taxed;
+    for (uint32_t i = 0; i < large.size(); ++i)
+        taxed.add(large[i] * 108 / 100);
+    ArrayList<uint64_t> sampled;
+    for (uint32_t i = 0; i < taxed.size(); i += 2)
+        sampled.add(taxed[i]);
+    ArrayList<uint64_t> staged;
+    for (uint32_t i = 0; i < sampled.size() && i < kValues / 4; ++i)
+        staged.add(sampled[i]);
+    report("materialized stages", watch.elapsedNanos(), kValues);
+
+    watch.restart();
+    ArrayList<uint64_t> fused = slice(prices)
+                                    .zip(slice(quantities))
+                                    .map([](auto item) {return uint64_t(item.first) * item.second;})
+                                    .filter([](uint64_t total) {return total > 500;})
+                                    .map([](uint64_t total) {return total * 108 / 100;})
+                                    .stride(2)
+                                    .take(kValues / 4)
+                                    .collect();
+    report("fused views", watch.elapsedNanos(), kValues);
+    doNotOptimize(fused.size() == staged.size() && fused[0] == staged[0]);
+}
@@ -3,9 +3,46 @@
 #ifndef ARRAYLIST_H
 #define ARRAYLIST_H
 
+#include "ArrayListStats.h"
+#include "ContainerError.h"
+#include "ContainerRegistry.h"
+#include "ContainerTrace.h"
 #include "ScopedArray.h"
+#include <algorithm>
 #include <cstdint>
-#include <sstream>
+#include <memory_resource>
+#include <cassert>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+/**
+ * Bounds checking policies for get(), set() and remove(). Select one by defining
+ * ARRAYLIST_BOUNDS_CHECK, for example -DARRAYLIST_BOUNDS_CHECK=ARRAYLIST_ASSERTED, the same way
+ * for every translation unit of a program:
+ *  - ARRAYLIST_CHECKED (the default): an out-of-range index throws ArrayList::out_of_range, or
+ *    aborts with the index when exceptions are disabled.
+ *  - ARRAYLIST_ASSERTED: an out-of-range index fails an assert(), so it is only caught in builds
+ *    without NDEBUG.
+ *  - ARRAYLIST_UNCHECKED: no check at all, like operator[].
+ * The try* methods always check and report failure through their return value instead.
+ */
+#define ARRAYLIST_CHECKED 0
+#define ARRAYLIST_ASSERTED 1
+#define ARRAYLIST_UNCHECKED 2
+
+#ifndef ARRAYLIST_BOUNDS_CHECK
+#define ARRAYLIST_BOUNDS_CHECK ARRAYLIST_CHECKED
+#endif
+
+/**
+ * The default number of elements gather() and scatter() look ahead when prefetching. About one
+ * memory latency's worth of element copies; it rarely needs tuning unless the elements are large.
+ */
+const uint32_t kPrefetchDistance = 16;
 
 /**
  * An array-backed list implementation that must provide strong
@@ -22,21 +59,75 @@
 template <typename T> class ArrayList {
 public:
 
-    class out_of_range : public std::exception {
+    class out_of_range : public std::out_of_range {
     public:
-        explicit out_of_range(uint32_t index) : index(index){
-            std::stringstream ss;
-            ss << index;
-            message =  ss.str();
-        }
+        explicit out_of_range(uint32_t index)
+            : std::out_of_range(std::to_string(index)), index(index) {}
 
-        const char *what() const noexcept override {
-            return message.c_str();
+        uint32_t getIndex() const noexcept {
+            return index;
         }
 
     private:
         uint32_t index;
-        std::string message;
+    };
+
+    /**
+     * A batch of edits to apply to an ArrayList at once with apply(). Every index refers to the
+     * list as it is before the batch, whatever edits precede it in the batch: insert(i, v) puts
+     * v before the element now at i, or at the end if i is the size, and inserts at the same
+     * index keep the order they were made in. When an element is both set and removed it is
+     * removed, and the last set of an element wins. A batch is not tied to a list and is left
+     * unchanged by apply(), so it can be applied again.
+     */
+    class Batch {
+    public:
+        /**
+         * Records an insertion of value before the element at index.
+         * @param index location in the list before the batch, at most its size
+         * @param value the element to insert
+         */
+        void insert(uint32_t index, const T& value);
+
+        /**
+         * Records the replacement of the element at index.
+         * @param index location in the list before the batch
+         * @param value the new element
+         */
+        void set(uint32_t index, const T& value);
+
+        /**
+         * Records the removal of the element at index. Removing an element twice removes it once.
+         * @param index location in the list before the batch
+         */
+        void remove(uint32_t index);
+
+        /**
+         * Returns the number of edits recorded.
+         * @return the number of edits
+         */
+        [[nodiscard]] uint32_t size() const;
+
+        [[nodiscard]] bool isEmpty() const;
+
+        /**
+         * Discards every edit.
+         */
+        void clear();
+
+    private:
+        friend class ArrayList<T>;
+
+        enum Kind : uint8_t {kInsert, kSet, kRemove};
+
+        struct Edit {
+            uint32_t index;
+            Kind kind;
+            T value;
+        };
+
+        ArrayList<Edit> mEdits;
+        uint32_t mInserts = 0;
     };
 
     /**
@@ -52,6 +143,22 @@ public:
      */
     explicit ArrayList(const uint32_t& size, const T& value = T());
 
+    /**
+     * Creates an ArrayList of size 0 whose buffers are allocated from the provided memory
+     * resource instead of new[], for example a HugePageResource. The resource must outlive the
+     * ArrayList, and copies of the ArrayList allocate from the same resource.
+     * @param resource the memory resource to allocate buffers from
+     */
+    explicit ArrayList(std::pmr::memory_resource& resource);
+
+    /**
+     * Creates an ArrayList of the provided size whose elements are default-initialized rather
+     * than filled, so that for trivial types nothing is written until the caller overwrites them.
+     * @param size size of the ArrayList to create
+     * @return the ArrayList
+     */
+    static ArrayList<T> forOverwrite(uint32_t size);
+
     /**
      * Creates a deep copy of the provided ArrayList
      * @param src ArrayList to copy
@@ -64,19 +171,28 @@ public:
      */
     ArrayList(ArrayList<T>&& src) noexcept;
 
+#if ARRAYLIST_STATS
+    /**
+     * Adds this list's counters to ArrayListStats::totals().
+     */
+    ~ArrayList();
+#endif
+
     /**
-     * Makes *this a deep copy of the provided ArrayList.
+     * Makes *this a deep copy of the provided ArrayList. *this keeps its own memory resource.
      * @param src ArrayList to copy
      * @return *this for chaining
      */
     ArrayList<T>& operator=(const ArrayList<T>& src);
 
     /**
-     * Performs move assignment semantics on the provided ArrayList.
+     * Performs move assignment semantics on the provided ArrayList, leaving it empty. *this keeps
+     * its own memory resource: if src allocates from another one, the elements are moved into a
+     * new buffer from this list's resource, which can throw.
      * @param src ArrayList to move
      * @return *this for chaining
      */
-    ArrayList<T>& operator=(ArrayList<T>&& src) noexcept;
+    ArrayList<T>& operator=(ArrayList<T>&& src);
 
     /**
      * Adds the provided element to the end of this ArrayList.  If the
@@ -93,12 +209,23 @@ public:
      * location. If the ArrayList needs to be enlarged, continue doubling the capacity
      * from the current capacity until the desired index is in range.  Fill any empty
      * elements up to the new element's index with the default value for the template type.
+     * If the list would exceed UINT32_MAX elements, std::length_error is thrown.
      * @param index location at which to insert the new element
      * @param value the element to insert
      * @return total array capacity
      */
     const uint32_t& add(const uint32_t& index, const T& value);
 
+    /**
+     * Appends copies of every element of src, which may be this ArrayList, in order. Spare
+     * capacity is reused; otherwise the buffer is reallocated once, to double the capacity or to
+     * the new size if that is larger, rather than once per doubling. Provides the strong
+     * guarantee. If the list would exceed UINT32_MAX elements, std::length_error is thrown.
+     * @param src the elements to append
+     * @return total array capacity
+     */
+    const uint32_t& addAll(const ArrayList<T>& src);
+
     /**
      * Clears this ArrayList, leaving it empty.
      */
@@ -107,16 +234,32 @@ public:
     /**
      * Returns a const T & to the element stored at the specified index.
      * If the index is out of bounds, std::out_of_range is thrown with the index
-     * as its message.
+     * as its message, unless ARRAYLIST_BOUNDS_CHECK selects another policy.
      * @param index the desired location
      * @return a const T & to the desired element.
      */
     const T& get(const uint32_t& index) const;
 
+    /**
+     * Returns a pointer to the element stored at the specified index, or nullptr if the index is
+     * out of bounds. Never throws, whatever the bounds checking policy.
+     * @param index the desired location
+     * @return a pointer to the desired element, or nullptr.
+     */
+    T* tryGet(const uint32_t& index) noexcept;
+
+    /**
+     * Returns a const pointer to the element stored at the specified index, or nullptr if the
+     * index is out of bounds. Never throws, whatever the bounds checking policy.
+     * @param index the desired location
+     * @return a const pointer to the desired element, or nullptr.
+     */
+    const T* tryGet(const uint32_t& index) const noexcept;
+
     /**
      * Returns a T & to the element stored at the specified index.
      * If the index is out of bounds, std::out_of_range is thrown with the index
-     * as its message.
+     * as its message, unless ARRAYLIST_BOUNDS_CHECK selects another policy.
      * @param index the desired location
      * @return a T & to the desired element.
      */
@@ -139,6 +282,25 @@ public:
      */
     const T& operator[](const uint32_t& index) const;
 
+    /**
+     * Returns a pointer to the contiguous block of memory holding the elements, so that
+     * STL algorithms can run over [data(), data() + size()).
+     * @return a pointer to the first element, or nullptr if nothing has been allocated.
+     */
+    T* data();
+
+    /**
+     * Returns a pointer to the contiguous block of memory holding the elements.
+     * @return a const pointer to the first element, or nullptr if nothing has been allocated.
+     */
+    const T* data() const;
+
+    /**
+     * Returns the memory resource buffers are allocated from.
+     * @return the memory resource, or nullptr if buffers come from new[].
+     */
+    [[nodiscard]] std::pmr::memory_resource* resource() const;
+
     /**
      * Empty check.
      * @return True if this ArrayList is empty and false otherwise.
@@ -148,7 +310,8 @@ public:
     /**
      * Removes an element at the specified location from this ArrayList and
      * returns it. Elements following index are shifted down. If index is out of
-     * range, std::out_of_range is thrown with index as its message.
+     * range, std::out_of_range is thrown with index as its message, unless
+     * ARRAYLIST_BOUNDS_CHECK selects another policy.
      * @param index the desired location
      * @return a copy of the removed element.
      */
@@ -156,18 +319,109 @@ public:
 
     /**
      * Sets the element at the desired location to the specified value. If index
-     * is out of range, std::out_of_range is thrown with index as its message.
+     * is out of range, std::out_of_range is thrown with index as its message, unless
+     * ARRAYLIST_BOUNDS_CHECK selects another policy.
      * @param index the location to change
      * @param value the new value of the specified element.
      */
     void set(const uint32_t& index, const T& value);
 
+    /**
+     * Sets the element at the desired location to the specified value if index is in range.
+     * Throws only what T's assignment operator throws.
+     * @param index the location to change
+     * @param value the new value of the specified element.
+     * @return true if the element was set, false if index is out of range.
+     */
+    bool trySet(const uint32_t& index, const T& value);
+
+    /**
+     * Removes the element at the specified location if index is in range. Elements following
+     * index are shifted down.
+     * @param index the desired location
+     * @return true if an element was removed, false if index is out of range.
+     */
+    bool tryRemove(const uint32_t& index);
+
+    /**
+     * Removes the element at the specified location if index is in range, and stores it in
+     * removed. Elements following index are shifted down.
+     * @param index the desired location
+     * @param removed receives the removed element; untouched if index is out of range
+     * @return true if an element was removed, false if index is out of range.
+     */
+    bool tryRemove(const uint32_t& index, T& removed);
+
+    /**
+     * Copies the elements at the given indices into out, so that out[i] = (*this)[indices[i]].
+     * Unlike a loop over operator[], each iteration prefetches the element prefetchDistance
+     * indices ahead, so up to that many cache misses are in flight at once rather than one. When
+     * built with AVX2 (-mavx2), 4 and 8-byte trivially copyable elements are fetched with vector
+     * gathers. Every index is checked under ARRAYLIST_BOUNDS_CHECK before anything is copied.
+     * @param indices the positions to read
+     * @param count the number of indices
+     * @param out receives count elements
+     * @param prefetchDistance how many indices ahead to prefetch; 0 disables prefetching
+     */
+    void gather(const uint32_t* indices, uint32_t count, T* out,
+                uint32_t prefetchDistance = kPrefetchDistance) const;
+
+    /**
+     * Writes values to the given indices, so that (*this)[indices[i]] = values[i], prefetching
+     * the destination prefetchDistance indices ahead. If an index repeats, the last value written
+     * to it wins. Every index is checked under ARRAYLIST_BOUNDS_CHECK before anything is written.
+     * @param indices the positions to write
+     * @param count the number of indices
+     * @param values the count values to write
+     * @param prefetchDistance how many indices ahead to prefetch; 0 disables prefetching
+     */
+    void scatter(const uint32_t* indices, uint32_t count, const T* values,
+                 uint32_t prefetchDistance = kPrefetchDistance);
+
+    /**
+     * Applies a batch of inserts, sets and removals in one merged pass: the edits are sorted by
+     * index and the list is rebuilt into a new buffer, allocated once, in O(size() + k log k) for
+     * k edits instead of the O(size() * k) of one add() or remove() per edit. Every index is
+     * checked before anything changes, whatever ARRAYLIST_BOUNDS_CHECK selects, and provides the
+     * strong guarantee: either every edit applies or the list is unchanged. A batch of sets only,
+     * for a T whose copy assignment cannot throw, is applied in place without allocating.
+     * @param batch the edits
+     */
+    void apply(const Batch& batch);
+
     /**
      * Returns the size of this ArrayList.
      * @return the size of this ArrayList.
      */
     [[nodiscard]] uint32_t size() const;
 
+    /**
+     * Returns the number of elements the buffer holds, used or not.
+     * @return the capacity of this ArrayList.
+     */
+    [[nodiscard]] uint32_t capacity() const;
+
+    /**
+     * Returns the bytes of the buffer, capacity() * sizeof(T). Memory the elements allocate
+     * themselves, such as the characters of a long std::string, is not included.
+     * @return the bytes allocated for elements.
+     */
+    [[nodiscard]] size_t memoryFootprint() const;
+
+    /**
+     * Reduces the capacity to the size, moving the elements into a buffer that fits them exactly
+     * or releasing the buffer if there are none. Provides the strong guarantee.
+     */
+    void shrinkToFit();
+
+    /**
+     * Returns the operation counters of this list, which a copy starts afresh and swap() leaves
+     * in place. The counters are zero unless ARRAYLIST_STATS is 1; the size and capacity are
+     * always filled in.
+     * @return the counters of this list
+     */
+    [[nodiscard]] ArrayListStats stats() const;
+
     /**
      * Perform an exception-safe swap of the contents of *this with
      * src.
@@ -177,6 +431,10 @@ private:
 
     void resize();
     bool check_range(uint32_t) const;
+    void checkIndex(uint32_t index) const;
+    void checkIndices(const uint32_t* indices, uint32_t count) const;
+    void erase(uint32_t index);
+    [[noreturn]] static void outOfRange(uint32_t index);
 
     /**
      * Wrapper around our physical buffer.
@@ -192,6 +450,28 @@ private:
      * The maximum capacity of the physical buffer.
      */
     uint32_t mCapacity;
+
+    /**
+     * The memory resource buffers are allocated from, or nullptr for new[].
+     */
+    std::pmr::memory_resource* mResource;
+
+#if ARRAYLIST_STATS
+    /**
+     * The operation counters, updated by const accessors too.
+     */
+    mutable ArrayListStats mStats;
+#endif
+
+#if ARRAYLIST_REGISTRY
+    static const ContainerKind kRegistryKind;
+
+    /**
+     * The entry of this list in ContainerRegistry, which belongs to the object and not to the
+     * buffer: swaps and moves leave it in place.
+     */
+    ContainerRegistration mRegistration{this, kRegistryKind};
+#endif
 };
 
 
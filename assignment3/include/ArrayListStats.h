@@ -0,0 +1,177 @@
+// Author: Mac-Noble Brako-Kusi
+// File: ArrayListStats.h
+// Date: October 19, 2026
+// Purpose: Optional operation counters for ArrayList
+
+#ifndef ARRAYLIST_STATS_H
+#define ARRAYLIST_STATS_H
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+
+/**
+ * Operation counters for ArrayList. Define ARRAYLIST_STATS=1, the same way for every translation
+ * unit of a program, to have every ArrayList count its operations; stats() then reports them.
+ * With the default of 0 the counters and the code updating them are compiled out entirely, and
+ * stats() reports only the size and capacity.
+ */
+#ifndef ARRAYLIST_STATS
+#define ARRAYLIST_STATS 0
+#endif
+
+/**
+ * Counters kept by one ArrayList, or summed over many by ArrayListStats::totals(). The operation
+ * counters count calls: get() and tryGet() count as gets, set() and trySet() as sets, and
+ * gather() and scatter() as one get or set per index. operator[] is not counted.
+ */
+struct ArrayListStats {
+    uint64_t appends = 0;
+    uint64_t inserts = 0;
+    uint64_t gets = 0;
+    uint64_t sets = 0;
+    uint64_t removes = 0;
+    uint64_t clears = 0;
+    uint64_t copies = 0;
+
+    /**
+     * Calls that failed the ARRAYLIST_CHECKED bounds check, that is, threw or aborted.
+     */
+    uint64_t outOfRange = 0;
+
+    /**
+     * Buffers allocated to grow, insert, remove or copy.
+     */
+    uint64_t reallocations = 0;
+
+    /**
+     * Elements copied or moved from one place to another by those operations, and their bytes.
+     */
+    uint64_t elementsCopied = 0;
+    uint64_t elementsMoved = 0;
+    uint64_t bytesTransferred = 0;
+
+    /**
+     * The largest capacity reached, in elements. totals() reports the largest of any list.
+     */
+    uint64_t peakCapacity = 0;
+
+    /**
+     * The capacity and size when the stats were taken. totals() sums them over the lists it
+     * covers, as they were when each list was destroyed.
+     */
+    uint64_t capacity = 0;
+    uint64_t size = 0;
+
+    /**
+     * The number of lists covered: 1 for a single list.
+     */
+    uint64_t lists = 0;
+
+    /**
+     * Returns the allocated but unused capacity, in elements.
+     * @return capacity - size
+     */
+    [[nodiscard]] uint64_t wastedCapacity() const {return capacity - size;}
+
+    /**
+     * Adds another set of counters to this one.
+     * @param other the counters to add
+     */
+    void merge(const ArrayListStats& other) {
+        appends += other.appends;
+        inserts += other.inserts;
+        gets += other.gets;
+        sets += other.sets;
+        removes += other.removes;
+        clears += other.clears;
+        copies += other.copies;
+        outOfRange += other.outOfRange;
+        reallocations += other.reallocations;
+        elementsCopied += other.elementsCopied;
+        elementsMoved += other.elementsMoved;
+        bytesTransferred += other.bytesTransferred;
+        peakCapacity = std::max(peakCapacity, other.peakCapacity);
+        capacity += other.capacity;
+        size += other.size;
+        lists += other.lists;
+    }
+
+    /**
+     * Writes the counters as one "name value" line each.
+     * @param out the stream to write to
+     */
+    void dump(std::ostream& out) const {
+        out << "lists " << lists << "\n"
+            << "appends " << appends << "\n"
+            << "inserts " << inserts << "\n"
+            << "gets " << gets << "\n"
+            << "sets " << sets << "\n"
+            << "removes " << removes << "\n"
+            << "clears " << clears << "\n"
+            << "copies " << copies << "\n"
+            << "outOfRange " << outOfRange << "\n"
+            << "reallocations " << reallocations << "\n"
+            << "elementsCopied " << elementsCopied << "\n"
+            << "elementsMoved " << elementsMoved << "\n"
+            << "bytesTransferred " << bytesTransferred << "\n"
+            << "peakCapacity " << peakCapacity << "\n"
+            << "capacity " << capacity << "\n"
+            << "size " << size << "\n"
+            << "wastedCapacity " << wastedCapacity() << "\n";
+    }
+
+    /**
+     * Returns the counters of every ArrayList destroyed so far, of any element type. Lists still
+     * alive are not included; take their stats() directly.
+     * @return the summed counters
+     */
+    static ArrayListStats totals() {
+        std::lock_guard<std::mutex> lock(totalsMutex());
+        return totalsStorage();
+    }
+
+    /**
+     * Adds a list's final counters to totals(). Called by the ArrayList destructor.
+     * @param stats the counters of the list being destroyed
+     */
+    static void record(const ArrayListStats& stats) {
+        std::lock_guard<std::mutex> lock(totalsMutex());
+        totalsStorage().merge(stats);
+    }
+
+    /**
+     * Resets totals() to zero.
+     */
+    static void resetTotals() {
+        std::lock_guard<std::mutex> lock(totalsMutex());
+        totalsStorage() = ArrayListStats();
+    }
+
+private:
+    static std::mutex& totalsMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static ArrayListStats& totalsStorage() {
+        static ArrayListStats totals;
+        return totals;
+    }
+};
+
+/**
+ * Updates a counter of the ArrayList's stats, or does nothing when ARRAYLIST_STATS is 0, in
+ * which case the amount is not evaluated either.
+ */
+#if ARRAYLIST_STATS
+#define ARRAYLIST_COUNT(counter, amount) (mStats.counter += (amount))
+#define ARRAYLIST_COUNT_CAPACITY() \
+    (mStats.peakCapacity = std::max<uint64_t>(mStats.peakCapacity, mCapacity))
+#else
+#define ARRAYLIST_COUNT(counter, amount) ((void) 0)
+#define ARRAYLIST_COUNT_CAPACITY() ((void) 0)
+#endif
+
+#endif // ARRAYLIST_STATS_H
@@ -0,0 +1,369 @@
+// Author: Mac-Noble Brako-Kusi
+// File: ArrayListView.h
+// Date: October 19, 2026
+// Purpose: Declaration file for the lazy view template classes over ArrayList
+
+#ifndef ARRAYLIST_VIEW_H
+#define ARRAYLIST_VIEW_H
+
+#include "ArrayList.h"
+#include "ContainerError.h"
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+template<typename T> class SliceView;
+template<typename Source, typename Function> class MapView;
+template<typename Source, typename Predicate> class FilterView;
+template<typename Source> class TakeView;
+template<typename Source> class DropView;
+template<typename First, typename Second> class ZipView;
+template<typename Source> class EnumerateView;
+template<typename Source> class ChunkView;
+template<typename Source> class StrideView;
+
+/**
+ * The adaptors shared by every view. A view computes nothing when it is created: it holds its
+ * source view and its function by value, and an element is produced only when something reads
+ * it. A chain such as
+ *
+ *     ArrayList<double> out = slice(prices).zip(slice(quantities))
+ *                                 .map([](auto item) {return item.first * item.second;})
+ *                                 .filter([](double total) {return total > 100;})
+ *                                 .collect();
+ *
+ * therefore runs as one loop over the sources, with no intermediate ArrayList, and collect() is
+ * the only step that allocates.
+ *
+ * Views come in two kinds. A random-access view, one whose kRandomAccess is true, has size() and
+ * operator[]; slices are, and map, take, drop, zip, enumerate, chunk and stride keep the kind of
+ * their source. A filter is not, since its size is only known by running it; views over it can
+ * only be run from start to end, by forEach() or collect(). zip() and chunk() need random-access
+ * sources.
+ *
+ * Views refer to the list they were sliced from without owning it, like a std::string_view: the
+ * list must outlive them, and adding to or removing from it invalidates them.
+ */
+template<typename Derived> class View {
+public:
+    /**
+     * Returns a view of function(element) for each element.
+     * @param function the function applied to each element when it is read
+     * @return the view
+     */
+    template<typename Function> MapView<Derived, Function> map(Function function) const;
+
+    /**
+     * Returns a view of the elements for which predicate returns true.
+     * @param predicate the function selecting elements
+     * @return the view
+     */
+    template<typename Predicate> FilterView<Derived, Predicate> filter(Predicate predicate) const;
+
+    /**
+     * Returns a view of the first count elements, or of every element if there are fewer.
+     * @param count the number of elements to keep
+     * @return the view
+     */
+    TakeView<Derived> take(uint32_t count) const;
+
+    /**
+     * Returns a view without the first count elements.
+     * @param count the number of elements to skip
+     * @return the view
+     */
+    DropView<Derived> drop(uint32_t count) const;
+
+    /**
+     * Returns a view of std::pairs of this view's elements and another's, as long as the shorter.
+     * @param other a random-access view
+     * @return the view
+     */
+    template<typename Other> ZipView<Derived, Other> zip(const Other& other) const;
+
+    /**
+     * Returns a view of std::pairs of each element's position and the element.
+     * @return the view
+     */
+    EnumerateView<Derived> enumerate() const;
+
+    /**
+     * Returns a view of consecutive subviews of size elements, the last one possibly shorter. If
+     * size is 0, std::invalid_argument is thrown.
+     * @param size the number of elements in each chunk
+     * @return the view
+     */
+    ChunkView<Derived> chunk(uint32_t size) const;
+
+    /**
+     * Returns a view of every step-th element, starting with the first. If step is 0,
+     * std::invalid_argument is thrown.
+     * @param step the distance between elements
+     * @return the view
+     */
+    StrideView<Derived> stride(uint32_t step) const;
+
+    /**
+     * Calls visit with each element, in order.
+     * @param visit the function to call
+     */
+    template<typename Visit> void forEach(Visit visit) const;
+
+    /**
+     * Materializes the view into an ArrayList of its value_type. Chunks are materialized as
+     * ArrayLists too. A random-access view is written into a list allocated once at its exact
+     * size; other views are appended and then shrunk to fit, so that the pipeline runs once.
+     * @return the elements
+     */
+    auto collect() const;
+
+    /**
+     * Passes the elements, in order, to sink until it returns false. This is the loop every
+     * adaptor builds on.
+     * @param sink the function receiving each element
+     * @return false if sink stopped the loop, true otherwise
+     */
+    template<typename Sink> bool each(Sink&& sink) const;
+
+protected:
+    const Derived& derived() const {return static_cast<const Derived&>(*this);}
+};
+
+/**
+ * A view of a contiguous range of elements. Reading or writing an element of a slice reads or
+ * writes the element of the list, so slice(list).forEach() can modify the list in place.
+ */
+template<typename T> class SliceView : public View<SliceView<T>> {
+public:
+    typedef std::remove_cv_t<T> value_type;
+    typedef T& reference;
+    static constexpr bool kRandomAccess = true;
+
+    /**
+     * Creates a view of size elements starting at data.
+     * @param data the first element
+     * @param size the number of elements
+     */
+    SliceView(T* data, uint32_t size);
+
+    T& operator[](uint32_t index) const;
+
+    [[nodiscard]] uint32_t size() const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    T* data() const;
+
+    /**
+     * Returns a view of the elements in [first, last) of this slice. If first > last or last >
+     * size(), std::out_of_range is thrown.
+     * @param first the index of the first element
+     * @param last the index past the last element
+     * @return the subslice
+     */
+    SliceView<T> slice(uint32_t first, uint32_t last) const;
+
+private:
+    T* mData;
+    uint32_t mSize;
+};
+
+/**
+ * A view applying a function to each element of its source as the element is read.
+ */
+template<typename Source, typename Function>
+class MapView : public View<MapView<Source, Function>> {
+public:
+    typedef std::invoke_result_t<const Function&, typename Source::reference> reference;
+    typedef std::decay_t<reference> value_type;
+    static constexpr bool kRandomAccess = Source::kRandomAccess;
+
+    MapView(const Source& source, const Function& function);
+
+    reference operator[](uint32_t index) const;
+
+    [[nodiscard]] uint32_t size() const;
+
+    template<typename Sink> bool push(Sink& sink) const;
+
+private:
+    Source mSource;
+    Function mFunction;
+};
+
+/**
+ * A view of the elements of its source for which a predicate returns true.
+ */
+template<typename Source, typename Predicate>
+class FilterView : public View<FilterView<Source, Predicate>> {
+public:
+    typedef typename Source::reference reference;
+    typedef typename Source::value_type value_type;
+    static constexpr bool kRandomAccess = false;
+
+    FilterView(const Source& source, const Predicate& predicate);
+
+    template<typename Sink> bool push(Sink& sink) const;
+
+private:
+    Source mSource;
+    Predicate mPredicate;
+};
+
+/**
+ * A view of the first elements of its source. Over a filter, the loop stops as soon as enough
+ * elements have passed.
+ */
+template<typename Source> class TakeView : public View<TakeView<Source>> {
+public:
+    typedef typename Source::reference reference;
+    typedef typename Source::value_type value_type;
+    static constexpr bool kRandomAccess = Source::kRandomAccess;
+
+    TakeView(const Source& source, uint32_t count);
+
+    reference operator[](uint32_t index) const;
+
+    [[nodiscard]] uint32_t size() const;
+
+    template<typename Sink> bool push(Sink& sink) const;
+
+private:
+    Source mSource;
+    uint32_t mCount;
+};
+
+/**
+ * A view of its source without the first elements.
+ */
+template<typename Source> class DropView : public View<DropView<Source>> {
+public:
+    typedef typename Source::reference reference;
+    typedef typename Source::value_type value_type;
+    static constexpr bool kRandomAccess = Source::kRandomAccess;
+
+    DropView(const Source& source, uint32_t count);
+
+    reference operator[](uint32_t index) const;
+
+    [[nodiscard]] uint32_t size() const;
+
+    template<typename Sink> bool push(Sink& sink) const;
+
+private:
+    Source mSource;
+    uint32_t mCount;
+};
+
+/**
+ * A view pairing the elements of two random-access views, as long as the shorter.
+ */
+template<typename First, typename Second> class ZipView : public View<ZipView<First, Second>> {
+public:
+    static_assert(First::kRandomAccess && Second::kRandomAccess,
+                  "zip() needs random-access views");
+
+    typedef std::pair<typename First::reference, typename Second::reference> reference;
+    typedef std::pair<typename First::value_type, typename Second::value_type> value_type;
+    static constexpr bool kRandomAccess = true;
+
+    ZipView(const First& first, const Second& second);
+
+    reference operator[](uint32_t index) const;
+
+    [[nodiscard]] uint32_t size() const;
+
+private:
+    First mFirst;
+    Second mSecond;
+};
+
+/**
+ * A view pairing each element of its source with its position.
+ */
+template<typename Source> class EnumerateView : public View<EnumerateView<Source>> {
+public:
+    typedef std::pair<uint32_t, typename Source::reference> reference;
+    typedef std::pair<uint32_t, typename Source::value_type> value_type;
+    static constexpr bool kRandomAccess = Source::kRandomAccess;
+
+    explicit EnumerateView(const Source& source);
+
+    reference operator[](uint32_t index) const;
+
+    [[nodiscard]] uint32_t size() const;
+
+    template<typename Sink> bool push(Sink& sink) const;
+
+private:
+    Source mSource;
+};
+
+/**
+ * A view of consecutive subviews of a random-access view. Each chunk is itself a view, made
+ * when it is read.
+ */
+template<typename Source> class ChunkView : public View<ChunkView<Source>> {
+public:
+    static_assert(Source::kRandomAccess, "chunk() needs a random-access view");
+
+    typedef TakeView<DropView<Source>> reference;
+    typedef ArrayList<typename Source::value_type> value_type;
+    static constexpr bool kRandomAccess = true;
+
+    ChunkView(const Source& source, uint32_t size);
+
+    reference operator[](uint32_t index) const;
+
+    [[nodiscard]] uint32_t size() const;
+
+private:
+    Source mSource;
+    uint32_t mChunkSize;
+};
+
+/**
+ * A view of every step-th element of its source.
+ */
+template<typename Source> class StrideView : public View<StrideView<Source>> {
+public:
+    typedef typename Source::reference reference;
+    typedef typename Source::value_type value_type;
+    static constexpr bool kRandomAccess = Source::kRandomAccess;
+
+    StrideView(const Source& source, uint32_t step);
+
+    reference operator[](uint32_t index) const;
+
+    [[nodiscard]] uint32_t size() const;
+
+    template<typename Sink> bool push(Sink& sink) const;
+
+private:
+    Source mSource;
+    uint32_t mStep;
+};
+
+/**
+ * Returns a view of every element of a list.
+ * @param list the list
+ * @return the slice
+ */
+template<typename T> SliceView<T> slice(ArrayList<T>& list);
+template<typename T> SliceView<const T> slice(const ArrayList<T>& list);
+
+/**
+ * Returns a view of the elements in [first, last) of a list, without copying them. If first >
+ * last or last > list.size(), std::out_of_range is thrown.
+ * @param list the list
+ * @param first the index of the first element
+ * @param last the index past the last element
+ * @return the slice
+ */
+template<typename T> SliceView<T> slice(ArrayList<T>& list, uint32_t first, uint32_t last);
+template<typename T>
+SliceView<const T> slice(const ArrayList<T>& list, uint32_t first, uint32_t last);
+
+#include "../src/ArrayListView.cpp"
+
+#endif // ARRAYLIST_VIEW_H
@@ -0,0 +1,397 @@
+// Author: Mac-Noble Brako-Kusi
+// File: BitArrayList.h
+// Date: October 19, 2026
+// Purpose: Declaration file for BitArrayList class
+
+#ifndef BIT_ARRAYLIST_H
+#define BIT_ARRAYLIST_H
+
+#include "ScopedArray.h"
+#include <cstdint>
+#include <iterator>
+
+/**
+ * A list of boolean flags packed 64 to a word. Growth doubles the number of words like ArrayList
+ * doubles its capacity, but new words are simply zeroed instead of default-constructing every
+ * element. Bulk operations (and, or, xor, not, count, find) work a word at a time, and count()
+ * uses the hardware population count instruction when the target has one. Bits past size() in
+ * the last word are always kept clear. Since individual bits cannot be referenced, operator[]
+ * and the iterators return a small proxy object that reads or writes the bit it stands for.
+ */
+class BitArrayList {
+public:
+    /**
+     * A proxy for a single bit, returned where a bool & would be returned by ArrayList<bool>.
+     */
+    class reference {
+    public:
+        operator bool() const;
+        reference& operator=(bool value);
+        reference& operator=(const reference& rhs);
+        void flip();
+
+    private:
+        reference(uint64_t* word, uint64_t mask);
+
+        friend class BitArrayList;
+
+        uint64_t* mWord;
+        uint64_t mMask;
+    };
+
+    /**
+     * A random access iterator over the bits. Dereferencing yields a reference proxy, so, as with
+     * std::vector<bool>, the iterator works with the standard algorithms that read or assign
+     * through it, but not with those that need a bool & to swap. Offsets and distances are 64-bit,
+     * so they cover every index of the largest list.
+     */
+    class iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = int64_t;
+        using pointer = void;
+        using reference = BitArrayList::reference;
+
+        iterator();
+
+        bool operator==(const iterator& rhs) const;
+        bool operator!=(const iterator& rhs) const;
+        bool operator<(const iterator& rhs) const;
+        bool operator>(const iterator& rhs) const;
+        bool operator<=(const iterator& rhs) const;
+        bool operator>=(const iterator& rhs) const;
+        reference operator*() const;
+        reference operator[](difference_type offset) const;
+        iterator& operator++();
+        iterator operator++(int);
+        iterator& operator--();
+        iterator operator--(int);
+        iterator& operator+=(difference_type offset);
+        iterator& operator-=(difference_type offset);
+        iterator operator+(difference_type offset) const;
+        iterator operator-(difference_type offset) const;
+        difference_type operator-(const iterator& rhs) const;
+
+    private:
+        iterator(BitArrayList* list, uint32_t index);
+
+        friend class BitArrayList;
+        friend class const_iterator;
+
+        BitArrayList* mList;
+        uint32_t mIndex;
+    };
+
+    /**
+     * A random access iterator over the bits of a constant list. Dereferencing yields the bit.
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = int64_t;
+        using pointer = void;
+        using reference = bool;
+
+        const_iterator();
+        const_iterator(const iterator& it);
+
+        bool operator==(const const_iterator& rhs) const;
+        bool operator!=(const const_iterator& rhs) const;
+        bool operator<(const const_iterator& rhs) const;
+        bool operator>(const const_iterator& rhs) const;
+        bool operator<=(const const_iterator& rhs) const;
+        bool operator>=(const const_iterator& rhs) const;
+        bool operator*() const;
+        bool operator[](difference_type offset) const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        const_iterator& operator--();
+        const_iterator operator--(int);
+        const_iterator& operator+=(difference_type offset);
+        const_iterator& operator-=(difference_type offset);
+        const_iterator operator+(difference_type offset) const;
+        const_iterator operator-(difference_type offset) const;
+        difference_type operator-(const const_iterator& rhs) const;
+
+    private:
+        const_iterator(const BitArrayList* list, uint32_t index);
+
+        friend class BitArrayList;
+
+        const BitArrayList* mList;
+        uint32_t mIndex;
+    };
+
+    /**
+     * Value returned by the find methods when no set bit is found.
+     */
+    static constexpr uint32_t npos = UINT32_MAX;
+
+    /**
+     * Creates a BitArrayList of size 0.
+     */
+    BitArrayList();
+
+    /**
+     * Creates a BitArrayList of the provided size with every bit set to the provided value.
+     * @param size number of bits
+     * @param value value of every bit
+     */
+    explicit BitArrayList(const uint32_t& size, bool value = false);
+
+    /**
+     * Creates a deep copy of the provided BitArrayList.
+     * @param src BitArrayList to copy
+     */
+    BitArrayList(const BitArrayList& src);
+
+    /**
+     * Performs move constructor semantics on the provided BitArrayList.
+     * @param src BitArrayList to move
+     */
+    BitArrayList(BitArrayList&& src) noexcept;
+
+    /**
+     * Makes *this a deep copy of the provided BitArrayList.
+     * @param src BitArrayList to copy
+     * @return *this for chaining
+     */
+    BitArrayList& operator=(const BitArrayList& src);
+
+    /**
+     * Performs move assignment semantics on the provided BitArrayList.
+     * @param src BitArrayList to move
+     * @return *this for chaining
+     */
+    BitArrayList& operator=(BitArrayList&& src) noexcept;
+
+    /**
+     * Adds a bit to the end of this list. If the list needs to be enlarged, double the number
+     * of words, or go from zero to one word.
+     * @param value value to add
+     * @return total capacity in bits
+     */
+    const uint32_t& add(bool value);
+
+    /**
+     * Adds up to 64 bits at once: the count low bits of word, lowest bit first.
+     * @param word bits to add
+     * @param count number of bits to take from word, at most 64
+     * @return total capacity in bits
+     */
+    const uint32_t& addWord(uint64_t word, uint32_t count = 64);
+
+    /**
+     * Returns the bit stored at the specified index. If the index is out of bounds,
+     * std::out_of_range is thrown with the index as its message.
+     * @param index the desired location
+     * @return the bit
+     */
+    bool get(const uint32_t& index) const;
+
+    /**
+     * Sets the bit at the desired location. If index is out of range, std::out_of_range is
+     * thrown with index as its message.
+     * @param index the location to change
+     * @param value the new value of the bit
+     */
+    void set(const uint32_t& index, bool value);
+
+    /**
+     * Returns the bit stored at the specified index. No range checking is performed.
+     * @param index the desired location
+     * @return the bit
+     */
+    bool operator[](const uint32_t& index) const;
+
+    /**
+     * Returns a proxy to the bit stored at the specified index. No range checking is performed.
+     * @param index the desired location
+     * @return a proxy that reads and writes the bit
+     */
+    reference operator[](const uint32_t& index);
+
+    /**
+     * Sets every bit to the provided value.
+     * @param value the new value of every bit
+     */
+    void fill(bool value);
+
+    /**
+     * In-place bitwise and. If the sizes differ, std::invalid_argument is thrown.
+     * @param rhs the other operand
+     * @return *this for chaining
+     */
+    BitArrayList& operator&=(const BitArrayList& rhs);
+
+    /**
+     * In-place bitwise or. If the sizes differ, std::invalid_argument is thrown.
+     * @param rhs the other operand
+     * @return *this for chaining
+     */
+    BitArrayList& operator|=(const BitArrayList& rhs);
+
+    /**
+     * In-place bitwise xor. If the sizes differ, std::invalid_argument is thrown.
+     * @param rhs the other operand
+     * @return *this for chaining
+     */
+    BitArrayList& operator^=(const BitArrayList& rhs);
+
+    /**
+     * Inverts every bit in place.
+     * @return *this for chaining
+     */
+    BitArrayList& flip();
+
+    /**
+     * Returns the number of set bits.
+     * @return the population count
+     */
+    [[nodiscard]] uint32_t count() const;
+
+    /**
+     * Returns the index of the first set bit.
+     * @return the index, or npos if no bit is set
+     */
+    [[nodiscard]] uint32_t findFirst() const;
+
+    /**
+     * Returns the index of the first set bit after the provided index.
+     * @param index the position to search after
+     * @return the index, or npos if no later bit is set
+     */
+    [[nodiscard]] uint32_t findNext(const uint32_t& index) const;
+
+    /**
+     * Returns an iterator to the first bit.
+     * @return an iterator to the beginning of this list
+     */
+    iterator begin();
+
+    /**
+     * Returns the past-the-end iterator.
+     * @return a past-the-end iterator of this list
+     */
+    iterator end();
+
+    /**
+     * Returns an iterator to the first bit of a constant list.
+     * @return an iterator to the beginning of this list
+     */
+    [[nodiscard]] const_iterator begin() const;
+
+    /**
+     * Returns the past-the-end iterator of a constant list.
+     * @return a past-the-end iterator of this list
+     */
+    [[nodiscard]] const_iterator end() const;
+
+    /**
+     * Returns an iterator to the first bit that cannot write through.
+     * @return an iterator to the beginning of this list
+     */
+    [[nodiscard]] const_iterator cbegin() const;
+
+    /**
+     * Returns the past-the-end iterator that cannot write through.
+     * @return a past-the-end iterator of this list
+     */
+    [[nodiscard]] const_iterator cend() const;
+
+    /**
+     * Returns the packed words. Bits past size() in the last word are zero.
+     * @return a pointer to the first of wordCount() words
+     */
+    [[nodiscard]] const uint64_t* words() const;
+
+    /**
+     * Returns the number of words holding the bits.
+     * @return ceil(size() / 64)
+     */
+    [[nodiscard]] uint32_t wordCount() const;
+
+    /**
+     * Clears this list, leaving it empty.
+     */
+    void clear();
+
+    /**
+     * Empty check.
+     * @return True if this list is empty and false otherwise.
+     */
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Returns the number of bits.
+     * @return the number of bits
+     */
+    [[nodiscard]] uint32_t size() const;
+
+    /**
+     * Perform an exception-safe swap of the contents of *this with src.
+     */
+    void swap(BitArrayList& src) noexcept;
+
+private:
+    void reserveWords(uint32_t words);
+    void checkSameSize(const BitArrayList& rhs) const;
+    void clearTail();
+
+    /**
+     * The packed bits.
+     */
+    ScopedArray<uint64_t> mWords;
+
+    /**
+     * The logical number of bits.
+     */
+    uint32_t mSize;
+
+    /**
+     * The number of bits that fit in the allocated words.
+     */
+    uint32_t mCapacity;
+};
+
+/**
+ * Returns an iterator a number of bits forward, with the offset first.
+ * @return it + offset
+ */
+BitArrayList::iterator operator+(BitArrayList::iterator::difference_type offset,
+                                 const BitArrayList::iterator& it);
+
+/**
+ * Returns a constant iterator a number of bits forward, with the offset first.
+ * @return it + offset
+ */
+BitArrayList::const_iterator operator+(BitArrayList::const_iterator::difference_type offset,
+                                       const BitArrayList::const_iterator& it);
+
+/**
+ * Bitwise and of two lists of equal size.
+ * @return a new list holding lhs & rhs
+ */
+BitArrayList operator&(const BitArrayList& lhs, const BitArrayList& rhs);
+
+/**
+ * Bitwise or of two lists of equal size.
+ * @return a new list holding lhs | rhs
+ */
+BitArrayList operator|(const BitArrayList& lhs, const BitArrayList& rhs);
+
+/**
+ * Bitwise xor of two lists of equal size.
+ * @return a new list holding lhs ^ rhs
+ */
+BitArrayList operator^(const BitArrayList& lhs, const BitArrayList& rhs);
+
+/**
+ * Bitwise not.
+ * @return a new list holding ~list
+ */
+BitArrayList operator~(const BitArrayList& list);
+
+#endif // BIT_ARRAYLIST_H
@@ -0,0 +1,102 @@
+// Author: Mac-Noble Brako-Kusi
+// File: BlockingQueue.h
+// Date: October 19, 2026
+// Purpose: Declaration file for BlockingQueue template class
+
+#ifndef BLOCKING_QUEUE_H
+#define BLOCKING_QUEUE_H
+
+#include "Futex.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+/**
+ * Adds waiting to a lock-free SpscQueue or MpmcQueue: push() waits while the queue is full and
+ * pop() while it is empty. A waiting thread spins briefly, yields a few times, then sleeps on a
+ * futex. Each side keeps a count of its sleepers, so pushes and pops only make a system call when
+ * the other side has someone asleep; with both sides keeping up, the wrapper costs a fence and an
+ * atomic load per operation.
+ *
+ * close() ends the stream: pushes fail from then on, and pops fail once the queue is drained,
+ * which is how a pipeline stage learns that its input is finished. The thread rules of the
+ * wrapped queue still apply, so a BlockingQueue<SpscQueue<T>> has one producer and one consumer.
+ */
+template<typename Queue> class BlockingQueue {
+public:
+    using value_type = typename Queue::value_type;
+
+    /**
+     * Creates an open, empty queue holding at least the provided number of elements.
+     * @param capacity the least number of elements the queue can hold
+     */
+    explicit BlockingQueue(uint32_t capacity);
+
+    BlockingQueue(const BlockingQueue<Queue>&) = delete;
+    BlockingQueue<Queue>& operator=(const BlockingQueue<Queue>&) = delete;
+
+    /**
+     * Appends an element, waiting while the queue is full.
+     * @param value the element to append
+     * @return true if the element was appended, false if the queue is closed
+     */
+    bool push(const value_type& value);
+
+    /**
+     * Appends every provided element, in order, waiting for room as needed. With several
+     * producers, the elements may be interleaved with theirs between waits.
+     * @param values the elements to append
+     * @param count the number of elements
+     * @return the number of elements appended: count, or fewer if the queue was closed
+     */
+    uint32_t pushBatch(const value_type* values, uint32_t count);
+
+    /**
+     * Removes the oldest element, waiting while the queue is empty.
+     * @param out receives the element
+     * @return true if an element was removed, false if the queue is closed and drained
+     */
+    bool pop(value_type& out);
+
+    /**
+     * Removes between one and the provided number of the oldest elements, waiting while the queue
+     * is empty.
+     * @param out receives the elements
+     * @param max the most elements to remove
+     * @return the number of elements removed, 0 only if the queue is closed and drained
+     */
+    uint32_t popBatch(value_type* out, uint32_t max);
+
+    /**
+     * Closes the queue and wakes every waiting thread. Elements already pushed stay poppable.
+     */
+    void close();
+
+    [[nodiscard]] bool isClosed() const;
+
+    /**
+     * Returns the wrapped queue, for its non-blocking operations and size().
+     * @return the queue
+     */
+    Queue& queue() {return mQueue;}
+
+private:
+    template<typename Attempt> uint32_t await(std::atomic<uint32_t>& event,
+                                              std::atomic<uint32_t>& sleepers, Attempt attempt);
+    void signal(std::atomic<uint32_t>& event, std::atomic<uint32_t>& sleepers, uint32_t count);
+
+    Queue mQueue;
+    std::atomic<bool> mClosed;
+
+    // Bumped, with a wake, when elements arrive: the futex word consumers sleep on
+    alignas(64) std::atomic<uint32_t> mPushed;
+    std::atomic<uint32_t> mConsumersAsleep;
+
+    // Bumped, with a wake, when slots free up: the futex word producers sleep on
+    alignas(64) std::atomic<uint32_t> mPopped;
+    std::atomic<uint32_t> mProducersAsleep;
+};
+
+#include "../src/BlockingQueue.cpp"
+
+#endif // BLOCKING_QUEUE_H
@@ -0,0 +1,155 @@
+// Author: Mac-Noble Brako-Kusi
+// File: CompressedIntList.h
+// Date: October 19, 2026
+// Purpose: Declaration file for CompressedIntList class
+
+#ifndef COMPRESSED_INT_LIST_H
+#define COMPRESSED_INT_LIST_H
+
+#include "ArrayList.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * An append-only list of 64-bit unsigned integers, stored compressed for data such as IDs and
+ * timestamps whose values are small, sorted or clustered. Values are sealed into blocks of
+ * kBlockSize as they are added; each block is stored as the bit-packed differences either from
+ * its smallest value (frame of reference) or, when the block is non-decreasing, from the value
+ * four places earlier (delta), whichever needs fewer bits. A block of values within a range of
+ * 2^b therefore costs b bits per value, plus a 16-byte header. The last, unsealed values are
+ * kept uncompressed until a block fills.
+ *
+ * A block stores its values in four interleaved lanes, value i going to lane i % 4, so that
+ * encoding and decoding handle four values per step with vector instructions: the code uses GCC
+ * vector types, which compile to AVX2, to pairs of SSE2 operations or to scalar code, depending
+ * on the target. Delta blocks take differences four places apart for the same reason, which lets
+ * the decoding prefix sum run on whole vectors.
+ *
+ * get() goes straight to the block of an index: a frame-of-reference block then extracts one
+ * value, a delta block sums its lane up to the index. Use forEach() or decode() to read many
+ * values, a block at a time.
+ */
+class CompressedIntList {
+public:
+    /**
+     * Number of values per block.
+     */
+    static const uint32_t kBlockSize = 256;
+
+    /**
+     * Creates an empty CompressedIntList.
+     */
+    CompressedIntList();
+
+    /**
+     * Creates a CompressedIntList holding the values of the provided list.
+     * @param values the values, in order
+     */
+    explicit CompressedIntList(const ArrayList<uint64_t>& values);
+
+    /**
+     * Adds a value to the end of the list, sealing a block when kBlockSize values are waiting.
+     * If the list already holds UINT32_MAX values, std::length_error is thrown.
+     * @param value the value to add
+     */
+    void add(uint64_t value);
+
+    /**
+     * Returns the value at the specified index. If the index is out of bounds, std::out_of_range
+     * is thrown with the index as its message.
+     * @param index the desired location
+     * @return the value
+     */
+    uint64_t get(uint32_t index) const;
+
+    /**
+     * Returns the value at the specified index. No range checking is performed.
+     * @param index the desired location
+     * @return the value
+     */
+    uint64_t operator[](uint32_t index) const;
+
+    /**
+     * Decodes a range of values. If the range goes past size(), std::out_of_range is thrown.
+     * @param first the index of the first value
+     * @param count the number of values
+     * @param out receives the values
+     */
+    void decode(uint32_t first, uint32_t count, uint64_t* out) const;
+
+    /**
+     * Calls a function with every value, in order, decoding a block at a time.
+     * @param visit function taking uint64_t
+     */
+    template<typename Visit> void forEach(Visit visit) const;
+
+    /**
+     * Returns the values as an ArrayList.
+     * @return the decoded list
+     */
+    [[nodiscard]] ArrayList<uint64_t> toArrayList() const;
+
+    /**
+     * Returns the number of values.
+     * @return the size
+     */
+    [[nodiscard]] uint32_t size() const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Clears this list, leaving it empty.
+     */
+    void clear();
+
+    /**
+     * Returns the bytes this list has allocated: blocks, headers and unsealed values.
+     * @return the memory footprint in bytes
+     */
+    [[nodiscard]] size_t memoryFootprint() const;
+
+private:
+    struct Block {
+        uint64_t base = 0;
+        uint32_t offset = 0;
+        uint8_t width = 0;
+        bool delta = false;
+    };
+
+    void seal();
+    void decodeBlock(uint32_t block, uint64_t* out) const;
+    uint64_t extract(uint32_t block, uint32_t index) const;
+
+    /**
+     * The packed lanes of every block, block after block; a block of width b takes 4 * b words.
+     */
+    ArrayList<uint64_t> mWords;
+    ArrayList<Block> mBlocks;
+
+    /**
+     * Room for the values not yet sealed into a block, the first size() % kBlockSize of its
+     * kBlockSize elements. Allocated by the first add().
+     */
+    ArrayList<uint64_t> mTail;
+    uint32_t mSize;
+};
+
+/**
+ * Calls a function with every value, in order, decoding a block at a time.
+ * @param visit The function.
+ * @modifies Whatever 'visit' does.
+ * @return N/A
+ */
+template<typename Visit>
+void CompressedIntList::forEach(Visit visit) const {
+    uint64_t values[kBlockSize];
+    for (uint32_t block = 0; block < mBlocks.size(); ++block) {
+        decodeBlock(block, values);
+        for (uint32_t i = 0; i < kBlockSize; ++i)
+            visit(values[i]);
+    }
+    for (uint32_t i = 0; i < mSize % kBlockSize; ++i)
+        visit(mTail[i]);
+}
+
+#endif // COMPRESSED_INT_LIST_H
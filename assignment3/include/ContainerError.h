@@ -0,0 +1,115 @@
+// Author: Mac-Noble Brako-Kusi
+// File: ContainerError.h
+// Date: October 19, 2026
+// Purpose: Error reporting shared by the containers, usable with or without exceptions
+
+#ifndef CONTAINER_ERROR_H
+#define CONTAINER_ERROR_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+/**
+ * 1 if the code is compiled with exceptions, 0 under -fno-exceptions.
+ */
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+#define CONTAINER_EXCEPTIONS 1
+#else
+#define CONTAINER_EXCEPTIONS 0
+#endif
+
+/**
+ * try/catch that compile under -fno-exceptions, where the try block simply runs and the handler
+ * is dropped. CONTAINER_RETHROW rethrows from inside a CONTAINER_CATCH_ALL handler.
+ */
+#if CONTAINER_EXCEPTIONS
+#define CONTAINER_TRY try
+#define CONTAINER_CATCH_ALL catch (...)
+#define CONTAINER_RETHROW throw
+#else
+#define CONTAINER_TRY if (true)
+#define CONTAINER_CATCH_ALL if (false)
+#define CONTAINER_RETHROW ((void) 0)
+#endif
+
+/**
+ * Marks an error path: never inlined, and laid out with the other cold code away from the hot
+ * path that calls it. Formatting the message and building the exception happen in the marked
+ * function, so the caller is left with a compare and a call.
+ */
+#define CONTAINER_COLD __attribute__((cold, noinline))
+
+/**
+ * Reports an error that cannot be thrown because exceptions are disabled: prints the message of
+ * the exception that would have been thrown to stderr and aborts.
+ * @param message the message of the exception
+ */
+[[noreturn]] CONTAINER_COLD inline void abortWithError(const char* message) {
+    std::fprintf(stderr, "container error: %s\n", message);
+    std::abort();
+}
+
+/**
+ * Throws the provided exception, or reports it and aborts under -fno-exceptions.
+ * @param error the exception to throw
+ */
+template<typename Exception> [[noreturn]] CONTAINER_COLD void raiseError(const Exception& error) {
+#if CONTAINER_EXCEPTIONS
+    throw error;
+#else
+    abortWithError(error.what());
+#endif
+}
+
+/**
+ * Throws std::out_of_range with the index as its message.
+ * @param index the offending index
+ */
+[[noreturn]] CONTAINER_COLD inline void throwOutOfRange(uint64_t index) {
+    raiseError(std::out_of_range(std::to_string(index)));
+}
+
+/**
+ * Throws std::out_of_range with the provided message.
+ * @param message what was out of range
+ */
+[[noreturn]] CONTAINER_COLD inline void throwOutOfRange(const char* message) {
+    raiseError(std::out_of_range(message));
+}
+
+/**
+ * Throws std::invalid_argument with the provided message.
+ * @param message what was invalid
+ */
+[[noreturn]] CONTAINER_COLD inline void throwInvalidArgument(const char* message) {
+    raiseError(std::invalid_argument(message));
+}
+
+/**
+ * Throws std::length_error with the provided message.
+ * @param message what would have grown too long
+ */
+[[noreturn]] CONTAINER_COLD inline void throwLengthError(const char* message) {
+    raiseError(std::length_error(message));
+}
+
+/**
+ * Throws std::logic_error with the provided message.
+ * @param message the broken precondition
+ */
+[[noreturn]] CONTAINER_COLD inline void throwLogicError(const char* message) {
+    raiseError(std::logic_error(message));
+}
+
+/**
+ * Throws std::bad_alloc.
+ */
+[[noreturn]] CONTAINER_COLD inline void throwBadAlloc() {
+    raiseError(std::bad_alloc());
+}
+
+#endif // CONTAINER_ERROR_H
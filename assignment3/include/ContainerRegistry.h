@@ -0,0 +1,351 @@
+// Author: Mac-Noble Brako-Kusi
+// File: ContainerRegistry.h
+// Date: October 19, 2026
+// Purpose: Optional registry of live containers, for memory reports and trimming under pressure
+
+#ifndef CONTAINER_REGISTRY_H
+#define CONTAINER_REGISTRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+/**
+ * Define ARRAYLIST_REGISTRY=1, the same way for every translation unit of a program, to have every
+ * ArrayList enter itself in ContainerRegistry for its lifetime. With the default of 0 nothing is
+ * registered and ArrayList carries no registry state.
+ */
+#ifndef ARRAYLIST_REGISTRY
+#define ARRAYLIST_REGISTRY 0
+#endif
+
+/**
+ * What the registry needs to know about one kind of container, supplied by the container.
+ */
+struct ContainerKind {
+    /**
+     * The mangled type name, as given by typeid.
+     */
+    const char* typeName;
+
+    /**
+     * Returns the bytes the container has allocated.
+     */
+    size_t (*footprint)(const void* container);
+
+    /**
+     * Returns the bytes of the allocation that hold elements.
+     */
+    size_t (*usedBytes)(const void* container);
+
+    /**
+     * Releases the spare capacity and returns the bytes released.
+     */
+    size_t (*trim)(void* container);
+};
+
+/**
+ * The containers of one element type created under one ContainerSite, summed.
+ */
+struct ContainerReport {
+    std::string typeName;
+    std::string site;
+    uint64_t containers = 0;
+    uint64_t allocatedBytes = 0;
+    uint64_t usedBytes = 0;
+
+    [[nodiscard]] uint64_t unusedBytes() const {return allocatedBytes - usedBytes;}
+};
+
+/**
+ * Names the call site that containers created on this thread are attributed to, until the
+ * ContainerSite is destroyed. Sites nest; without one, containers are reported as "untagged".
+ * The default name is the file and line the ContainerSite is declared on:
+ *
+ *     ContainerSite site;           // reported as "ingest.cpp:42"
+ *     ContainerSite named("join");  // reported as "join"
+ */
+class ContainerSite {
+public:
+    explicit ContainerSite(const char* name = nullptr, const char* file = __builtin_FILE(),
+                           int line = __builtin_LINE())
+        : mName(name), mFile(file), mLine(line), mPrevious(current()) {
+        current() = this;
+    }
+
+    ~ContainerSite() {current() = mPrevious;}
+
+    ContainerSite(const ContainerSite&) = delete;
+    ContainerSite& operator=(const ContainerSite&) = delete;
+
+    /**
+     * Returns the innermost site of the calling thread.
+     * @return the site, or nullptr if there is none
+     */
+    static const ContainerSite*& current() {
+        thread_local const ContainerSite* site = nullptr;
+        return site;
+    }
+
+    /**
+     * Returns the name of the site: the provided name, or file:line for the default.
+     * @return the name
+     */
+    [[nodiscard]] std::string name() const {return name(mName, mFile, mLine);}
+
+private:
+    friend class ContainerRegistration;
+    friend class ContainerRegistry;
+
+    static std::string name(const char* name, const char* file, int line) {
+        if (name)
+            return name;
+        return file ? std::string(file) + ":" + std::to_string(line) : "untagged";
+    }
+
+    const char* mName;
+    const char* mFile;
+    int mLine;
+    const ContainerSite* mPrevious;
+};
+
+/**
+ * The entry of one live container in ContainerRegistry. A container holds one as a member, built
+ * with a pointer to the container, and the entry is removed when the member is destroyed. The
+ * site is the innermost ContainerSite of the creating thread.
+ */
+class ContainerRegistration {
+public:
+    ContainerRegistration(void* container, const ContainerKind& kind);
+    ~ContainerRegistration();
+
+    ContainerRegistration(const ContainerRegistration&) = delete;
+    ContainerRegistration& operator=(const ContainerRegistration&) = delete;
+
+private:
+    friend class ContainerRegistry;
+
+    void* mContainer;
+    const ContainerKind* mKind;
+
+    // The site, kept as the literals it was made of so that registering never allocates
+    const char* mSiteName;
+    const char* mSiteFile;
+    int mSiteLine;
+
+    ContainerRegistration* mPrevious;
+    ContainerRegistration* mNext;
+};
+
+/**
+ * The process-wide registry of live containers. Reports walk every registered container and
+ * trimming shrinks them, so, as with any other access to a container, call them only where no
+ * other thread is using the registered containers: at a quiescent point of a request loop, for
+ * instance. Registering and unregistering are safe from any thread at any time, including from
+ * within a trim: shrinking a list of lists creates and destroys the inner lists, so the registry
+ * lock is released around every call into a container.
+ */
+class ContainerRegistry {
+public:
+    /**
+     * Returns the number of registered containers.
+     * @return the number of live containers
+     */
+    static size_t size() {
+        std::lock_guard<std::mutex> lock(state().mutex);
+        return state().size;
+    }
+
+    /**
+     * Sums the registered containers by element type and site.
+     * @return one entry per type and site, ordered by type name then site
+     */
+    static std::vector<ContainerReport> report() {
+        std::map<std::pair<std::string, std::string>, ContainerReport> groups;
+        visit([&groups](const ContainerRegistration& entry) {
+            std::string site = ContainerSite::name(entry.mSiteName, entry.mSiteFile,
+                                                   entry.mSiteLine);
+            ContainerReport& group = groups[{entry.mKind->typeName, site}];
+            group.containers += 1;
+            group.allocatedBytes += entry.mKind->footprint(entry.mContainer);
+            group.usedBytes += entry.mKind->usedBytes(entry.mContainer);
+        });
+
+        std::vector<ContainerReport> reports;
+        for (auto& [key, group] : groups) {
+            group.typeName = demangle(key.first.c_str());
+            group.site = key.second;
+            reports.push_back(std::move(group));
+        }
+        return reports;
+    }
+
+    /**
+     * Writes report() as one line per type and site, followed by the totals.
+     * @param out the stream to write to
+     */
+    static void dump(std::ostream& out) {
+        ContainerReport total;
+        for (const ContainerReport& group : report()) {
+            out << group.typeName << " @ " << group.site << ": " << group.containers
+                << " containers, " << group.allocatedBytes << " bytes allocated, "
+                << group.unusedBytes() << " unused\n";
+            total.containers += group.containers;
+            total.allocatedBytes += group.allocatedBytes;
+            total.usedBytes += group.usedBytes;
+        }
+        out << "total: " << total.containers << " containers, " << total.allocatedBytes
+            << " bytes allocated, " << total.unusedBytes() << " unused\n";
+    }
+
+    /**
+     * Asks every registered container to release its spare capacity.
+     * @return the bytes released
+     */
+    static size_t trim() {
+        size_t released = 0;
+        visit([&released](const ContainerRegistration& entry) {
+            released += entry.mKind->trim(entry.mContainer);
+        });
+        return released;
+    }
+
+    /**
+     * Sets the resident set size checkPressure() defends. 0, the default, disables it.
+     * @param budgetBytes the RSS the process must stay under
+     * @param threshold the fraction of the budget at which to start trimming
+     */
+    static void setRssBudget(size_t budgetBytes, double threshold = 0.9) {
+        std::lock_guard<std::mutex> lock(state().mutex);
+        state().trimAtBytes = static_cast<size_t>(static_cast<double>(budgetBytes) * threshold);
+    }
+
+    /**
+     * The memory-pressure hook: trims every registered container if the resident set size has
+     * reached the threshold set by setRssBudget(). Cheap enough to call once per request.
+     * @return the bytes released, 0 if there is no pressure
+     */
+    static size_t checkPressure() {
+        size_t trimAtBytes;
+        {
+            std::lock_guard<std::mutex> lock(state().mutex);
+            trimAtBytes = state().trimAtBytes;
+        }
+        if (trimAtBytes == 0 || residentBytes() < trimAtBytes)
+            return 0;
+        return trim();
+    }
+
+    /**
+     * Returns the resident set size of the process, from /proc/self/statm.
+     * @return the resident bytes, or 0 if they cannot be read
+     */
+    static size_t residentBytes() {
+        std::unique_ptr<FILE, int (*)(FILE*)> statm(std::fopen("/proc/self/statm", "r"), std::fclose);
+        unsigned long long pages = 0;
+        unsigned long long residentPages = 0;
+        if (!statm || std::fscanf(statm.get(), "%llu %llu", &pages, &residentPages) != 2)
+            return 0;
+        return static_cast<size_t>(residentPages) * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+
+private:
+    friend class ContainerRegistration;
+
+    struct State {
+        std::mutex mutex;
+        ContainerRegistration* head = nullptr;
+        size_t size = 0;
+        size_t trimAtBytes = 0;
+
+        // Serializes walks, and holds the entry a walk visits next while the lock is released
+        std::mutex walkMutex;
+        ContainerRegistration* next = nullptr;
+    };
+
+    /**
+     * Calls a function with every registered entry, without the registry lock, so the function
+     * may create and destroy containers. Entries registered during the walk are not visited; an
+     * entry unregistered before its turn is skipped, since unregistering moves 'next' past it.
+     * @param function the function, called with each entry
+     */
+    template<typename Function> static void visit(const Function& function) {
+        State& state = ContainerRegistry::state();
+        std::lock_guard<std::mutex> walk(state.walkMutex);
+        std::unique_lock<std::mutex> lock(state.mutex);
+        for (ContainerRegistration* entry = state.head; entry; entry = state.next) {
+            state.next = entry->mNext;
+            lock.unlock();
+            function(*entry);
+            lock.lock();
+        }
+    }
+
+    static State& state() {
+        static State state;
+        return state;
+    }
+
+    static std::string demangle(const char* name) {
+        int status = 0;
+        std::unique_ptr<char, void (*)(void*)> readable(
+            abi::__cxa_demangle(name, nullptr, nullptr, &status), std::free);
+        return status == 0 ? readable.get() : name;
+    }
+};
+
+/**
+ * Constructor: Enters a container in the registry.
+ * @param container The container.
+ * @param kind How to measure and trim the container.
+ * @modifies Adds this entry to the registry, under the calling thread's current site.
+ * @return N/A
+ */
+inline ContainerRegistration::ContainerRegistration(void* container, const ContainerKind& kind)
+    : mContainer(container),
+      mKind(&kind),
+      mSiteName(ContainerSite::current() ? ContainerSite::current()->mName : nullptr),
+      mSiteFile(ContainerSite::current() ? ContainerSite::current()->mFile : nullptr),
+      mSiteLine(ContainerSite::current() ? ContainerSite::current()->mLine : 0),
+      mPrevious(nullptr),
+      mNext(nullptr) {
+    ContainerRegistry::State& state = ContainerRegistry::state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    mNext = state.head;
+    if (mNext)
+        mNext->mPrevious = this;
+    state.head = this;
+    ++state.size;
+}
+
+/**
+ * Destructor: Removes a container from the registry.
+ * @param N/A
+ * @modifies Unlinks this entry.
+ * @return N/A
+ */
+inline ContainerRegistration::~ContainerRegistration() {
+    ContainerRegistry::State& state = ContainerRegistry::state();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (state.next == this)
+        state.next = mNext;
+    if (mPrevious)
+        mPrevious->mNext = mNext;
+    else
+        state.head = mNext;
+    if (mNext)
+        mNext->mPrevious = mPrevious;
+    --state.size;
+}
+
+#endif // CONTAINER_REGISTRY_H
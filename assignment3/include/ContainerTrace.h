@@ -0,0 +1,219 @@
+// Author: Mac-Noble Brako-Kusi
+// File: ContainerTrace.h
+// Date: October 19, 2026
+// Purpose: Trace points around the expensive container operations, emitted as USDT probes or
+//          recorded in a ring buffer that dumps Chrome trace-event JSON
+
+#ifndef CONTAINER_TRACE_H
+#define CONTAINER_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <ostream>
+#include <string>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * Tracing modes. Select one by defining CONTAINER_TRACE, for example
+ * -DCONTAINER_TRACE=CONTAINER_TRACE_RING, the same way for every translation unit of a program:
+ *  - CONTAINER_TRACE_OFF (the default): the trace points compile to nothing.
+ *  - CONTAINER_TRACE_USDT: each trace point is a pair of USDT probes, container:<event>_begin
+ *    with the element count as its argument and container:<event>_end, for perf, bpftrace or
+ *    SystemTap to attach to. An unattached probe is a single nop. Needs <sys/sdt.h>.
+ *  - CONTAINER_TRACE_RING: each trace point records one complete event in TraceRing, a
+ *    process-wide ring buffer of the last CONTAINER_TRACE_RING_SIZE events, at the cost of two
+ *    clock reads and a few atomic stores.
+ * The events are arraylist_resize, arraylist_insert, arraylist_copy, arraylist_move,
+ * arraylist_gather, arraylist_scatter, arraylist_batch, radix_sort and scopedarray_free.
+ */
+#define CONTAINER_TRACE_OFF 0
+#define CONTAINER_TRACE_USDT 1
+#define CONTAINER_TRACE_RING 2
+
+#ifndef CONTAINER_TRACE
+#define CONTAINER_TRACE CONTAINER_TRACE_OFF
+#endif
+
+#ifndef CONTAINER_TRACE_RING_SIZE
+#define CONTAINER_TRACE_RING_SIZE 65536
+#endif
+
+/**
+ * One recorded trace event. Times come from CLOCK_MONOTONIC, the clock perf uses, so the events
+ * line up with other traces of the same machine.
+ */
+struct TraceEvent {
+    const char* name;
+    uint64_t startNanos;
+    uint64_t durationNanos;
+    uint64_t count;
+    uint32_t thread;
+};
+
+/**
+ * The ring buffer behind CONTAINER_TRACE_RING. Any thread may record while another reads: each
+ * slot carries a sequence number, and a reader skips slots rewritten while it read them. The
+ * functions work in every mode, so a program can dump unconditionally and simply get an empty
+ * trace when tracing is off.
+ */
+class TraceRing {
+public:
+    /**
+     * Records a complete event, overwriting the oldest one if the ring is full. When the ring
+     * wraps onto a slot another thread is still filling, one of the two events is dropped.
+     * @param name name of the event, a string literal
+     * @param startNanos start time, from nowNanos()
+     * @param durationNanos duration in nanoseconds
+     * @param count number of elements involved
+     */
+    static void record(const char* name, uint64_t startNanos, uint64_t durationNanos,
+                       uint64_t count) {
+        uint64_t index = next().fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = slots()[index % kSize];
+        slot.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.startNanos.store(startNanos, std::memory_order_relaxed);
+        slot.durationNanos.store(durationNanos, std::memory_order_relaxed);
+        slot.count.store(count, std::memory_order_relaxed);
+        slot.thread.store(threadId(), std::memory_order_relaxed);
+        slot.sequence.store(index + 1, std::memory_order_release);
+    }
+
+    /**
+     * Returns the events still in the ring, oldest first.
+     * @return the recorded events
+     */
+    static std::vector<TraceEvent> events() {
+        uint64_t end = next().load(std::memory_order_acquire);
+        uint64_t begin = end > kSize ? end - kSize : 0;
+        std::vector<TraceEvent> events;
+        events.reserve(end - begin);
+        for (uint64_t index = begin; index < end; ++index) {
+            Slot& slot = slots()[index % kSize];
+            uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            TraceEvent event{slot.name.load(std::memory_order_relaxed),
+                             slot.startNanos.load(std::memory_order_relaxed),
+                             slot.durationNanos.load(std::memory_order_relaxed),
+                             slot.count.load(std::memory_order_relaxed),
+                             slot.thread.load(std::memory_order_relaxed)};
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence == index + 1 && slot.sequence.load(std::memory_order_relaxed) == sequence)
+                events.push_back(event);
+        }
+        return events;
+    }
+
+    /**
+     * Writes the events still in the ring as Chrome trace-event JSON, loadable in
+     * chrome://tracing or Perfetto. Timestamps are in microseconds of CLOCK_MONOTONIC.
+     * @param out the stream to write to
+     */
+    static void dumpChromeTrace(std::ostream& out) {
+        const char* separator = "\n";
+        out << "{\"traceEvents\":[";
+        for (const TraceEvent& event : events()) {
+            out << separator << "{\"name\":\"" << event.name
+                << "\",\"cat\":\"container\",\"ph\":\"X\",\"ts\":" << micros(event.startNanos)
+                << ",\"dur\":" << micros(event.durationNanos) << ",\"pid\":" << getpid()
+                << ",\"tid\":" << event.thread << ",\"args\":{\"count\":" << event.count << "}}";
+            separator = ",\n";
+        }
+        out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    }
+
+    /**
+     * Discards every recorded event. Must not run while other threads record.
+     */
+    static void clear() {
+        for (uint64_t i = 0; i < kSize; ++i)
+            slots()[i].sequence.store(0, std::memory_order_relaxed);
+        next().store(0, std::memory_order_release);
+    }
+
+    /**
+     * Returns the current time of the trace clock.
+     * @return CLOCK_MONOTONIC in nanoseconds
+     */
+    static uint64_t nowNanos() {
+        timespec now{};
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return uint64_t(now.tv_sec) * 1000000000 + uint64_t(now.tv_nsec);
+    }
+
+private:
+    static const uint64_t kSize = CONTAINER_TRACE_RING_SIZE;
+
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};
+        std::atomic<const char*> name{nullptr};
+        std::atomic<uint64_t> startNanos{0};
+        std::atomic<uint64_t> durationNanos{0};
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint32_t> thread{0};
+    };
+
+    static Slot* slots() {
+        static Slot ring[kSize];
+        return ring;
+    }
+
+    static std::atomic<uint64_t>& next() {
+        static std::atomic<uint64_t> index{0};
+        return index;
+    }
+
+    // The kernel thread id, as perf reports it
+    static uint32_t threadId() {
+        thread_local uint32_t id = static_cast<uint32_t>(syscall(SYS_gettid));
+        return id;
+    }
+
+    // Nanoseconds as microseconds with three decimals
+    static std::string micros(uint64_t nanos) {
+        std::string text = std::to_string(nanos % 1000 + 1000);
+        text[0] = '.';
+        return std::to_string(nanos / 1000) + text;
+    }
+};
+
+/**
+ * Records an event in TraceRing covering its lifetime.
+ */
+class TraceScope {
+public:
+    TraceScope(const char* name, uint64_t count)
+        : mName(name), mCount(count), mStart(TraceRing::nowNanos()) {}
+
+    ~TraceScope() {TraceRing::record(mName, mStart, TraceRing::nowNanos() - mStart, mCount);}
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* mName;
+    uint64_t mCount;
+    uint64_t mStart;
+};
+
+/**
+ * Traces the rest of the enclosing scope as the event 'event' involving 'count' elements. The
+ * count is not evaluated when tracing is off.
+ */
+#if CONTAINER_TRACE == CONTAINER_TRACE_RING
+#define CONTAINER_TRACE_SCOPE(event, count) TraceScope containerTrace_##event(#event, (count))
+#elif CONTAINER_TRACE == CONTAINER_TRACE_USDT
+#include <sys/sdt.h>
+#define CONTAINER_TRACE_SCOPE(event, count)                                                        \
+    DTRACE_PROBE1(container, event##_begin, uint64_t(count));                                      \
+    struct ContainerTraceEnd_##event {                                                             \
+        ~ContainerTraceEnd_##event() {DTRACE_PROBE(container, event##_end);}                       \
+    } containerTrace_##event
+#else
+#define CONTAINER_TRACE_SCOPE(event, count) ((void) 0)
+#endif
+
+#endif // CONTAINER_TRACE_H
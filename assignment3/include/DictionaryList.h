@@ -0,0 +1,183 @@
+// Author: Mac-Noble Brako-Kusi
+// File: DictionaryList.h
+// Date: October 19, 2026
+// Purpose: Declaration file for DictionaryList class
+
+#ifndef DICTIONARY_LIST_H
+#define DICTIONARY_LIST_H
+
+#include "ArrayList.h"
+#include "BitArrayList.h"
+#include "FlatHashMap.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <variant>
+
+/**
+ * A list of strings stored dictionary-encoded, for columns with few distinct values such as
+ * countries, statuses or categories. Each distinct string is stored once in the dictionary and
+ * the list itself is an array of codes, indexes into the dictionary. Codes are 8 bits wide while
+ * the dictionary has at most 256 strings, and the array is widened to 16 and then 32 bits as it
+ * grows past that, so a column of a few hundred values costs one or two bytes per element.
+ *
+ * Reading an element returns a std::string_view into the dictionary, which stays valid for the
+ * lifetime of the list: the dictionary never moves or drops a string, even when set() replaces
+ * every use of it. Equality filters look the value up once and then compare codes only. Copying
+ * a list copies the dictionary once and the codes as integers.
+ */
+class DictionaryList {
+public:
+    /**
+     * Value returned by codeOf() for a string not in the dictionary.
+     */
+    static constexpr uint32_t npos = UINT32_MAX;
+
+    /**
+     * Creates an empty DictionaryList.
+     */
+    DictionaryList();
+
+    /**
+     * Creates a DictionaryList holding the strings of the provided list.
+     * @param values the strings, in order
+     */
+    explicit DictionaryList(const ArrayList<std::string>& values);
+
+    DictionaryList(const DictionaryList& src);
+    DictionaryList(DictionaryList&& src) noexcept = default;
+    DictionaryList& operator=(const DictionaryList& src);
+    DictionaryList& operator=(DictionaryList&& src) noexcept = default;
+
+    /**
+     * Adds a string to the end of the list, entering it in the dictionary if it is new.
+     * @param value the string to add
+     */
+    void add(std::string_view value);
+
+    /**
+     * Returns the string at the specified index. If the index is out of bounds,
+     * std::out_of_range is thrown with the index as its message.
+     * @param index the desired location
+     * @return a view of the string, valid as long as the list
+     */
+    std::string_view get(uint32_t index) const;
+
+    /**
+     * Returns the string at the specified index. No range checking is performed.
+     * @param index the desired location
+     * @return a view of the string, valid as long as the list
+     */
+    std::string_view operator[](uint32_t index) const;
+
+    /**
+     * Replaces the string at the specified location. If the index is out of range,
+     * std::out_of_range is thrown with the index as its message.
+     * @param index the location to change
+     * @param value the new string
+     */
+    void set(uint32_t index, std::string_view value);
+
+    /**
+     * Returns the dictionary code of the string at the specified index. No range checking is
+     * performed.
+     * @param index the desired location
+     * @return the code
+     */
+    [[nodiscard]] uint32_t code(uint32_t index) const;
+
+    /**
+     * Looks a string up in the dictionary.
+     * @param value the string
+     * @return its code, or npos if no element was ever that string
+     */
+    [[nodiscard]] uint32_t codeOf(std::string_view value) const;
+
+    /**
+     * Returns the string a code stands for.
+     * @param code a code less than dictionarySize()
+     * @return a view of the string, valid as long as the list
+     */
+    [[nodiscard]] std::string_view decode(uint32_t code) const;
+
+    /**
+     * Returns the number of distinct strings ever added.
+     * @return the size of the dictionary
+     */
+    [[nodiscard]] uint32_t dictionarySize() const;
+
+    /**
+     * Returns the width of the codes.
+     * @return 1, 2 or 4 bytes
+     */
+    [[nodiscard]] uint32_t codeBytes() const;
+
+    /**
+     * Finds the elements equal to a string, comparing codes only.
+     * @param value the string to look for
+     * @return a BitArrayList of size() bits, set where the element equals value
+     */
+    [[nodiscard]] BitArrayList equals(std::string_view value) const;
+
+    /**
+     * Counts the elements equal to a string, comparing codes only.
+     * @param value the string to look for
+     * @return the number of elements equal to value
+     */
+    [[nodiscard]] uint32_t count(std::string_view value) const;
+
+    /**
+     * Returns the strings as an ArrayList.
+     * @return the decoded list
+     */
+    [[nodiscard]] ArrayList<std::string> toArrayList() const;
+
+    /**
+     * Returns the number of elements.
+     * @return the size
+     */
+    [[nodiscard]] uint32_t size() const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Clears this list and its dictionary, leaving it empty.
+     */
+    void clear();
+
+    /**
+     * Returns the bytes this list has allocated: codes, dictionary and index.
+     * @return the memory footprint in bytes
+     */
+    [[nodiscard]] size_t memoryFootprint() const;
+
+private:
+    typedef FlatHashMap<std::string_view, uint32_t> Index;
+    typedef std::variant<ArrayList<uint8_t>, ArrayList<uint16_t>, ArrayList<uint32_t>> Codes;
+
+    uint32_t encode(std::string_view value);
+    void copyDictionary(const DictionaryList& src);
+
+    /**
+     * The distinct strings, in code order. A deque never moves its elements as it grows, so views
+     * of them stay valid.
+     */
+    std::deque<std::string> mStrings;
+
+    /**
+     * Views of mStrings, indexed by code, so that decoding is one array load.
+     */
+    ArrayList<std::string_view> mDictionary;
+
+    /**
+     * Maps each distinct string, as a view of mStrings, to its code. Created by the first add(), so
+     * an empty or moved-from list may have none.
+     */
+    std::unique_ptr<Index> mIndex;
+    Codes mCodes;
+};
+
+#endif // DICTIONARY_LIST_H
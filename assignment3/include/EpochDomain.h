@@ -0,0 +1,134 @@
+// Author: Mac-Noble Brako-Kusi
+// File: EpochDomain.h
+// Date: October 19, 2026
+// Purpose: Epoch-based reclamation shared by the concurrent containers
+
+#ifndef EPOCH_DOMAIN_H
+#define EPOCH_DOMAIN_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Epoch-based reclamation for data structures whose readers run without locks. A reader brackets
+ * its accesses with a Guard, which announces the current global epoch in a slot owned by its
+ * thread. A writer that unlinks a buffer calls retireEpoch() and may free the buffer once
+ * isSafe() says no reader announced an earlier epoch, since every reader that started later can
+ * only see what replaced it.
+ *
+ * Entering and leaving a Guard is wait-free: a load, two stores and a fence, after a thread's
+ * first Guard has claimed its slot. Slots are never freed; a slot released by an exiting thread is
+ * reused by the next new one. All functions are static, so every container shares one domain.
+ */
+class EpochDomain {
+    struct Slot;
+
+public:
+    /**
+     * Keeps the calling thread's reads safe from reclamation for its lifetime. Guards nest; only
+     * the outermost one announces and withdraws the epoch.
+     */
+    class Guard {
+    public:
+        Guard() : mSlot(threadSlot()) {
+            if (mSlot->depth++ == 0) {
+                mSlot->epoch.store(epoch().load(std::memory_order_relaxed),
+                                   std::memory_order_relaxed);
+                // Orders the announcement before the reads it protects; pairs with retireEpoch()
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+        }
+
+        ~Guard() {
+            if (--mSlot->depth == 0)
+                mSlot->epoch.store(kQuiescent, std::memory_order_release);
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+        Slot* mSlot;
+    };
+
+    /**
+     * Advances the global epoch. Call it after unlinking a buffer, so that readers are either
+     * announced in an earlier epoch or certain to see the unlinked state.
+     * @return the epoch to pass to isSafe() for that buffer
+     */
+    static uint64_t retireEpoch() {
+        return epoch().fetch_add(1, std::memory_order_seq_cst) + 1;
+    }
+
+    /**
+     * Checks whether a buffer retired in the given epoch can no longer be read.
+     * @param retired the value retireEpoch() returned for the buffer
+     * @return true if every reader in a Guard announced that epoch or a later one
+     */
+    static bool isSafe(uint64_t retired) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (Slot* slot = slots().load(std::memory_order_acquire); slot; slot = slot->next) {
+            uint64_t announced = slot->epoch.load(std::memory_order_acquire);
+            if (announced != kQuiescent && announced < retired)
+                return false;
+        }
+        return true;
+    }
+
+private:
+    static const uint64_t kQuiescent = 0;
+
+    /**
+     * The per-thread announcement, on its own cache line so that readers never share one.
+     */
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> epoch{kQuiescent};
+        std::atomic<bool> inUse{true};
+        uint32_t depth = 0;
+        Slot* next = nullptr;
+    };
+
+    // Releases the calling thread's slot when it exits
+    struct SlotOwner {
+        Slot* slot = nullptr;
+        ~SlotOwner() {
+            if (slot)
+                slot->inUse.store(false, std::memory_order_release);
+        }
+    };
+
+    // Starts at 1 so that no real epoch equals kQuiescent
+    static std::atomic<uint64_t>& epoch() {
+        static std::atomic<uint64_t> current{1};
+        return current;
+    }
+
+    static std::atomic<Slot*>& slots() {
+        static std::atomic<Slot*> head{nullptr};
+        return head;
+    }
+
+    static Slot* threadSlot() {
+        thread_local SlotOwner owner;
+        if (owner.slot == nullptr)
+            owner.slot = claimSlot();
+        return owner.slot;
+    }
+
+    static Slot* claimSlot() {
+        for (Slot* slot = slots().load(std::memory_order_acquire); slot; slot = slot->next) {
+            bool free = false;
+            if (!slot->inUse.load(std::memory_order_relaxed) &&
+                slot->inUse.compare_exchange_strong(free, true, std::memory_order_acquire))
+                return slot;
+        }
+
+        Slot* slot = new Slot();
+        slot->next = slots().load(std::memory_order_relaxed);
+        while (!slots().compare_exchange_weak(slot->next, slot, std::memory_order_release,
+                                              std::memory_order_relaxed)) {}
+        return slot;
+    }
+};
+
+#endif // EPOCH_DOMAIN_H
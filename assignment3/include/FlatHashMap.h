@@ -0,0 +1,271 @@
+// Author: Mac-Noble Brako-Kusi
+// File: FlatHashMap.h
+// Date: October 19, 2026
+// Purpose: Declaration file for FlatHashMap template class
+
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+#include "ContainerError.h"
+#include "ScopedArray.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+/**
+ * An open-addressing hash map that stores its entries inline in one ScopedArray of slots, plus a
+ * parallel ScopedArray of one-byte probe distances. Collisions are resolved with Robin Hood
+ * linear probing: an entry that is further from its home slot takes the place of one that is
+ * closer to its own, which keeps probe sequences short and lets a failed lookup stop early.
+ * Erasure shifts the following entries back instead of leaving tombstones, so the table never
+ * degrades under churn. The capacity is always a power of two and the table grows when it is
+ * more than 7/8 full. Both K and V must be default constructible. Growing the table keeps the
+ * strong exception guarantee, copying the entries if moving them could throw; insertion and
+ * erasure keep it when the move operations of K and V do not throw. Pointers returned by find()
+ * are invalidated by any insertion or erasure. A map built with a memory resource allocates both
+ * arrays from it; copies allocate from the resource of the source, and assignment keeps the
+ * resource of the map assigned to.
+ */
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class FlatHashMap {
+private:
+    template<typename H, typename = void> struct IsTransparent : std::false_type {};
+    template<typename H>
+    struct IsTransparent<H, std::void_t<typename H::is_transparent>> : std::true_type {};
+
+    template<typename Q>
+    using EnableIfTransparent = std::enable_if_t<IsTransparent<Hash>::value
+        && IsTransparent<KeyEqual>::value && !std::is_convertible<const Q&, const K&>::value, int>;
+
+public:
+    /**
+     * Creates an empty FlatHashMap. No memory is allocated until the first insertion.
+     */
+    FlatHashMap();
+
+    /**
+     * Creates an empty FlatHashMap able to hold count entries without growing.
+     * @param count number of entries to make room for
+     */
+    explicit FlatHashMap(const uint32_t& count);
+
+    /**
+     * Creates an empty FlatHashMap whose arrays are allocated from the provided memory resource
+     * instead of new[]. The resource must outlive the FlatHashMap.
+     * @param resource the memory resource to allocate the arrays from
+     */
+    explicit FlatHashMap(std::pmr::memory_resource& resource);
+
+    /**
+     * Creates a copy of src that allocates from the same resource.
+     * @param src the FlatHashMap to copy
+     */
+    FlatHashMap(const FlatHashMap& src);
+
+    /**
+     * Takes over the arrays and resource of src, leaving it empty.
+     * @param src the FlatHashMap to move from
+     */
+    FlatHashMap(FlatHashMap&& src) noexcept;
+
+    /**
+     * Replaces the entries with copies of those of src, in arrays from this map's own resource.
+     * @param src the FlatHashMap to copy
+     * @return a reference to this FlatHashMap
+     */
+    FlatHashMap& operator=(const FlatHashMap& src);
+
+    /**
+     * Replaces the entries with those of src, leaving it empty. The arrays of src are taken over
+     * when both maps allocate from equal resources; otherwise the entries are moved into arrays
+     * from this map's own resource.
+     * @param src the FlatHashMap to move from
+     * @return a reference to this FlatHashMap
+     */
+    FlatHashMap& operator=(FlatHashMap&& src);
+
+    /**
+     * Inserts an entry if the key is not already present.
+     * @param key key to insert
+     * @param value value to associate with key
+     * @return true if the entry was inserted, false if the key was already present
+     */
+    bool insert(const K& key, const V& value);
+
+    /**
+     * Inserts an entry, replacing the value if the key is already present.
+     * @param key key to insert
+     * @param value value to associate with key
+     * @return true if the entry was inserted, false if an existing value was replaced
+     */
+    bool insertOrAssign(const K& key, const V& value);
+
+    /**
+     * Returns the value associated with a key, inserting a default value first if the key is
+     * not present.
+     * @param key key to look for
+     * @return a V & to the value
+     */
+    V& operator[](const K& key);
+
+    /**
+     * Finds the value associated with a key.
+     * @param key key to look for
+     * @return a pointer to the value, or nullptr if the key is not present
+     */
+    V* find(const K& key);
+
+    /**
+     * Finds the value associated with a key.
+     * @param key key to look for
+     * @return a const pointer to the value, or nullptr if the key is not present
+     */
+    const V* find(const K& key) const;
+
+    /**
+     * Finds the value associated with a key of another type without converting it to K, e.g. a
+     * std::string_view in a map keyed by std::string. Only available when both Hash and KeyEqual
+     * declare is_transparent.
+     * @param key key to look for
+     * @return a pointer to the value, or nullptr if the key is not present
+     */
+    template<typename Q, typename = EnableIfTransparent<Q>> V* find(const Q& key);
+
+    /**
+     * Heterogeneous const lookup; see the non-const overload.
+     * @param key key to look for
+     * @return a const pointer to the value, or nullptr if the key is not present
+     */
+    template<typename Q, typename = EnableIfTransparent<Q>> const V* find(const Q& key) const;
+
+    /**
+     * Membership check.
+     * @param key key to look for
+     * @return true if the key is present
+     */
+    [[nodiscard]] bool contains(const K& key) const;
+
+    /**
+     * Removes an entry, shifting the entries that follow it in the probe sequence back by one.
+     * @param key key of the entry to remove
+     * @return true if the key was present
+     */
+    bool erase(const K& key);
+
+    /**
+     * Makes room for count entries so that the next insertions do not have to rehash.
+     * @param count number of entries to make room for
+     */
+    void reserve(const uint32_t& count);
+
+    /**
+     * Calls fn(key, value) for every entry, in no particular order.
+     * @param fn callable taking a const K & and a V &
+     */
+    template<typename Function> void forEach(Function fn);
+
+    /**
+     * Calls fn(key, value) for every entry, in no particular order.
+     * @param fn callable taking a const K & and a const V &
+     */
+    template<typename Function> void forEach(Function fn) const;
+
+    /**
+     * Removes every entry but keeps the allocated slots.
+     */
+    void clear();
+
+    /**
+     * Empty check.
+     * @return True if this FlatHashMap is empty and false otherwise.
+     */
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Returns the number of entries.
+     * @return the number of entries.
+     */
+    [[nodiscard]] uint32_t size() const;
+
+    /**
+     * Returns the number of slots.
+     * @return the number of slots, always zero or a power of two.
+     */
+    [[nodiscard]] uint32_t capacity() const;
+
+    /**
+     * Returns the memory resource the arrays are allocated from.
+     * @return the memory resource, or nullptr if the arrays come from new[].
+     */
+    [[nodiscard]] std::pmr::memory_resource* resource() const;
+
+    /**
+     * Exchanges the entries, resources, hash and equality functions of *this and src.
+     */
+    void swap(FlatHashMap& src) noexcept;
+
+private:
+    struct Slot {
+        K key;
+        V value;
+    };
+
+    /**
+     * Probe distances are stored plus one so that zero can mark an empty slot.
+     */
+    static constexpr uint8_t kEmpty = 0;
+    static constexpr uint8_t kMaxDistance = 255;
+
+    template<typename Q> uint32_t indexOf(const Q& key) const;
+    template<typename Q> uint32_t home(const Q& key) const;
+    template<typename Q> uint32_t home(const Q& key, uint32_t shift) const;
+    bool chainOverflows(uint32_t index) const;
+    void insertNew(K key, V value);
+    void rehash(uint32_t capacity);
+    void allocate(uint32_t capacity, ScopedArray<Slot>& slots,
+                  ScopedArray<uint8_t>& distances) const;
+    template<typename Source> void assign(Source&& src);
+    bool place(uint32_t capacity, uint32_t* sources, uint8_t* distances) const;
+    static uint32_t shiftFor(uint32_t capacity);
+    static uint32_t capacityFor(uint32_t count);
+
+    /**
+     * The slots, valid where the matching distance is not kEmpty.
+     */
+    ScopedArray<Slot> mSlots;
+
+    /**
+     * One plus the distance of each entry from its home slot, or kEmpty.
+     */
+    ScopedArray<uint8_t> mDistances;
+
+    /**
+     * The number of slots.
+     */
+    uint32_t mCapacity;
+
+    /**
+     * The number of entries.
+     */
+    uint32_t mSize;
+
+    /**
+     * The number of bits to drop from a mixed 64-bit hash to get a slot index.
+     */
+    uint32_t mShift;
+
+    Hash mHash;
+    KeyEqual mEqual;
+
+    /**
+     * The resource both arrays are allocated from, or nullptr for new[].
+     */
+    std::pmr::memory_resource* mResource;
+};
+
+#include "../src/FlatHashMap.cpp"
+
+#endif // FLAT_HASH_MAP_H
@@ -0,0 +1,171 @@
+// Author: Mac-Noble Brako-Kusi
+// File: FlatMap.h
+// Date: October 19, 2026
+// Purpose: Declaration file for FlatMap template class
+
+#ifndef FLAT_MAP_H
+#define FLAT_MAP_H
+
+#include "ContainerError.h"
+#include "FlatSet.h"
+#include <type_traits>
+
+/**
+ * A map from unique keys to values stored as two parallel ArrayLists, with the keys kept in
+ * sorted order. Keeping the keys in their own contiguous array means a lookup's binary search
+ * touches only keys, and the value is read once at the end. As with FlatSet, single insertions
+ * and erasures are O(n) and bulk construction or batched insertion should be preferred when
+ * adding many entries. Both K and V must satisfy the same requirements as ArrayList elements.
+ */
+template<typename K, typename V, typename Compare = std::less<K>> class FlatMap {
+public:
+    /**
+     * Creates an empty FlatMap.
+     */
+    FlatMap();
+
+    /**
+     * Creates a FlatMap from parallel lists of keys and values in any order. If a key appears
+     * more than once, the value that appears last wins. If the lists differ in size,
+     * std::invalid_argument is thrown.
+     * @param keys keys to add
+     * @param values values matching keys position by position
+     */
+    FlatMap(const ArrayList<K>& keys, const ArrayList<V>& values);
+
+    /**
+     * Inserts a single entry if the key is not already present. O(n).
+     * @param key key to insert
+     * @param value value to associate with key
+     * @return true if the entry was inserted, false if the key was already present
+     */
+    bool insert(const K& key, const V& value);
+
+    /**
+     * Inserts a single entry, replacing the value if the key is already present. O(n).
+     * @param key key to insert
+     * @param value value to associate with key
+     * @return true if the entry was inserted, false if an existing value was replaced
+     */
+    bool insertOrAssign(const K& key, const V& value);
+
+    /**
+     * Inserts a batch of entries in any order by merging them with the existing entries in a
+     * single pass. Entries of the batch replace existing entries with the same key, and within
+     * the batch the last entry for a key wins. If the lists differ in size,
+     * std::invalid_argument is thrown.
+     * @param keys keys to insert
+     * @param values values matching keys position by position
+     */
+    void insert(const ArrayList<K>& keys, const ArrayList<V>& values);
+
+    /**
+     * Removes an entry. O(n).
+     * @param key key of the entry to remove
+     * @return true if the key was present
+     */
+    bool erase(const K& key);
+
+    /**
+     * Membership check. O(log n).
+     * @param key key to look for
+     * @return true if the key is present
+     */
+    [[nodiscard]] bool contains(const K& key) const;
+
+    /**
+     * Finds the value associated with a key. O(log n).
+     * @param key key to look for
+     * @return a pointer to the value, or nullptr if the key is not present
+     */
+    V* find(const K& key);
+
+    /**
+     * Finds the value associated with a key. O(log n).
+     * @param key key to look for
+     * @return a const pointer to the value, or nullptr if the key is not present
+     */
+    const V* find(const K& key) const;
+
+    /**
+     * Returns the value associated with a key. If the key is not present, std::out_of_range is
+     * thrown.
+     * @param key key to look for
+     * @return a const V & to the value
+     */
+    const V& at(const K& key) const;
+
+    /**
+     * Returns the positions of all entries whose keys are in [low, high).
+     * @param low inclusive lower bound
+     * @param high exclusive upper bound
+     * @return the matching positions, empty if high is not greater than low
+     */
+    [[nodiscard]] IndexRange range(const K& low, const K& high) const;
+
+    /**
+     * Returns the key at the specified position in sorted order.
+     * No range checking is performed.
+     * @param index the desired position
+     * @return a const K & to the key
+     */
+    const K& keyAt(const uint32_t& index) const;
+
+    /**
+     * Returns the value at the specified position in key order.
+     * No range checking is performed.
+     * @param index the desired position
+     * @return a V & to the value
+     */
+    V& valueAt(const uint32_t& index);
+
+    /**
+     * Returns the value at the specified position in key order.
+     * No range checking is performed.
+     * @param index the desired position
+     * @return a const V & to the value
+     */
+    const V& valueAt(const uint32_t& index) const;
+
+    /**
+     * Clears this FlatMap, leaving it empty.
+     */
+    void clear();
+
+    /**
+     * Empty check.
+     * @return True if this FlatMap is empty and false otherwise.
+     */
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Returns the number of entries.
+     * @return the number of entries.
+     */
+    [[nodiscard]] uint32_t size() const;
+
+private:
+    void sortedUnique(const ArrayList<K>& keys, const ArrayList<V>& values, ArrayList<K>& outKeys,
+        ArrayList<V>& outValues) const;
+    uint32_t lowerBound(const K& key) const;
+    uint32_t indexOf(const K& key) const;
+
+    /**
+     * The keys, sorted and unique.
+     */
+    ArrayList<K> mKeys;
+
+    /**
+     * The values, in the same order as their keys.
+     */
+    ArrayList<V> mValues;
+
+    /**
+     * The ordering of the keys.
+     */
+    Compare mCompare;
+};
+
+#include "../src/FlatMap.cpp"
+
+#endif // FLAT_MAP_H
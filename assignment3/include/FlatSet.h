@@ -0,0 +1,156 @@
+// Author: Mac-Noble Brako-Kusi
+// File: FlatSet.h
+// Date: October 19, 2026
+// Purpose: Declaration file for FlatSet template class
+
+#ifndef FLAT_SET_H
+#define FLAT_SET_H
+
+#include "ArrayList.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+
+/**
+ * A half-open range [first, last) of positions in a sorted flat container.
+ */
+struct IndexRange {
+    uint32_t first;
+    uint32_t last;
+
+    /**
+     * Returns the number of positions in the range.
+     * @return last - first
+     */
+    [[nodiscard]] uint32_t size() const {
+        return last - first;
+    }
+};
+
+/**
+ * A set of unique keys stored in sorted order in a single ArrayList. Lookups are binary searches
+ * over one contiguous block of memory, which makes this container a better fit than a node-based
+ * set for tables that are built once and read many times. Single insertions and erasures shift
+ * the tail of the array and are O(n); prefer the bulk constructor or the batched insert when
+ * adding many keys at once. Keys are ordered by Compare, and two keys are considered equal when
+ * neither compares less than the other.
+ */
+template<typename T, typename Compare = std::less<T>> class FlatSet {
+public:
+    /**
+     * Creates an empty FlatSet.
+     */
+    FlatSet();
+
+    /**
+     * Creates a FlatSet from keys in any order. The keys are sorted and deduplicated once.
+     * @param keys keys to add, in any order and possibly repeated
+     */
+    explicit FlatSet(const ArrayList<T>& keys);
+
+    /**
+     * Inserts a single key, keeping the keys sorted. O(n).
+     * @param key key to insert
+     * @return true if the key was inserted, false if it was already present
+     */
+    bool insert(const T& key);
+
+    /**
+     * Inserts a batch of keys in any order. The batch is sorted and deduplicated, then merged
+     * with the existing keys in a single pass: O(n + k log k) instead of O(n * k).
+     * @param keys keys to insert
+     */
+    void insert(const ArrayList<T>& keys);
+
+    /**
+     * Removes a key. O(n).
+     * @param key key to remove
+     * @return true if the key was present
+     */
+    bool erase(const T& key);
+
+    /**
+     * Membership check. O(log n).
+     * @param key key to look for
+     * @return true if the key is present
+     */
+    [[nodiscard]] bool contains(const T& key) const;
+
+    /**
+     * Finds the position of a key. O(log n).
+     * @param key key to look for
+     * @return the index of the key, or size() if it is not present
+     */
+    [[nodiscard]] uint32_t find(const T& key) const;
+
+    /**
+     * Returns the position of the first key that is not less than the provided key.
+     * @param key the bound
+     * @return an index in [0, size()]
+     */
+    [[nodiscard]] uint32_t lowerBound(const T& key) const;
+
+    /**
+     * Returns the position of the first key that is greater than the provided key.
+     * @param key the bound
+     * @return an index in [0, size()]
+     */
+    [[nodiscard]] uint32_t upperBound(const T& key) const;
+
+    /**
+     * Returns the positions of all keys in [low, high).
+     * @param low inclusive lower bound
+     * @param high exclusive upper bound
+     * @return the matching positions, empty if high is not greater than low
+     */
+    [[nodiscard]] IndexRange range(const T& low, const T& high) const;
+
+    /**
+     * Returns the key at the specified position in sorted order.
+     * No range checking is performed.
+     * @param index the desired position
+     * @return a const T & to the key
+     */
+    const T& operator[](const uint32_t& index) const;
+
+    /**
+     * Returns the sorted keys.
+     * @return a const reference to the underlying ArrayList
+     */
+    const ArrayList<T>& keys() const;
+
+    /**
+     * Clears this FlatSet, leaving it empty.
+     */
+    void clear();
+
+    /**
+     * Empty check.
+     * @return True if this FlatSet is empty and false otherwise.
+     */
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Returns the number of keys.
+     * @return the number of keys.
+     */
+    [[nodiscard]] uint32_t size() const;
+
+private:
+    static ArrayList<T> sortedUnique(const ArrayList<T>& keys, const Compare& compare);
+    bool equivalent(const T& lhs, const T& rhs) const;
+
+    /**
+     * The keys, sorted and unique.
+     */
+    ArrayList<T> mKeys;
+
+    /**
+     * The ordering of the keys.
+     */
+    Compare mCompare;
+};
+
+#include "../src/FlatSet.cpp"
+
+#endif // FLAT_SET_H
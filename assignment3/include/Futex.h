@@ -0,0 +1,66 @@
+// Author: Mac-Noble Brako-Kusi
+// File: Futex.h
+// Date: October 19, 2026
+// Purpose: Blocking on an atomic word with the Linux futex system call
+
+#ifndef FUTEX_H
+#define FUTEX_H
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/**
+ * Sleeping and waking on a 32-bit atomic word, the way std::atomic::wait does in C++20. A waiter
+ * passes the value it last saw; the kernel puts it to sleep only if the word still holds that
+ * value, so a change made between the check and the sleep is never missed. Waking costs a system
+ * call, which callers avoid by tracking whether anyone waits.
+ */
+class Futex {
+public:
+    /**
+     * Blocks the calling thread while word holds expected. May return spuriously, so callers
+     * recheck their condition.
+     * @param word the word to wait on
+     * @param expected the value last seen in word
+     */
+    static void wait(std::atomic<uint32_t>& word, uint32_t expected) {
+        syscall(SYS_futex, address(word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+    }
+
+    /**
+     * Wakes threads blocked in wait() on word.
+     * @param word the word waited on
+     * @param count the most threads to wake
+     */
+    static void wake(std::atomic<uint32_t>& word, uint32_t count = INT_MAX) {
+        syscall(SYS_futex, address(word), FUTEX_WAKE_PRIVATE,
+                static_cast<int>(count > INT_MAX ? INT_MAX : count), nullptr, nullptr, 0);
+    }
+
+    /**
+     * Tells the processor the calling thread is spinning, so that it yields pipeline resources to
+     * a sibling hyperthread. Call it on every iteration of a spin-wait.
+     */
+    static void pause() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+private:
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) &&
+                  std::atomic<uint32_t>::is_always_lock_free,
+                  "the futex word must be a plain 32-bit integer");
+
+    static uint32_t* address(std::atomic<uint32_t>& word) {
+        return reinterpret_cast<uint32_t*>(&word);
+    }
+};
+
+#endif // FUTEX_H
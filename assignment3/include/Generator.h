@@ -0,0 +1,158 @@
+// Author: Mac-Noble Brako-Kusi
+// File: Generator.h
+// Date: October 19, 2026
+// Purpose: Coroutine generator producing a lazy sequence with co_yield; needs C++20
+
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+#if __cplusplus < 202002L
+#error "Generator.h needs C++20 coroutines: build the target with cxx_std_20"
+#endif
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/**
+ * A lazy sequence produced by a coroutine. The body runs up to its next co_yield each time the
+ * sequence is advanced, so nothing is computed before it is asked for, and the Generator owns the
+ * coroutine frame. Iterate it once, usually with a range for:
+ *
+ *     Generator<int> upTo(int n) {
+ *         for (int i = 0; i < n; ++i)
+ *             co_yield i;
+ *     }
+ *
+ * The yielded value is referenced, not copied, and stays valid until the sequence is advanced
+ * again, so a body may yield a buffer it refills. An exception thrown by the body leaves through
+ * the begin() or ++ that resumed it, and ends the sequence. The body may not co_await.
+ */
+template<typename T> class Generator {
+    static_assert(!std::is_reference_v<T>, "Generator yields values; T must not be a reference");
+
+public:
+    class promise_type;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    /**
+     * The promise of a Generator coroutine, used by the compiler.
+     */
+    class promise_type {
+    public:
+        Generator get_return_object() {return Generator(Handle::from_promise(*this));}
+        std::suspend_always initial_suspend() noexcept {return {};}
+        std::suspend_always final_suspend() noexcept {return {};}
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept {mError = std::current_exception();}
+
+        std::suspend_always yield_value(T& value) noexcept {
+            mValue = std::addressof(value);
+            return {};
+        }
+
+        // A temporary lives until the end of the co_yield expression, past the suspension
+        std::suspend_always yield_value(T&& value) noexcept {
+            mValue = std::addressof(value);
+            return {};
+        }
+
+        template<typename U> std::suspend_never await_transform(U&&) = delete;
+
+    private:
+        friend class Generator;
+
+        T* mValue = nullptr;
+        std::exception_ptr mError;
+    };
+
+    /**
+     * An input iterator over the yielded values, compared with end() to find the end.
+     */
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        iterator() = default;
+
+        reference operator*() const {return *mHandle.promise().mValue;}
+        pointer operator->() const {return mHandle.promise().mValue;}
+
+        iterator& operator++() {
+            Generator::advance(mHandle);
+            return *this;
+        }
+
+        void operator++(int) {++*this;}
+
+        friend bool operator==(const iterator& it, std::default_sentinel_t) {
+            return !it.mHandle || it.mHandle.done();
+        }
+
+    private:
+        friend class Generator;
+
+        explicit iterator(Handle handle) : mHandle(handle) {}
+
+        Handle mHandle;
+    };
+
+    Generator(Generator&& src) noexcept : mHandle(std::exchange(src.mHandle, nullptr)) {}
+
+    Generator& operator=(Generator&& src) noexcept {
+        if (this != &src) {
+            if (mHandle)
+                mHandle.destroy();
+            mHandle = std::exchange(src.mHandle, nullptr);
+        }
+        return *this;
+    }
+
+    Generator(const Generator&) = delete;
+    Generator& operator=(const Generator&) = delete;
+
+    ~Generator() {
+        if (mHandle)
+            mHandle.destroy();
+    }
+
+    /**
+     * Runs the body up to its first co_yield. Call it once.
+     * @return an iterator at the first value, or equal to end() if there is none
+     */
+    iterator begin() {
+        advance(mHandle);
+        return iterator(mHandle);
+    }
+
+    /**
+     * Returns the end of the sequence.
+     * @return the sentinel every iterator compares equal to once the body has finished
+     */
+    std::default_sentinel_t end() const noexcept {return {};}
+
+private:
+    explicit Generator(Handle handle) : mHandle(handle) {}
+
+    /**
+     * Resumes the body up to its next co_yield or its end, rethrowing what it threw.
+     * @param handle the coroutine
+     */
+    static void advance(Handle handle) {
+        handle.resume();
+        if (handle.promise().mError)
+            std::rethrow_exception(std::exchange(handle.promise().mError, nullptr));
+    }
+
+    Handle mHandle;
+};
+
+#endif // GENERATOR_H
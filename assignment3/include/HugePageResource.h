@@ -0,0 +1,151 @@
+// Author: Mac-Noble Brako-Kusi
+// File: HugePageResource.h
+// Date: October 19, 2026
+// Purpose: Declaration file for HugePageResource class
+
+#ifndef HUGE_PAGE_RESOURCE_H
+#define HUGE_PAGE_RESOURCE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+/**
+ * How a HugePageResource backs large buffers with 2 MB pages.
+ */
+enum class HugePages {
+    /**
+     * Regular pages only.
+     */
+    None,
+
+    /**
+     * Transparent huge pages: the mapping is 2 MB aligned and marked with madvise(MADV_HUGEPAGE),
+     * so the kernel can use huge pages without any reservation.
+     */
+    Transparent,
+
+    /**
+     * Pages from the reserved hugetlbfs pool (MAP_HUGETLB). If the pool cannot satisfy the
+     * request, the mapping falls back to transparent huge pages.
+     */
+    Explicit
+};
+
+/**
+ * Which NUMA nodes a HugePageResource places large buffers on.
+ */
+enum class NumaPolicy {
+    /**
+     * The kernel default: each page lands on the node of the thread that first touches it. Having
+     * each worker fill its own part of a buffer places that part on the worker's node.
+     */
+    FirstTouch,
+
+    /**
+     * Every page on the nodes in the mask (mbind MPOL_BIND).
+     */
+    Bind,
+
+    /**
+     * Pages spread round-robin over the nodes in the mask (mbind MPOL_INTERLEAVE), so a scan from
+     * any socket sees the average of local and remote bandwidth.
+     */
+    Interleave
+};
+
+/**
+ * Settings of a HugePageResource.
+ */
+struct HugePageOptions {
+    /**
+     * How large buffers are backed.
+     */
+    HugePages hugePages = HugePages::Transparent;
+
+    /**
+     * Buffers smaller than this many bytes come from the default heap.
+     */
+    size_t threshold = size_t(2) << 20;
+
+    /**
+     * Where large buffers are placed.
+     */
+    NumaPolicy numaPolicy = NumaPolicy::FirstTouch;
+
+    /**
+     * The nodes used by Bind and Interleave: bit i stands for node i.
+     */
+    uint64_t nodeMask = 1;
+};
+
+/**
+ * A memory resource that maps large buffers directly from the operating system, backed by 2 MB
+ * huge pages and placed on chosen NUMA nodes, and serves small buffers from the default heap.
+ * Giving an ArrayList its own HugePageResource makes these settings per container:
+ *
+ *     HugePageResource resource(HugePageOptions{HugePages::Transparent, 2 << 20,
+ *                                               NumaPolicy::Interleave, 0b11});
+ *     ArrayList<uint64_t> list(resource);
+ *
+ * Each large buffer is its own mapping, rounded up to a whole number of huge pages, so this is
+ * meant for the few big buffers of big containers rather than for many small ones. NUMA placement
+ * is a hint: if mbind() fails, for example because a node in the mask does not exist, the buffer
+ * is still returned and placementFailures() is incremented. On platforms other than Linux every
+ * buffer comes from the default heap.
+ */
+class HugePageResource : public std::pmr::memory_resource {
+public:
+    /**
+     * The size of a huge page, which large mappings are aligned and rounded to.
+     */
+    static constexpr size_t kHugePageSize = size_t(2) << 20;
+
+    /**
+     * Creates a HugePageResource with the provided settings.
+     * @param options the huge page, threshold and NUMA settings
+     */
+    explicit HugePageResource(const HugePageOptions& options = HugePageOptions());
+
+    /**
+     * Returns the settings of this resource.
+     * @return the options it was created with
+     */
+    [[nodiscard]] const HugePageOptions& options() const;
+
+    /**
+     * Returns the number of bytes currently mapped for large buffers.
+     * @return the mapped bytes, after rounding to whole pages
+     */
+    [[nodiscard]] size_t mappedBytes() const;
+
+    /**
+     * Returns how many Explicit mappings fell back to transparent huge pages.
+     * @return the number of fallbacks
+     */
+    [[nodiscard]] uint64_t hugeTlbFallbacks() const;
+
+    /**
+     * Returns how many large buffers could not be given the requested NUMA placement.
+     * @return the number of failed mbind() calls
+     */
+    [[nodiscard]] uint64_t placementFailures() const;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    bool isLarge(size_t bytes, size_t alignment) const;
+    size_t mappingLength(size_t bytes) const;
+    void* map(size_t length);
+    void place(void* p, size_t length);
+
+    HugePageOptions mOptions;
+    std::atomic<size_t> mMappedBytes;
+    std::atomic<uint64_t> mHugeTlbFallbacks;
+    std::atomic<uint64_t> mPlacementFailures;
+};
+
+#endif // HUGE_PAGE_RESOURCE_H
@@ -0,0 +1,273 @@
+// Author: Mac-Noble Brako-Kusi
+// File: IncrementalArrayList.h
+// Date: October 19, 2026
+// Purpose: Declaration file for IncrementalArrayList template class
+
+#ifndef INCREMENTAL_ARRAYLIST_H
+#define INCREMENTAL_ARRAYLIST_H
+
+#include "ContainerError.h"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <type_traits>
+
+/**
+ * An array-backed list whose growth is spread over many operations. When ArrayList runs out of
+ * capacity, resize() moves every element into the new buffer at once, so one add() on a huge
+ * list takes as long as copying the whole list. Here the new buffer is allocated instead, and
+ * the old buffer is kept alongside it while a migration is in progress. New elements go straight
+ * into the new buffer, and every append moves at most migrationStep() elements from the old
+ * buffer over. The migration always finishes before the new buffer fills: it holds twice as
+ * many elements as the old one, and each append migrates at least one element.
+ *
+ * While migrating, element i lives in the new buffer if it has already been migrated or was
+ * added after growth started, and in the old buffer otherwise; get() and operator[] route each
+ * read to the right buffer. Operations that shift elements (inserting away from the end and
+ * remove()) finish the migration first, since they touch every element anyway.
+ *
+ * Elements are moved when their move constructor cannot throw and copied otherwise, so add()
+ * keeps ArrayList's strong exception guarantee. The buffers are raw storage from a memory
+ * resource: an element is constructed only when it is added or migrated, so growing costs one
+ * allocation however expensive T is to default-construct. Releasing the old buffer at the end of
+ * the migration destroys the elements left in it and happens in one call, which for a huge
+ * buffer means the allocator returning it to the operating system.
+ */
+template<typename T> class IncrementalArrayList {
+public:
+    /**
+     * The number of elements migrated per append unless another step is requested.
+     */
+    static constexpr uint32_t kDefaultMigrationStep = 64;
+
+    /**
+     * Creates an IncrementalArrayList of size 0.
+     * @param migrationStep the maximum number of elements migrated by each append, at least 1
+     */
+    explicit IncrementalArrayList(uint32_t migrationStep = kDefaultMigrationStep);
+
+    /**
+     * Creates an IncrementalArrayList of size 0 whose buffers are allocated from the provided
+     * memory resource, for example a HugePageResource. The resource must outlive the list.
+     * Copies of the list allocate from the same resource, while a list assigned to keeps its own.
+     * @param resource the memory resource to allocate buffers from
+     * @param migrationStep the maximum number of elements migrated by each append, at least 1
+     */
+    explicit IncrementalArrayList(std::pmr::memory_resource& resource,
+                                  uint32_t migrationStep = kDefaultMigrationStep);
+
+    /**
+     * Creates a deep copy of the provided IncrementalArrayList. The copy is not migrating.
+     * @param src IncrementalArrayList to copy
+     */
+    IncrementalArrayList(const IncrementalArrayList<T>& src);
+
+    /**
+     * Performs move constructor semantics on the provided IncrementalArrayList.
+     * @param src IncrementalArrayList to move
+     */
+    IncrementalArrayList(IncrementalArrayList<T>&& src) noexcept;
+
+    ~IncrementalArrayList();
+
+    /**
+     * Makes *this a deep copy of the provided IncrementalArrayList, allocated from this list's
+     * own memory resource. The copy is not migrating.
+     * @param src IncrementalArrayList to copy
+     * @return *this for chaining
+     */
+    IncrementalArrayList<T>& operator=(const IncrementalArrayList<T>& src);
+
+    /**
+     * Performs move assignment semantics on the provided IncrementalArrayList, leaving it empty.
+     * *this keeps its own memory resource: if src allocates from another one, the elements are
+     * moved into a new buffer from this list's resource, which can throw.
+     * @param src IncrementalArrayList to move
+     * @return *this for chaining
+     */
+    IncrementalArrayList<T>& operator=(IncrementalArrayList<T>&& src);
+
+    /**
+     * Adds the provided element to the end of this list. If the list is full, a buffer of
+     * double the capacity is allocated and a migration starts; otherwise at most
+     * migrationStep() pending elements are migrated.
+     * @param value value to add
+     * @return total capacity
+     */
+    const uint32_t& add(const T& value);
+
+    /**
+     * Inserts the provided value before the element at the specified index, with the same
+     * semantics as ArrayList::add(index, value). Inserting anywhere but the end finishes any
+     * migration first. If the list would exceed UINT32_MAX elements, std::length_error is thrown.
+     * @param index location at which to insert the new element
+     * @param value the element to insert
+     * @return total capacity
+     */
+    const uint32_t& add(const uint32_t& index, const T& value);
+
+    /**
+     * Returns a const T & to the element stored at the specified index. If the index is out of
+     * bounds, std::out_of_range is thrown with the index as its message.
+     * @param index the desired location
+     * @return a const T & to the desired element.
+     */
+    const T& get(const uint32_t& index) const;
+
+    /**
+     * Returns a T & to the element stored at the specified index. If the index is out of
+     * bounds, std::out_of_range is thrown with the index as its message. The reference is
+     * invalidated by the next add(), which may migrate the element.
+     * @param index the desired location
+     * @return a T & to the desired element.
+     */
+    T& get(const uint32_t& index);
+
+    /**
+     * Returns a T & to the element stored at the specified index.
+     * No range checking is performed.
+     * @param index the desired location
+     * @return a T & to the desired element.
+     */
+    T& operator[](const uint32_t& index);
+
+    /**
+     * Returns a const T & to the element stored at the specified index.
+     * No range checking is performed.
+     * @param index the desired location
+     * @return a const T & to the desired element.
+     */
+    const T& operator[](const uint32_t& index) const;
+
+    /**
+     * Sets the element at the desired location to the specified value. If index is out of
+     * range, std::out_of_range is thrown with index as its message.
+     * @param index the location to change
+     * @param value the new value of the specified element.
+     */
+    void set(const uint32_t& index, const T& value);
+
+    /**
+     * Removes an element at the specified location and returns it. Elements following index
+     * are shifted down, after finishing any migration. If index is out of range,
+     * std::out_of_range is thrown with index as its message.
+     * @param index the desired location
+     * @return a copy of the removed element.
+     */
+    T remove(const uint32_t& index);
+
+    /**
+     * Migrates every pending element and releases the old buffer.
+     */
+    void finishMigration();
+
+    /**
+     * Migration check.
+     * @return True if some elements still live in the old buffer.
+     */
+    [[nodiscard]] bool isMigrating() const;
+
+    /**
+     * Returns the maximum number of elements migrated by each append.
+     * @return the migration step
+     */
+    [[nodiscard]] uint32_t migrationStep() const;
+
+    /**
+     * Clears this list, leaving it empty.
+     */
+    void clear();
+
+    /**
+     * Empty check.
+     * @return True if this list is empty and false otherwise.
+     */
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Returns the size of this list.
+     * @return the size of this list.
+     */
+    [[nodiscard]] uint32_t size() const;
+
+    /**
+     * Returns the capacity of the current buffer.
+     * @return the number of elements that fit without growing.
+     */
+    [[nodiscard]] uint32_t capacity() const;
+
+    /**
+     * Returns the bytes of both buffers while migrating, or of the current buffer otherwise.
+     * Memory the elements allocate themselves is not included.
+     * @return the bytes allocated for elements.
+     */
+    [[nodiscard]] size_t memoryFootprint() const;
+
+    /**
+     * Returns the memory resource the buffers are allocated from.
+     * @return the memory resource
+     */
+    [[nodiscard]] std::pmr::memory_resource* resource() const;
+
+    /**
+     * Perform an exception-safe swap of the contents of *this with src.
+     */
+    void swap(IncrementalArrayList<T>& src) noexcept;
+
+private:
+    void migrate(uint32_t count);
+    bool migrated(uint32_t index) const;
+    T* allocate(uint32_t capacity) const;
+    T* copyOf(const IncrementalArrayList<T>& src) const;
+    void release(T* buffer, uint32_t constructed, uint32_t capacity) const;
+    void releaseOld();
+
+    /**
+     * The current buffer, of capacity mCapacity. Only the elements of the list that live in it
+     * are constructed: indices below mMigrated and from mOldSize up to mSize.
+     */
+    T* mArray;
+
+    /**
+     * The buffer being migrated away from, or null when not migrating. It was full when the
+     * migration started, so it holds mOldSize constructed elements, the migrated ones moved from.
+     */
+    T* mOld;
+
+    /**
+     * The resource both buffers come from.
+     */
+    std::pmr::memory_resource* mResource;
+
+    /**
+     * The logical size of this list.
+     */
+    uint32_t mSize;
+
+    /**
+     * The capacity of mArray.
+     */
+    uint32_t mCapacity;
+
+    /**
+     * The number of elements that lived in mOld when the migration started.
+     */
+    uint32_t mOldSize;
+
+    /**
+     * The number of leading elements already migrated into mArray.
+     */
+    uint32_t mMigrated;
+
+    /**
+     * The maximum number of elements migrated by each append.
+     */
+    uint32_t mMigrationStep;
+};
+
+#include "../src/IncrementalArrayList.cpp"
+
+#endif // INCREMENTAL_ARRAYLIST_H
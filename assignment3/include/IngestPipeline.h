@@ -0,0 +1,89 @@
+// Author: Mac-Noble Brako-Kusi
+// File: IngestPipeline.h
+// Date: October 19, 2026
+// Purpose: Declaration file for the ingestFile pipeline, which streams a file into an ArrayList
+
+#ifndef INGEST_PIPELINE_H
+#define INGEST_PIPELINE_H
+
+#if __cplusplus < 202002L
+#error "IngestPipeline.h needs C++20 coroutines: build the target with cxx_std_20"
+#endif
+
+#include "ArrayList.h"
+#include "ContainerError.h"
+#include "Generator.h"
+#include "Task.h"
+#include "ThreadPool.h"
+#include <cstdint>
+#include <string>
+
+/**
+ * Tuning for ingestFile().
+ */
+struct IngestOptions {
+    /**
+     * Bytes read per chunk. A chunk is extended past this to end on a delimiter when a record
+     * is longer.
+     */
+    uint32_t chunkBytes = 1U << 20;
+
+    /**
+     * Number of parsing threads; 0 uses one per hardware thread.
+     */
+    uint32_t parseThreads = 0;
+
+    /**
+     * Chunks that may be read, parsed or waiting to be appended at once. Each holds its bytes
+     * and its parsed elements, so this bounds the memory of the pipeline: the reader stops
+     * when they are all in use, until the oldest has been appended.
+     */
+    uint32_t inFlightChunks = 8;
+
+    /**
+     * The byte ending each record. Chunks are only split after one.
+     */
+    char delimiter = '\n';
+};
+
+/**
+ * What ingestFile() did.
+ */
+struct IngestStats {
+    uint64_t bytesRead = 0;
+    uint64_t chunks = 0;
+    uint64_t elements = 0;
+};
+
+/**
+ * Appends the records of a file to an ArrayList, overlapping the reading, parsing and appending
+ * of successive chunks. The pipeline is a coroutine: a Generator reads the file a chunk at a time
+ * on a reading thread, each chunk ending on a record delimiter; each chunk becomes a Task that
+ * parses it on a ThreadPool while the next chunk is read; and the parsed batches are awaited and
+ * appended to target in file order. At most inFlightChunks chunks are read but not yet appended,
+ * which is the backpressure: a slow parser or appender stops the reading rather than letting
+ * chunks pile up in memory. The calling thread waits for the pipeline with syncWait().
+ *
+ * parse is called concurrently from the parsing threads, each call with a whole number of
+ * records, and appends what it parses to its out list:
+ *
+ *     void parse(const char* begin, const char* end, ArrayList<T>& out);
+ *
+ * Each batch is appended with one addAll(), so target is reallocated at most once per batch.
+ *
+ * If the file cannot be opened or read, or a thread cannot be started, std::system_error is
+ * thrown. If parse throws, the first exception is rethrown once the pipeline has stopped. Either
+ * way, target keeps the batches already appended, which are a prefix of the file's records.
+ * @param path the file to read
+ * @param target the list to append to
+ * @param parse the record parser
+ * @param options the tuning
+ * @return what was read and appended
+ */
+template<typename T, typename Parse>
+IngestStats ingestFile(const std::string& path, ArrayList<T>& target, const Parse& parse,
+                       const IngestOptions& options = IngestOptions());
+
+#include "../src/IngestPipeline.cpp"
+
+#endif // INGEST_PIPELINE_H
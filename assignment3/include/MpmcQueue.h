@@ -0,0 +1,117 @@
+// Author: Mac-Noble Brako-Kusi
+// File: MpmcQueue.h
+// Date: October 19, 2026
+// Purpose: Declaration file for MpmcQueue template class
+
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include "ContainerError.h"
+#include "Futex.h"
+#include "ScopedArray.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+/**
+ * A bounded, lock-free FIFO queue for any number of producer and consumer threads. The elements
+ * live in a ring of ScopedArray storage whose capacity is a power of two, and each slot carries a
+ * sequence number saying whose turn it is: a producer claims position p by advancing the tail with
+ * a compare-and-swap once the slot's sequence reads p, writes the element and sets the sequence to
+ * p + 1; a consumer claims it the same way through the head once the sequence reads p + 1, and
+ * hands the slot to the next lap by setting it to p + capacity(). The head and the tail each have
+ * a cache line of their own.
+ *
+ * Pushing and popping never block: they fail when the queue is full or empty. A thread that has
+ * claimed a slot does finish with it before anyone can use the slot again, so a claimant stalled
+ * mid-write holds up the threads that come to its slot a lap later, but nobody else. Wrap the
+ * queue in a BlockingQueue to wait instead. The element type must be default constructible and
+ * movable.
+ */
+template<typename T> class MpmcQueue {
+public:
+    using value_type = T;
+
+    /**
+     * Creates an empty queue holding at least the provided number of elements. If capacity is 0
+     * or greater than 2^31, std::invalid_argument is thrown.
+     * @param capacity the least number of elements the queue can hold
+     */
+    explicit MpmcQueue(uint32_t capacity);
+
+    MpmcQueue(const MpmcQueue<T>&) = delete;
+    MpmcQueue<T>& operator=(const MpmcQueue<T>&) = delete;
+
+    /**
+     * Appends an element, unless the queue is full.
+     * @param value the element to append
+     * @return true if the element was appended
+     */
+    bool tryPush(const T& value);
+    bool tryPush(T&& value);
+
+    /**
+     * Appends up to the provided number of elements, in order, claiming their slots with one
+     * compare-and-swap, so that elements of other producers are never interleaved with them. When
+     * not all of them fit, a shorter run is appended, halving the count until one fits.
+     * @param values the elements to append
+     * @param count the number of elements
+     * @return the number of elements appended, from the start of values
+     */
+    uint32_t tryPushBatch(const T* values, uint32_t count);
+
+    /**
+     * Removes the oldest element, unless the queue is empty.
+     * @param out receives the element
+     * @return true if an element was removed
+     */
+    bool tryPop(T& out);
+
+    /**
+     * Removes up to the provided number of the oldest elements, in order, claiming their slots
+     * with one compare-and-swap. When fewer are ready, a shorter run is removed, halving the count
+     * until one is ready.
+     * @param out receives the elements
+     * @param max the most elements to remove
+     * @return the number of elements removed
+     */
+    uint32_t tryPopBatch(T* out, uint32_t max);
+
+    /**
+     * Returns the number of elements in the queue. Exact only while no thread is running.
+     * @return the number of elements
+     */
+    [[nodiscard]] uint32_t size() const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Returns the number of elements the queue can hold.
+     * @return the capacity, a power of two
+     */
+    [[nodiscard]] uint32_t capacity() const;
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> sequence;
+        T value;
+    };
+
+    template<typename Value> bool push(Value&& value);
+    uint64_t claim(std::atomic<uint64_t>& index, uint32_t& count, uint64_t turn);
+    void awaitTurn(const Slot& slot, uint64_t sequence) const;
+    static uint32_t roundCapacity(uint32_t capacity);
+
+    ScopedArray<Slot> mSlots;
+    uint64_t mMask;
+
+    // The next position to write, on a line of its own
+    alignas(64) std::atomic<uint64_t> mTail;
+
+    // The next position to read, on a line of its own
+    alignas(64) std::atomic<uint64_t> mHead;
+};
+
+#include "../src/MpmcQueue.cpp"
+
+#endif // MPMC_QUEUE_H
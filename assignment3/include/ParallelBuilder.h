@@ -0,0 +1,185 @@
+// Author: Mac-Noble Brako-Kusi
+// File: ParallelBuilder.h
+// Date: October 19, 2026
+// Purpose: Declaration file for ParallelBuilder and SegmentedView template classes
+
+#ifndef PARALLEL_BUILDER_H
+#define PARALLEL_BUILDER_H
+
+#include "ArrayList.h"
+#include "ContainerError.h"
+#include "ParallelFor.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * A read-only list made of several ArrayLists laid end to end, indexed as one. Indexing finds
+ * the segment by binary search over the segment offsets; iterating segment by segment, with
+ * segments() and segment(), avoids even that.
+ */
+template<typename T> class SegmentedView {
+public:
+    /**
+     * Creates a view of no segments.
+     */
+    SegmentedView();
+
+    /**
+     * Creates a view owning the provided segments, in order. Empty segments are dropped.
+     * @param segments the segments
+     */
+    explicit SegmentedView(std::vector<ArrayList<T>>&& segments);
+
+    /**
+     * Returns the element at the specified index, counting across segments. If the index is out
+     * of bounds, std::out_of_range is thrown with the index as its message.
+     * @param index the desired location
+     * @return a const T & to the desired element.
+     */
+    const T& get(uint64_t index) const;
+
+    /**
+     * Returns the element at the specified index, counting across segments. No range checking
+     * is performed.
+     * @param index the desired location
+     * @return a const T & to the desired element.
+     */
+    const T& operator[](uint64_t index) const;
+
+    /**
+     * Returns the number of non-empty segments.
+     * @return the number of segments
+     */
+    [[nodiscard]] uint32_t segments() const;
+
+    /**
+     * Returns one segment.
+     * @param segment the segment number, less than segments()
+     * @return the segment
+     */
+    const ArrayList<T>& segment(uint32_t segment) const;
+
+    /**
+     * Returns the total number of elements.
+     * @return the size of the view
+     */
+    [[nodiscard]] uint64_t size() const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Copies the elements into one contiguous ArrayList, copying the segments in parallel.
+     * @param threads number of threads to use; 0 uses one per hardware thread
+     * @return the ArrayList
+     */
+    ArrayList<T> flatten(uint32_t threads = 0) const;
+
+private:
+    template<typename U> friend class ParallelBuilder;
+
+    uint32_t segmentOf(uint64_t index) const;
+
+    template<typename Element, typename Transfer>
+    static ArrayList<T> concatenate(const std::vector<Element*>& segments,
+                                    const std::vector<uint64_t>& offsets, uint32_t threads,
+                                    Transfer transfer);
+
+    std::vector<ArrayList<T>> mSegments;
+
+    /**
+     * mOffsets[i] is the index of the first element of segment i; the last entry is size().
+     */
+    std::vector<uint64_t> mOffsets;
+};
+
+/**
+ * Collects the output of many threads into one list. Each thread appends to a chunk of its own,
+ * with no synchronization: either chunk(worker) for workers numbered by the caller, or local(),
+ * which gives the calling thread a chunk the first time it asks (taking a lock once per thread)
+ * and finds it again through a thread-local cache. Appending to a chunk is an ArrayList::add.
+ *
+ * Once every thread has finished, build() concatenates the chunks: a prefix sum over the chunk
+ * sizes gives each chunk its offset, the destination is allocated once, and the elements are moved
+ * in parallel, each thread taking an equal share of the destination. view() skips the copy
+ * altogether and hands the chunks over as a SegmentedView. Either leaves the builder empty.
+ *
+ * Chunks are concatenated in worker order, the chunks of local() following those of chunk() in
+ * the order their threads first called local().
+ */
+template<typename T> class ParallelBuilder {
+public:
+    /**
+     * Creates a builder with the provided number of numbered chunks.
+     * @param workers number of chunks reachable through chunk()
+     */
+    explicit ParallelBuilder(uint32_t workers = 0);
+
+    ParallelBuilder(const ParallelBuilder<T>&) = delete;
+    ParallelBuilder<T>& operator=(const ParallelBuilder<T>&) = delete;
+
+    /**
+     * Returns the chunk of a numbered worker. If worker is not less than the number of workers
+     * given to the constructor, std::out_of_range is thrown.
+     * @param worker the worker number
+     * @return the worker's chunk
+     */
+    ArrayList<T>& chunk(uint32_t worker);
+
+    /**
+     * Returns the calling thread's chunk, creating it on the first call from the thread.
+     * @return the thread's chunk
+     */
+    ArrayList<T>& local();
+
+    /**
+     * Returns the total number of elements in the chunks. Must not run while threads append.
+     * @return the number of elements
+     */
+    [[nodiscard]] uint64_t size() const;
+
+    /**
+     * Concatenates the chunks into one ArrayList and empties the builder. Must not run while
+     * threads append. If the total exceeds what an ArrayList can index, std::length_error is
+     * thrown, and if the destination cannot be allocated or an element copy throws, that is
+     * rethrown; either way the builder is left as it was. Elements are moved when moving them
+     * cannot throw and copied otherwise.
+     * @param threads number of threads to use; 0 uses one per hardware thread
+     * @return the concatenation
+     */
+    ArrayList<T> build(uint32_t threads = 0);
+
+    /**
+     * Hands the chunks over as a SegmentedView, without copying, and empties the builder. Must
+     * not run while threads append.
+     * @return the view
+     */
+    SegmentedView<T> view();
+
+private:
+    std::vector<ArrayList<T>> takeChunks();
+    std::vector<ArrayList<T>*> chunkList();
+    static uint64_t nextId();
+
+    /**
+     * Distinguishes builders in the thread-local caches, even at a reused address.
+     */
+    uint64_t mId;
+    std::vector<ArrayList<T>> mWorkerChunks;
+
+    /**
+     * The chunks of local(), with the threads that own them. Guarded by mMutex; a chunk never
+     * moves once created.
+     */
+    std::mutex mMutex;
+    std::vector<std::thread::id> mLocalOwners;
+    std::vector<std::unique_ptr<ArrayList<T>>> mLocalChunks;
+};
+
+#include "../src/ParallelBuilder.cpp"
+
+#endif // PARALLEL_BUILDER_H
@@ -0,0 +1,145 @@
+// Author: Mac-Noble Brako-Kusi
+// File: ParallelFor.h
+// Date: October 19, 2026
+// Purpose: Fork-join helper shared by the parallel algorithms
+
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+#include "ContainerError.h"
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Runs a function once for each thread index in [0, threads), on that many threads, the caller
+ * being thread 0, and returns when every call has. If calls throw, the exception of the lowest
+ * thread index is rethrown once every thread is joined; the others are dropped. Every thread is
+ * started before any runs the function, so the calls may wait for each other, for example at a
+ * ThreadBarrier, but then none of them may throw, or the others wait forever. If a thread cannot
+ * be started, the function runs nowhere, the threads already started are joined, and the
+ * std::system_error is rethrown.
+ * @param threads the number of threads, at least 1
+ * @param function the function, called with the thread index
+ */
+template<typename Function> void parallelFor(uint32_t threads, const Function& function) {
+    if (threads <= 1) {
+        function(0);
+        return;
+    }
+
+    /**
+     * Joins the started workers however parallelFor exits, so no joinable thread is destroyed.
+     */
+    struct Workers {
+        std::vector<std::thread> threads;
+        void join() {
+            for (std::thread& thread : threads)
+                thread.join();
+            threads.clear();
+        }
+        ~Workers() {join();}
+    };
+
+    enum Start {kWaiting, kRunning, kCancelled};
+    std::mutex mutex;
+    std::condition_variable started;
+    Start start = kWaiting;
+    auto open = [&](Start state) {
+        std::lock_guard<std::mutex> lock(mutex);
+        start = state;
+        started.notify_all();
+    };
+    std::vector<std::exception_ptr> errors(threads);
+    auto run = [&](uint32_t t) {
+        CONTAINER_TRY {
+            function(t);
+        } CONTAINER_CATCH_ALL {
+            errors[t] = std::current_exception();
+        }
+    };
+
+    Workers workers;
+    workers.threads.reserve(threads - 1);
+    CONTAINER_TRY {
+        for (uint32_t t = 1; t < threads; ++t) {
+            workers.threads.emplace_back([&, t]() {
+                std::unique_lock<std::mutex> lock(mutex);
+                started.wait(lock, [&start]() {return start != kWaiting;});
+                bool proceed = start == kRunning;
+                lock.unlock();
+                if (proceed)
+                    run(t);
+            });
+        }
+    } CONTAINER_CATCH_ALL {
+        open(kCancelled);
+        CONTAINER_RETHROW;
+    }
+    open(kRunning);
+    run(0);
+    workers.join();
+#if CONTAINER_EXCEPTIONS
+    for (std::exception_ptr& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+#endif
+}
+
+/**
+ * Holds each of a fixed number of threads until all of them have arrived, and can be reused
+ * straight away for the next phase. Used to separate the phases of one parallelFor instead of
+ * starting new threads for every phase.
+ */
+class ThreadBarrier {
+public:
+    /**
+     * Creates a barrier for the provided number of threads.
+     * @param threads the number of threads that must arrive, at least 1
+     */
+    explicit ThreadBarrier(uint32_t threads) : mThreads(threads), mArrived(0), mPhase(0) {}
+
+    ThreadBarrier(const ThreadBarrier&) = delete;
+    ThreadBarrier& operator=(const ThreadBarrier&) = delete;
+
+    /**
+     * Blocks until every thread has called wait() for the current phase. Everything the threads
+     * wrote before arriving is visible to all of them afterwards.
+     */
+    void wait() {
+        std::unique_lock<std::mutex> lock(mMutex);
+        uint64_t phase = mPhase;
+        if (++mArrived == mThreads) {
+            mArrived = 0;
+            ++mPhase;
+            mReleased.notify_all();
+            return;
+        }
+        mReleased.wait(lock, [this, phase]() {return mPhase != phase;});
+    }
+
+private:
+    std::mutex mMutex;
+    std::condition_variable mReleased;
+    const uint32_t mThreads;
+    uint32_t mArrived;
+    uint64_t mPhase;
+};
+
+/**
+ * Resolves a requested number of threads: 0 means one per hardware thread.
+ * @param requested the requested number of threads, or 0
+ * @return the number of threads to use, at least 1
+ */
+inline uint32_t threadsFor(uint32_t requested) {
+    if (requested != 0)
+        return requested;
+    uint32_t hardware = std::thread::hardware_concurrency();
+    return hardware == 0 ? 1 : hardware;
+}
+
+#endif // PARALLEL_FOR_H
@@ -0,0 +1,272 @@
+// Author: Mac-Noble Brako-Kusi
+// File: PersistentArrayList.h
+// Date: October 19, 2026
+// Purpose: Declaration file for PersistentArrayList template class
+
+#ifndef PERSISTENT_ARRAYLIST_H
+#define PERSISTENT_ARRAYLIST_H
+
+#include "ArrayList.h"
+#include "ContainerError.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ * An immutable list that shares structure between versions. Elements are stored in a 32-way
+ * trie of fixed-size leaves plus a separate tail leaf, so every "modifying" method leaves *this
+ * untouched and returns a new version that shares all unchanged nodes with the original. Copying
+ * a PersistentArrayList is O(1) and is the intended way to take a snapshot. Like ArrayList, this
+ * class assumes that the parametrized type has a default and a copy constructor, an assignment
+ * operator, and a destructor that never throws.
+ */
+template<typename T> class PersistentArrayList {
+private:
+    struct Node;
+    struct Branch;
+    struct Leaf;
+
+    /**
+     * The complete state of one version: the trie root, the tail leaf, and their bookkeeping.
+     */
+    struct Tree {
+        uint32_t size;
+        uint32_t shift;
+        std::shared_ptr<Branch> root;
+        std::shared_ptr<Leaf> tail;
+    };
+
+public:
+    /**
+     * A mutable view of a version that edits nodes it owns in place. Use it to apply a batch of
+     * changes without allocating a new path for every single change, then call persistent()
+     * to freeze the result. A Transient must not be used after persistent() has been called.
+     * A Transient can be moved but not copied: two copies would edit the same nodes, and one could
+     * change nodes the other had already frozen.
+     */
+    class Transient {
+    public:
+        Transient(const Transient&) = delete;
+        Transient& operator=(const Transient&) = delete;
+
+        /**
+         * Takes over the edits of the provided transient, which is left frozen.
+         * @param src Transient to move
+         */
+        Transient(Transient&& src) noexcept;
+
+        /**
+         * Takes over the edits of the provided transient, which is left frozen.
+         * @param src Transient to move
+         * @return *this for chaining
+         */
+        Transient& operator=(Transient&& src) noexcept;
+
+        /**
+         * Appends the provided element to the end of the list.
+         * @param value value to add
+         * @return *this for chaining
+         */
+        Transient& add(const T& value);
+
+        /**
+         * Sets the element at the desired location to the specified value. If index is out of
+         * range, std::out_of_range is thrown with index as its message.
+         * @param index the location to change
+         * @param value the new value of the specified element
+         * @return *this for chaining
+         */
+        Transient& set(const uint32_t& index, const T& value);
+
+        /**
+         * Removes the last element. If the list is empty, std::out_of_range is thrown.
+         * @return *this for chaining
+         */
+        Transient& removeLast();
+
+        /**
+         * Returns a const T & to the element stored at the specified index. If the index is out
+         * of bounds, std::out_of_range is thrown with the index as its message.
+         * @param index the desired location
+         * @return a const T & to the desired element
+         */
+        const T& get(const uint32_t& index) const;
+
+        /**
+         * Returns the size of the list being edited.
+         * @return the size of the list being edited
+         */
+        [[nodiscard]] uint32_t size() const;
+
+        /**
+         * Freezes the edits made so far and returns them as a new version. The transient is
+         * unusable afterwards.
+         * @return the edited version
+         */
+        PersistentArrayList<T> persistent();
+
+    private:
+        explicit Transient(const Tree& tree);
+
+        void ensureEditable() const;
+
+        friend class PersistentArrayList<T>;
+
+        /**
+         * The version being edited in place.
+         */
+        Tree mTree;
+
+        /**
+         * The identifier of the nodes this transient may edit in place, or zero once frozen.
+         */
+        uint64_t mEdit;
+    };
+
+    /**
+     * Creates an empty PersistentArrayList.
+     */
+    PersistentArrayList();
+
+    /**
+     * Creates a PersistentArrayList holding a copy of the elements of the provided ArrayList.
+     * @param src ArrayList to copy
+     */
+    explicit PersistentArrayList(const ArrayList<T>& src);
+
+    /**
+     * Returns a const T & to the element stored at the specified index. If the index is out of
+     * bounds, std::out_of_range is thrown with the index as its message.
+     * @param index the desired location
+     * @return a const T & to the desired element
+     */
+    const T& get(const uint32_t& index) const;
+
+    /**
+     * Returns a const T & to the element stored at the specified index.
+     * No range checking is performed.
+     * @param index the desired location
+     * @return a const T & to the desired element
+     */
+    const T& operator[](const uint32_t& index) const;
+
+    /**
+     * Returns a new version with the provided element added to the end. O(log n).
+     * @param value value to add
+     * @return the new version
+     */
+    PersistentArrayList<T> add(const T& value) const;
+
+    /**
+     * Returns a new version with the provided value inserted before the element at index. If
+     * index equals the size, this is the same as add(value); if it is greater, std::out_of_range
+     * is thrown. Inserting anywhere but the end rebuilds the trailing part of the list and is O(n).
+     * @param index location at which to insert the new element
+     * @param value the element to insert
+     * @return the new version
+     */
+    PersistentArrayList<T> add(const uint32_t& index, const T& value) const;
+
+    /**
+     * Returns a new version with the element at index replaced by value. If index is out of
+     * range, std::out_of_range is thrown with index as its message. O(log n).
+     * @param index the location to change
+     * @param value the new value of the specified element
+     * @return the new version
+     */
+    PersistentArrayList<T> set(const uint32_t& index, const T& value) const;
+
+    /**
+     * Returns a new version with the element at index removed and the following elements shifted
+     * down. If index is out of range, std::out_of_range is thrown with index as its message.
+     * Removing the last element is O(log n); removing any other element is O(n).
+     * @param index the desired location
+     * @return the new version
+     */
+    PersistentArrayList<T> remove(const uint32_t& index) const;
+
+    /**
+     * Returns a new version without the last element. If the list is empty, std::out_of_range
+     * is thrown. O(log n).
+     * @return the new version
+     */
+    PersistentArrayList<T> removeLast() const;
+
+    /**
+     * Empty check.
+     * @return True if this list is empty and false otherwise.
+     */
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Returns the size of this list.
+     * @return the size of this list.
+     */
+    [[nodiscard]] uint32_t size() const;
+
+    /**
+     * Starts a batch of in-place edits on top of this version. *this is never modified.
+     * @return a Transient editing a copy of this version
+     */
+    Transient transient() const;
+
+    /**
+     * Copies the elements of this version into a new ArrayList.
+     * @return an ArrayList holding the same elements
+     */
+    ArrayList<T> toArrayList() const;
+
+private:
+    static constexpr uint32_t kBits = 5;
+    static constexpr uint32_t kWidth = 1u << kBits;
+    static constexpr uint32_t kMask = kWidth - 1;
+
+    /**
+     * Common base of trie nodes. mEdit names the transient allowed to modify the node in place,
+     * or is zero if the node is shared and must be copied before any change.
+     */
+    struct Node {
+        explicit Node(uint64_t edit) : mEdit(edit) {}
+        virtual ~Node() = default;
+        uint64_t mEdit;
+    };
+
+    struct Branch : Node {
+        explicit Branch(uint64_t edit) : Node(edit) {}
+        std::shared_ptr<Node> mChildren[kWidth];
+    };
+
+    struct Leaf : Node {
+        explicit Leaf(uint64_t edit) : Node(edit) {}
+        T mValues[kWidth];
+    };
+
+    explicit PersistentArrayList(const Tree& tree);
+
+    static Tree emptyTree();
+    static uint64_t nextEdit();
+    static uint32_t tailOffset(const Tree& tree);
+    static const Leaf& leafFor(const Tree& tree, uint32_t index);
+    static std::shared_ptr<Branch> editable(const std::shared_ptr<Branch>& node, uint64_t edit);
+    static std::shared_ptr<Leaf> editable(const std::shared_ptr<Leaf>& node, uint64_t edit);
+    static std::shared_ptr<Node> newPath(uint32_t level, const std::shared_ptr<Node>& node,
+        uint64_t edit);
+    static std::shared_ptr<Branch> pushTail(const Tree& tree, uint32_t level,
+        const std::shared_ptr<Branch>& parent, const std::shared_ptr<Leaf>& tail, uint64_t edit);
+    static std::shared_ptr<Branch> popTail(const Tree& tree, uint32_t level,
+        const std::shared_ptr<Branch>& node, uint64_t edit);
+    static std::shared_ptr<Node> assoc(uint32_t level, const std::shared_ptr<Node>& node,
+        uint32_t index, const T& value, uint64_t edit);
+    static void push(Tree& tree, const T& value, uint64_t edit);
+    static void assign(Tree& tree, uint32_t index, const T& value, uint64_t edit);
+    static void pop(Tree& tree, uint64_t edit);
+
+    /**
+     * The state of this version. Never modified after construction.
+     */
+    Tree mTree;
+};
+
+#include "../src/PersistentArrayList.cpp"
+
+#endif // PERSISTENT_ARRAYLIST_H
@@ -0,0 +1,148 @@
+// Author: Mac-Noble Brako-Kusi
+// File: PoolResource.h
+// Date: October 19, 2026
+// Purpose: Declaration file for PoolResource class
+
+#ifndef POOL_RESOURCE_H
+#define POOL_RESOURCE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+/**
+ * Settings of a PoolResource.
+ */
+struct PoolOptions {
+    /**
+     * Blocks larger than this many bytes are not pooled: they come straight from operator new and
+     * go straight back to operator delete.
+     */
+    size_t largestPooledBlock = size_t(64) << 20;
+
+    /**
+     * The most bytes each thread keeps in its own cache for this resource.
+     */
+    size_t threadCacheBytes = size_t(16) << 20;
+
+    /**
+     * The most bytes the shared pool keeps; blocks freed beyond this go back to operator delete.
+     */
+    size_t maxRetainedBytes = size_t(256) << 20;
+
+    /**
+     * The number of blocks moved between a thread cache and the shared pool at a time.
+     */
+    uint32_t batchSize = 8;
+};
+
+/**
+ * A memory resource that recycles container buffers. Requests are rounded up to power-of-two size
+ * classes (ArrayList capacities are powers of two already), so the buffer freed when one list
+ * grows past a size fits the next list that grows to it. Freed blocks go to a cache owned by the
+ * freeing thread, and allocations are served from the allocating thread's cache first, so the
+ * common grow/free cycle takes no lock at all. Only when a thread's cache misses or overflows
+ * does it take the shared pool's lock, and then it moves a whole batch of blocks at once. Both
+ * the thread caches and the shared pool are capped, and blocks beyond the caps are freed.
+ *
+ *     PoolResource pool;
+ *     ArrayList<uint64_t> list(pool);
+ *
+ * A block may be freed by a different thread than the one that allocated it; it then simply joins
+ * the freeing thread's cache. When a thread exits, its cache goes back to the shared pool. When
+ * the resource is destroyed, the shared pool and the destroying thread's cache are freed; blocks
+ * still cached by other live threads are freed when those threads exit.
+ */
+class PoolResource : public std::pmr::memory_resource {
+public:
+    /**
+     * The alignment of every pooled block. Requests for a larger alignment are not pooled.
+     */
+    static constexpr size_t kBlockAlignment = 64;
+
+    /**
+     * The smallest size class, in bytes.
+     */
+    static constexpr size_t kSmallestBlock = 64;
+
+    /**
+     * Creates a PoolResource with the provided settings.
+     * @param options the size and cache limits
+     */
+    explicit PoolResource(const PoolOptions& options = PoolOptions());
+
+    /**
+     * Frees every block in the shared pool and in the calling thread's cache.
+     */
+    ~PoolResource() override;
+
+    PoolResource(const PoolResource&) = delete;
+    PoolResource& operator=(const PoolResource&) = delete;
+
+    /**
+     * Returns the settings of this resource.
+     * @return the options it was created with
+     */
+    [[nodiscard]] const PoolOptions& options() const;
+
+    /**
+     * Returns the number of bytes held by the shared pool.
+     * @return the retained bytes, not counting thread caches
+     */
+    [[nodiscard]] size_t retainedBytes() const;
+
+    /**
+     * Returns the number of blocks obtained from operator new. Allocations served from a cache or
+     * the shared pool do not count, so this measures how well buffers are being reused.
+     * @return the number of upstream allocations
+     */
+    [[nodiscard]] uint64_t upstreamAllocations() const;
+
+    /**
+     * Returns the calling thread's cached blocks to the shared pool, for example before a thread
+     * goes idle for a long time.
+     */
+    void flushThreadCache();
+
+    /**
+     * Frees every block in the shared pool.
+     */
+    void release();
+
+    /**
+     * Returns the size class a request falls into.
+     * @param bytes the requested size
+     * @return the size of the blocks of that class, a power of two of at least kSmallestBlock
+     */
+    static size_t blockSize(size_t bytes);
+
+private:
+    struct Central;
+    struct ThreadCache;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    static std::vector<std::unique_ptr<ThreadCache>>& threadCaches();
+
+    bool isPooled(size_t bytes, size_t alignment) const;
+    ThreadCache& threadCache();
+    void* allocateUpstream(size_t size);
+
+    PoolOptions mOptions;
+
+    /**
+     * Identifies this resource among the thread caches; never reused.
+     */
+    uint64_t mId;
+
+    /**
+     * The shared pool, also referenced by every thread cache so that it outlives them.
+     */
+    std::shared_ptr<Central> mCentral;
+};
+
+#endif // POOL_RESOURCE_H
@@ -0,0 +1,54 @@
+// Author: Mac-Noble Brako-Kusi
+// File: RadixSort.h
+// Date: October 19, 2026
+// Purpose: Declaration file for the parallel LSD radix sort of ArrayLists
+
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include "ArrayList.h"
+#include "ParallelFor.h"
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * Lists shorter than this are sorted with std::stable_sort, which beats the fixed cost of the
+ * radix passes on small inputs.
+ */
+const uint32_t kRadixSortThreshold = 2048;
+
+/**
+ * Lists shorter than this are sorted on the calling thread only.
+ */
+const uint32_t kRadixSortParallelThreshold = 1U << 16;
+
+/**
+ * Sorts a list of integers in ascending order with a least-significant-digit radix sort: one
+ * pass per byte of the key, each pass a counting histogram followed by a stable scatter into a
+ * second buffer. Passes in which every element has the same byte are skipped, so small keys in a
+ * wide type only pay for the bytes they use. Each pass splits the list into one contiguous chunk
+ * per thread: every thread counts its own chunk, the per-thread histograms are combined into
+ * starting offsets, and then every thread scatters its own chunk, so the threads never write to
+ * the same place. The threads are started once per sort and meet at a barrier between phases.
+ * Lists shorter than kRadixSortThreshold use std::stable_sort instead. Signed integers sort
+ * correctly. The sort is stable and needs a second buffer of size() elements. Neither moving a T
+ * nor the key function may throw.
+ * @param list the list to sort
+ * @param threads number of threads to use; 0 uses one per hardware thread
+ */
+template<typename T> void radixSort(ArrayList<T>& list, uint32_t threads = 0);
+
+/**
+ * Sorts a list by an integer key extracted from each element, with the radix sort described
+ * above. Elements with equal keys keep their relative order. keyOf is called several times per
+ * element and should be cheap, typically returning a field.
+ * @param list the list to sort
+ * @param keyOf function returning the integer key of an element
+ * @param threads number of threads to use; 0 uses one per hardware thread
+ */
+template<typename T, typename KeyOf, typename = std::enable_if_t<!std::is_integral_v<KeyOf>>>
+void radixSort(ArrayList<T>& list, KeyOf keyOf, uint32_t threads = 0);
+
+#include "../src/RadixSort.cpp"
+
+#endif // RADIX_SORT_H
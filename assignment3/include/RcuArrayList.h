@@ -0,0 +1,201 @@
+// Author: Mac-Noble Brako-Kusi
+// File: RcuArrayList.h
+// Date: October 19, 2026
+// Purpose: Declaration file for RcuArrayList template class
+
+#ifndef RCU_ARRAYLIST_H
+#define RCU_ARRAYLIST_H
+
+#include "ArrayList.h"
+#include "ContainerError.h"
+#include "EpochDomain.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * A list for read-mostly data shared between threads, such as configuration or routing tables.
+ * Its contents live in immutable versions. Readers take a Snapshot, which pins the current
+ * version and reads it without locks: taking one is wait-free, and every read through it sees
+ * the same consistent contents however many writes happen meanwhile. Writers are serialized by a
+ * mutex; each write copies the current version, edits the copy and publishes it with one atomic
+ * store, so a write costs O(size()). Use update() to apply many edits as one write.
+ *
+ * Replaced versions are reclaimed with epoch-based reclamation (see EpochDomain): a version is
+ * freed by a later write, or by reclaim(), once no Snapshot that could have seen it is alive.
+ * A long-lived Snapshot therefore delays the freeing of every version retired after it began.
+ *
+ * A Snapshot belongs to the thread that took it and must be destroyed before the list. The
+ * element type needs the same operations as for ArrayList.
+ */
+template<typename T> class RcuArrayList {
+    struct Version;
+
+public:
+    /**
+     * A consistent, read-only view of the list as it was when the snapshot was taken.
+     */
+    class Snapshot {
+    public:
+        /**
+         * Returns the element at the specified index. If the index is out of bounds,
+         * std::out_of_range is thrown with the index as its message.
+         * @param index the desired location
+         * @return a const T & to the desired element.
+         */
+        const T& get(uint32_t index) const;
+
+        /**
+         * Returns the element at the specified index. No range checking is performed.
+         * @param index the desired location
+         * @return a const T & to the desired element.
+         */
+        const T& operator[](uint32_t index) const {return mData[index];}
+
+        /**
+         * Returns a pointer to the elements of the snapshot.
+         * @return a const pointer to the first element
+         */
+        const T* data() const {return mData;}
+
+        const T* begin() const {return mData;}
+        const T* end() const {return mData + mSize;}
+
+        [[nodiscard]] uint32_t size() const {return mSize;}
+        [[nodiscard]] bool isEmpty() const {return mSize == 0;}
+
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+
+    private:
+        friend class RcuArrayList<T>;
+
+        explicit Snapshot(const std::atomic<Version*>& current);
+
+        /**
+         * Announces this thread's epoch before the version is loaded, and withdraws it last.
+         */
+        EpochDomain::Guard mGuard;
+        const T* mData;
+        uint32_t mSize;
+    };
+
+    /**
+     * Creates an empty RcuArrayList.
+     */
+    RcuArrayList();
+
+    /**
+     * Frees every version. No Snapshot of the list may be alive.
+     */
+    ~RcuArrayList();
+
+    RcuArrayList(const RcuArrayList<T>&) = delete;
+    RcuArrayList<T>& operator=(const RcuArrayList<T>&) = delete;
+
+    /**
+     * Takes a snapshot of the current version.
+     * @return the snapshot
+     */
+    Snapshot snapshot() const;
+
+    /**
+     * Returns a copy of the element at the specified index in the current version. If the
+     * index is out of bounds, std::out_of_range is thrown with the index as its message.
+     * @param index the desired location
+     * @return a copy of the desired element.
+     */
+    T get(uint32_t index) const;
+
+    /**
+     * Returns the size of the current version.
+     * @return the size
+     */
+    [[nodiscard]] uint32_t size() const;
+
+    /**
+     * Publishes a version with the provided element added to the end.
+     * @param value value to add
+     */
+    void add(const T& value);
+
+    /**
+     * Publishes a version with the provided element inserted, with the semantics of
+     * ArrayList::add(index, value).
+     * @param index location at which to insert the new element
+     * @param value the element to insert
+     */
+    void add(uint32_t index, const T& value);
+
+    /**
+     * Publishes a version with the element at the specified location replaced. If the index is
+     * out of bounds, std::out_of_range is thrown and nothing is published.
+     * @param index the location to change
+     * @param value the new value of the specified element.
+     */
+    void set(uint32_t index, const T& value);
+
+    /**
+     * Publishes a version without the element at the specified location. If the index is out of
+     * bounds, std::out_of_range is thrown and nothing is published.
+     * @param index the desired location
+     * @return a copy of the removed element.
+     */
+    T remove(uint32_t index);
+
+    /**
+     * Publishes an empty version.
+     */
+    void clear();
+
+    /**
+     * Applies any number of edits as one write: edit is called with an ArrayList<T> & holding a
+     * copy of the current version, and whatever it leaves there is published. If edit throws,
+     * nothing is published.
+     * @param edit function taking ArrayList<T> &
+     */
+    template<typename Edit> void update(Edit edit);
+
+    /**
+     * Frees the replaced versions that no snapshot can still be reading.
+     */
+    void reclaim();
+
+    /**
+     * Returns the number of replaced versions not yet freed.
+     * @return the number of retired versions
+     */
+    [[nodiscard]] uint32_t retiredVersions() const;
+
+private:
+    void publish(ArrayList<T>&& contents);
+    void reclaimLocked();
+
+    struct Version {
+        explicit Version(ArrayList<T>&& contents) : list(std::move(contents)) {}
+
+        ArrayList<T> list;
+        uint64_t retiredEpoch = 0;
+        Version* nextRetired = nullptr;
+    };
+
+    /**
+     * The version snapshots read.
+     */
+    std::atomic<Version*> mCurrent;
+
+    /**
+     * Serializes writers, and guards the retired versions.
+     */
+    mutable std::mutex mWriteMutex;
+
+    /**
+     * The replaced versions waiting to be freed, newest first.
+     */
+    Version* mRetired;
+    uint32_t mRetiredCount;
+};
+
+#include "../src/RcuArrayList.cpp"
+
+#endif // RCU_ARRAYLIST_H
@@ -7,7 +7,11 @@
 #ifndef MY_SCOPED_ARRAY_H
 #define MY_SCOPED_ARRAY_H
 
+#include "ContainerError.h"
+#include "ContainerTrace.h"
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 
 template<typename T>
 class ScopedArray {
@@ -17,6 +21,9 @@ class ScopedArray {
          // Constructor: Creates a ScopedArray object with an optional pointer to dynamically allocated memory.
          explicit ScopedArray(T* ptr = nullptr);
 
+         // Constructor: Allocates 'count' default-initialized elements from 'resource', or with new[] if 'resource' is null.
+         ScopedArray(size_t count, std::pmr::memory_resource* resource);
+
         // Destructor: Deallocates the memory held by the ScopedArray object.
         ~ScopedArray();
 
@@ -32,10 +39,17 @@ class ScopedArray {
          // Explicit conversion operator to check if the ScopedArray holds a valid pointer.
          explicit operator bool() const;
 
+         // Returns the memory resource the held memory came from, or nullptr if it came from new[].
+         std::pmr::memory_resource* resource() const;
+
+         // Returns the bytes of the held memory, or 0 if it was adopted from a raw pointer of unknown length.
+         size_t memoryFootprint() const;
+
          // Releases ownership of the held memory and returns the pointer without deallocating it.
+         // Only valid for memory from new[]; memory from a resource must be freed by a ScopedArray.
          T* release();
 
-         // Resets the ScopedArray to point to a new memory location, optionally deallocating the previous memory.
+         // Resets the ScopedArray to point to new memory from new[], optionally deallocating the previous memory.
          void reset(T* rhs = nullptr);
 
          // Swaps the contents of two ScopedArray objects.
@@ -48,8 +62,17 @@ class ScopedArray {
         // Disallow copy assignment.
         const ScopedArray& operator=(const ScopedArray&) = delete;
 
+        // Destroys and frees the held memory.
+        void destroy();
+
         // Pointer to the dynamically allocated memory.
         T* mArray;
+
+        // Number of elements held, or 0 if unknown because the memory was adopted from a raw pointer.
+        size_t mCount;
+
+        // Memory resource the held memory came from, or nullptr if it came from new[].
+        std::pmr::memory_resource* mResource;
 };
 
 
@@ -0,0 +1,241 @@
+// Author: Mac-Noble Brako-Kusi
+// File: SoAArrayList.h
+// Date: October 19, 2026
+// Purpose: Declaration file for SoAArrayList template class
+
+#ifndef SOA_ARRAYLIST_H
+#define SOA_ARRAYLIST_H
+
+#include "ContainerError.h"
+#include "ScopedArray.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+/**
+ * A non-owning view of one contiguous column of elements.
+ */
+template<typename T> class ColumnSpan {
+public:
+    ColumnSpan(T* data, uint32_t size) : mData(data), mSize(size) {}
+
+    T* data() const {
+        return mData;
+    }
+
+    [[nodiscard]] uint32_t size() const {
+        return mSize;
+    }
+
+    T* begin() const {
+        return mData;
+    }
+
+    T* end() const {
+        return mData + mSize;
+    }
+
+    T& operator[](uint32_t index) const {
+        return mData[index];
+    }
+
+private:
+    T* mData;
+    uint32_t mSize;
+};
+
+/**
+ * An array-backed list of records stored column by column: each field lives in its own
+ * contiguous ScopedArray, and row i is made of element i of every column. A scan that reads one
+ * field only pulls that field's column through the cache instead of whole records. Rows are
+ * accessed through proxies that hold a reference to each field, so `auto [id, price] = list[i]`
+ * binds straight to the stored values. Growth follows ArrayList: the capacity doubles, and every
+ * column is reallocated together so the columns always stay aligned. The field types must satisfy
+ * the same requirements as ArrayList elements. Like ArrayList, add() and set() provide the strong
+ * exception guarantee, and so does remove() unless a field has a throwing move assignment.
+ */
+template<typename... Fields> class SoAArrayList {
+public:
+    static_assert(sizeof...(Fields) > 0, "SoAArrayList needs at least one field");
+
+    /**
+     * A row proxy: one reference per field.
+     */
+    typedef std::tuple<Fields&...> Row;
+
+    /**
+     * A read-only row proxy.
+     */
+    typedef std::tuple<const Fields&...> ConstRow;
+
+    /**
+     * A row copied out of the list.
+     */
+    typedef std::tuple<Fields...> Value;
+
+    /**
+     * Creates an SoAArrayList of size 0.
+     */
+    SoAArrayList();
+
+    /**
+     * Creates a deep copy of the provided SoAArrayList.
+     * @param src SoAArrayList to copy
+     */
+    SoAArrayList(const SoAArrayList<Fields...>& src);
+
+    /**
+     * Performs move constructor semantics on the provided SoAArrayList.
+     * @param src SoAArrayList to move
+     */
+    SoAArrayList(SoAArrayList<Fields...>&& src) noexcept;
+
+    /**
+     * Makes *this a deep copy of the provided SoAArrayList.
+     * @param src SoAArrayList to copy
+     * @return *this for chaining
+     */
+    SoAArrayList<Fields...>& operator=(const SoAArrayList<Fields...>& src);
+
+    /**
+     * Performs move assignment semantics on the provided SoAArrayList.
+     * @param src SoAArrayList to move
+     * @return *this for chaining
+     */
+    SoAArrayList<Fields...>& operator=(SoAArrayList<Fields...>&& src) noexcept;
+
+    /**
+     * Adds a row to the end of this list. If the list needs to be enlarged, double the capacity
+     * from the current capacity, or go from zero to one.
+     * @param values one value per field
+     * @return total capacity
+     */
+    const uint32_t& add(const Fields&... values);
+
+    /**
+     * Inserts a row before the row at the specified index. As with ArrayList::add(index, value),
+     * an index past the end grows the list and fills the gap with default-constructed rows. If
+     * the list would exceed UINT32_MAX rows, std::length_error is thrown.
+     * @param index location at which to insert the new row
+     * @param values one value per field
+     * @return total capacity
+     */
+    const uint32_t& add(const uint32_t& index, const Fields&... values);
+
+    /**
+     * Returns a proxy to the row at the specified index. If the index is out of bounds,
+     * std::out_of_range is thrown with the index as its message.
+     * @param index the desired location
+     * @return references to the fields of the row
+     */
+    Row get(const uint32_t& index);
+
+    /**
+     * Returns a read-only proxy to the row at the specified index. If the index is out of bounds,
+     * std::out_of_range is thrown with the index as its message.
+     * @param index the desired location
+     * @return const references to the fields of the row
+     */
+    ConstRow get(const uint32_t& index) const;
+
+    /**
+     * Returns a proxy to the row at the specified index.
+     * No range checking is performed.
+     * @param index the desired location
+     * @return references to the fields of the row
+     */
+    Row operator[](const uint32_t& index);
+
+    /**
+     * Returns a read-only proxy to the row at the specified index.
+     * No range checking is performed.
+     * @param index the desired location
+     * @return const references to the fields of the row
+     */
+    ConstRow operator[](const uint32_t& index) const;
+
+    /**
+     * Replaces the row at the specified index. If index is out of range, std::out_of_range is
+     * thrown with index as its message.
+     * @param index the location to change
+     * @param values one value per field
+     */
+    void set(const uint32_t& index, const Fields&... values);
+
+    /**
+     * Removes the row at the specified index and returns it. Rows following index are shifted
+     * down. If index is out of range, std::out_of_range is thrown with index as its message.
+     * @param index the desired location
+     * @return a copy of the removed row
+     */
+    Value remove(const uint32_t& index);
+
+    /**
+     * Returns a view of the column of field I, suitable for tight, vectorizable loops.
+     * The view is invalidated by any operation that reallocates.
+     * @return the first size() elements of the column
+     */
+    template<size_t I> ColumnSpan<std::tuple_element_t<I, std::tuple<Fields...>>> column();
+
+    /**
+     * Returns a read-only view of the column of field I.
+     * @return the first size() elements of the column
+     */
+    template<size_t I>
+    ColumnSpan<const std::tuple_element_t<I, std::tuple<Fields...>>> column() const;
+
+    /**
+     * Clears this list, leaving it empty.
+     */
+    void clear();
+
+    /**
+     * Empty check.
+     * @return True if this list is empty and false otherwise.
+     */
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Returns the number of rows.
+     * @return the number of rows.
+     */
+    [[nodiscard]] uint32_t size() const;
+
+    /**
+     * Returns the number of rows that fit without reallocating.
+     * @return the capacity of every column.
+     */
+    [[nodiscard]] uint32_t capacity() const;
+
+    /**
+     * Perform an exception-safe swap of the contents of *this with src.
+     */
+    void swap(SoAArrayList<Fields...>& src) noexcept;
+
+private:
+    typedef std::tuple<ScopedArray<Fields>...> Columns;
+
+    static void allocate(Columns& columns, uint32_t capacity);
+    static void swapColumns(Columns& lhs, Columns& rhs) noexcept;
+
+    /**
+     * One buffer per field, all of capacity mCapacity.
+     */
+    Columns mColumns;
+
+    /**
+     * The logical size of this list.
+     */
+    uint32_t mSize;
+
+    /**
+     * The maximum capacity of each column.
+     */
+    uint32_t mCapacity;
+};
+
+#include "../src/SoAArrayList.cpp"
+
+#endif // SOA_ARRAYLIST_H
@@ -0,0 +1,214 @@
+// Author: Mac-Noble Brako-Kusi
+// File: SparseArrayList.h
+// Date: October 19, 2026
+// Purpose: Declaration file for SparseArrayList template class
+
+#ifndef SPARSE_ARRAYLIST_H
+#define SPARSE_ARRAYLIST_H
+
+#include "ArrayList.h"
+#include "ContainerError.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * A list with ArrayList's indexed interface for tables where only a few indexes are ever written,
+ * such as tables indexed by ID. Indexes are grouped in pages of kPageSize, found through a
+ * two-level page table, and a page is allocated the first time one of its indexes is written.
+ * Indexes never written read as T(), so writing index 1,000,000,000 into an empty list allocates
+ * one page instead of a billion elements.
+ *
+ * An index is populated once written by add() or set(). Each page holds a bitmap of its
+ * populated slots and their elements packed in slot order, so a page costs about one bit per
+ * slot plus its populated elements, even when IDs are scattered evenly. A read finds the element
+ * by counting the populated slots before it: a prefix count per bitmap word plus one popcount.
+ * forEach() visits only populated indexes, skipping unallocated pages whole. reset() unpopulates
+ * an index, freeing its page when the page empties. Elements can only be modified through set(),
+ * so the list always knows which indexes are populated; a reference returned by get() is
+ * invalidated by any write to its page.
+ *
+ * Appending and writing past the end are constant time; populating a slot before others of its
+ * page shifts the page's elements after it. Inserting or removing before the end shifts only the
+ * populated indexes after it. Once most indexes are populated, toArrayList() converts the list
+ * to a dense ArrayList; density() tells when that pays off.
+ */
+template<typename T> class SparseArrayList {
+public:
+    /**
+     * The number of elements in a page. Pages are allocated and freed whole.
+     */
+    static constexpr uint32_t kPageSize = 1024;
+
+    /**
+     * Creates an empty SparseArrayList.
+     */
+    SparseArrayList();
+
+    /**
+     * Creates a SparseArrayList holding the elements of a dense list, every index populated.
+     * @param dense the elements
+     */
+    explicit SparseArrayList(const ArrayList<T>& dense);
+
+    SparseArrayList(const SparseArrayList<T>& src);
+    SparseArrayList(SparseArrayList<T>&& src) noexcept;
+    SparseArrayList<T>& operator=(const SparseArrayList<T>& src);
+    SparseArrayList<T>& operator=(SparseArrayList<T>&& src) noexcept;
+
+    /**
+     * Adds the provided element to the end of this list.
+     * @param value value to add
+     */
+    void add(const T& value);
+
+    /**
+     * Inserts the specified value at the specified index, shifting the populated indexes from
+     * index on up by one. An index past the end extends the list, leaving the indexes in between
+     * unpopulated. If the list would exceed UINT32_MAX elements, std::length_error is thrown.
+     * @param index location at which to insert the new element
+     * @param value the element to insert
+     */
+    void add(uint32_t index, const T& value);
+
+    /**
+     * Returns the element at the specified index, T() if it is not populated. If the index is out
+     * of bounds, std::out_of_range is thrown with the index as its message.
+     * @param index the desired location
+     * @return a const T & to the desired element.
+     */
+    const T& get(uint32_t index) const;
+
+    /**
+     * Returns the element at the specified index, T() if it is not populated. No range checking
+     * is performed.
+     * @param index the desired location
+     * @return a const T & to the desired element.
+     */
+    const T& operator[](uint32_t index) const;
+
+    /**
+     * Replaces the element at the specified location, populating it. If the index is out of
+     * range, std::out_of_range is thrown with the index as its message.
+     * @param index the location to change
+     * @param value the new element
+     */
+    void set(uint32_t index, const T& value);
+
+    /**
+     * Removes the element at the specified location, shifting the populated indexes after it down
+     * by one. If the index is out of range, std::out_of_range is thrown with the index as its
+     * message.
+     * @param index the location to remove
+     * @return a copy of the removed element.
+     */
+    T remove(uint32_t index);
+
+    /**
+     * Returns an index to T() and unpopulates it, without changing the size. If the index is out
+     * of range, std::out_of_range is thrown with the index as its message.
+     * @param index the location to reset
+     */
+    void reset(uint32_t index);
+
+    /**
+     * Checks whether an index is populated.
+     * @param index the location to check
+     * @return true if index was written and not reset since.
+     */
+    [[nodiscard]] bool contains(uint32_t index) const;
+
+    /**
+     * Calls visit(index, value) for every populated index, in ascending order.
+     * @param visit the function to call
+     */
+    template<typename Visit> void forEach(Visit visit) const {forEachFrom(0, visit);}
+
+    /**
+     * Returns the elements as a dense ArrayList, T() at every unpopulated index.
+     * @return the dense list
+     */
+    [[nodiscard]] ArrayList<T> toArrayList() const;
+
+    /**
+     * Returns the number of elements, populated or not.
+     * @return the size
+     */
+    [[nodiscard]] uint32_t size() const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Returns the number of populated indexes.
+     * @return the populated count
+     */
+    [[nodiscard]] uint32_t populated() const;
+
+    /**
+     * Returns the fraction of indexes populated.
+     * @return populated() / size(), or 0 for an empty list
+     */
+    [[nodiscard]] double density() const;
+
+    /**
+     * Clears this list, freeing every page.
+     */
+    void clear();
+
+    /**
+     * Returns the bytes this list has allocated: the page table and the pages.
+     * @return the memory footprint in bytes
+     */
+    [[nodiscard]] size_t memoryFootprint() const;
+
+private:
+    static constexpr uint32_t kPageBits = 10;
+    static constexpr uint32_t kDirectoryBits = 10;
+    static constexpr uint32_t kDirectorySize = 1U << kDirectoryBits;
+    static constexpr uint32_t kWordsPerPage = kPageSize / 64;
+
+    /**
+     * A page's populated slots and their elements. rank[w] counts the populated slots of the
+     * words before word w, and the element of a populated slot is values[rank of the slot].
+     */
+    struct Page {
+        Page() : present(), rank(), values() {}
+
+        uint64_t present[kWordsPerPage];
+        uint16_t rank[kWordsPerPage];
+        ArrayList<T> values;
+    };
+
+    /**
+     * The second level of the page table: kDirectorySize pages, and how many are allocated.
+     */
+    struct Directory {
+        Directory() : pages(), count(0) {}
+
+        std::unique_ptr<Page> pages[kDirectorySize];
+        uint32_t count;
+    };
+
+    const Page* findPage(uint32_t index) const;
+    static uint32_t rankOf(const Page& page, uint32_t slot);
+    Page& pageFor(uint32_t index);
+    void write(uint32_t index, const T& value);
+    void unpopulate(uint32_t index);
+    std::vector<uint32_t> populatedFrom(uint32_t first) const;
+    template<typename Visit> void forEachFrom(uint32_t first, Visit& visit) const;
+    static const T& defaultValue();
+
+    /**
+     * The first level of the page table, indexed by the top bits of an index.
+     */
+    std::vector<std::unique_ptr<Directory>> mDirectories;
+    uint32_t mSize;
+    uint32_t mPopulated;
+    uint32_t mPages;
+};
+
+#include "../src/SparseArrayList.cpp"
+
+#endif // SPARSE_ARRAYLIST_H
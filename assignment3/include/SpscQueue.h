@@ -0,0 +1,104 @@
+// Author: Mac-Noble Brako-Kusi
+// File: SpscQueue.h
+// Date: October 19, 2026
+// Purpose: Declaration file for SpscQueue template class
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include "ContainerError.h"
+#include "ScopedArray.h"
+#include <atomic>
+#include <cstdint>
+
+/**
+ * A bounded, lock-free FIFO queue for exactly one producer thread and one consumer thread, such
+ * as two stages of a pipeline. The elements live in a ring of ScopedArray storage whose capacity
+ * is a power of two. The producer owns the tail index and the consumer the head index, each on a
+ * cache line of its own; each side also keeps a cached copy of the other's index and reads the
+ * shared one only when the cached copy says the ring is full (or empty), so in steady state a push
+ * or pop touches no cache line the other thread writes, other than the slot itself.
+ *
+ * Pushing and popping never block: they fail when the queue is full or empty. Wrap the queue in a
+ * BlockingQueue to wait instead. The element type must be default constructible and movable.
+ * Being aligned to a cache line, the queue also keeps its neighbours off the consumer's line.
+ */
+template<typename T> class SpscQueue {
+public:
+    using value_type = T;
+
+    /**
+     * Creates an empty queue holding at least the provided number of elements. If capacity is 0
+     * or greater than 2^31, std::invalid_argument is thrown.
+     * @param capacity the least number of elements the queue can hold
+     */
+    explicit SpscQueue(uint32_t capacity);
+
+    SpscQueue(const SpscQueue<T>&) = delete;
+    SpscQueue<T>& operator=(const SpscQueue<T>&) = delete;
+
+    /**
+     * Appends an element, unless the queue is full. Producer only.
+     * @param value the element to append
+     * @return true if the element was appended
+     */
+    bool tryPush(const T& value);
+    bool tryPush(T&& value);
+
+    /**
+     * Appends as many of the provided elements as fit, in order, publishing them together.
+     * Producer only.
+     * @param values the elements to append
+     * @param count the number of elements
+     * @return the number of elements appended, from the start of values
+     */
+    uint32_t tryPushBatch(const T* values, uint32_t count);
+
+    /**
+     * Removes the oldest element, unless the queue is empty. Consumer only.
+     * @param out receives the element
+     * @return true if an element was removed
+     */
+    bool tryPop(T& out);
+
+    /**
+     * Removes up to the provided number of the oldest elements, in order. Consumer only.
+     * @param out receives the elements
+     * @param max the most elements to remove
+     * @return the number of elements removed
+     */
+    uint32_t tryPopBatch(T* out, uint32_t max);
+
+    /**
+     * Returns the number of elements in the queue. Exact only while neither side is running.
+     * @return the number of elements
+     */
+    [[nodiscard]] uint32_t size() const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Returns the number of elements the queue can hold.
+     * @return the capacity, a power of two
+     */
+    [[nodiscard]] uint32_t capacity() const;
+
+private:
+    template<typename Value> bool push(Value&& value);
+    static uint32_t roundCapacity(uint32_t capacity);
+
+    ScopedArray<T> mSlots;
+    uint64_t mMask;
+
+    // The producer's line: the next index to write, and what it last saw of mHead
+    alignas(64) std::atomic<uint64_t> mTail;
+    uint64_t mCachedHead;
+
+    // The consumer's line: the next index to read, and what it last saw of mTail
+    alignas(64) std::atomic<uint64_t> mHead;
+    uint64_t mCachedTail;
+};
+
+#include "../src/SpscQueue.cpp"
+
+#endif // SPSC_QUEUE_H
@@ -0,0 +1,256 @@
+// Author: Mac-Noble Brako-Kusi
+// File: StaticArrayList.h
+// Date: October 19, 2026
+// Purpose: Declaration file for StaticArrayList template class
+
+#ifndef STATIC_ARRAYLIST_H
+#define STATIC_ARRAYLIST_H
+
+#include "ArrayList.h"
+#include "ContainerError.h"
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+/**
+ * A list with the ArrayList interface whose elements live inside the object, in an array of N
+ * elements, so that it never touches the heap. The capacity is fixed: an add() that would need
+ * more than N elements throws std::length_error (or aborts when exceptions are disabled) and
+ * leaves the list unchanged, and tryAdd() reports the same condition by returning false.
+ * get(), set() and remove() follow the ARRAYLIST_BOUNDS_CHECK policy, like ArrayList.
+ *
+ * Every member function is constexpr, so for literal element types a list can be filled at
+ * compile time and stored in read-only memory:
+ *
+ *     constexpr StaticArrayList<uint32_t, 256> kTable = makeTable();
+ *
+ * Hitting an error inside a constant expression makes it a compile-time error. The N elements
+ * are value-initialized when the list is created, which is what lets the list be a literal type
+ * in C++17; T must be default constructible, as for ArrayList. Copies and moves copy or move the
+ * elements, and are trivial whenever T's are.
+ */
+template<typename T, uint32_t N> class StaticArrayList {
+public:
+    static_assert(N > 0, "StaticArrayList needs a capacity of at least 1");
+
+    /**
+     * Iterators are plain pointers into the inline storage.
+     */
+    typedef T* iterator;
+    typedef const T* const_iterator;
+
+    /**
+     * Creates a StaticArrayList of size 0.
+     */
+    constexpr StaticArrayList();
+
+    /**
+     * Creates a StaticArrayList of the provided size filled with the provided value. If size is
+     * greater than N, std::length_error is thrown.
+     * @param size size of the list to create
+     * @param value value used to fill the list
+     */
+    constexpr explicit StaticArrayList(const uint32_t& size, const T& value = T());
+
+    /**
+     * Adds the provided element to the end of this list. If the list is full,
+     * std::length_error is thrown.
+     * @param value value to add
+     * @return the capacity, N
+     */
+    constexpr const uint32_t& add(const T& value);
+
+    /**
+     * Inserts the specified value at the specified index with the semantics of
+     * ArrayList::add(index, value): an index past the end fills the gap with default values. If
+     * the list would need more than N elements, std::length_error is thrown.
+     * @param index location at which to insert the new element
+     * @param value the element to insert
+     * @return the capacity, N
+     */
+    constexpr const uint32_t& add(const uint32_t& index, const T& value);
+
+    /**
+     * Adds the provided element to the end of this list if there is room.
+     * @param value value to add
+     * @return true if the element was added, false if the list is full
+     */
+    constexpr bool tryAdd(const T& value);
+
+    /**
+     * Clears this list, leaving it empty. Elements that are not trivially destructible are reset
+     * to T(), releasing what they own.
+     */
+    constexpr void clear();
+
+    /**
+     * Returns a const T & to the element stored at the specified index. If the index is out of
+     * bounds, std::out_of_range is thrown with the index as its message, unless
+     * ARRAYLIST_BOUNDS_CHECK selects another policy.
+     * @param index the desired location
+     * @return a const T & to the desired element.
+     */
+    constexpr const T& get(const uint32_t& index) const;
+
+    /**
+     * Returns a T & to the element stored at the specified index. If the index is out of bounds,
+     * std::out_of_range is thrown with the index as its message, unless ARRAYLIST_BOUNDS_CHECK
+     * selects another policy.
+     * @param index the desired location
+     * @return a T & to the desired element.
+     */
+    constexpr T& get(const uint32_t& index);
+
+    /**
+     * Returns a pointer to the element stored at the specified index, or nullptr if the index is
+     * out of bounds.
+     * @param index the desired location
+     * @return a pointer to the desired element, or nullptr.
+     */
+    constexpr T* tryGet(const uint32_t& index) noexcept;
+
+    /**
+     * Returns a const pointer to the element stored at the specified index, or nullptr if the
+     * index is out of bounds.
+     * @param index the desired location
+     * @return a const pointer to the desired element, or nullptr.
+     */
+    constexpr const T* tryGet(const uint32_t& index) const noexcept;
+
+    /**
+     * Returns a T & to the element stored at the specified index.
+     * No range checking is performed.
+     * @param index the desired location
+     * @return a T & to the desired element.
+     */
+    constexpr T& operator[](const uint32_t& index);
+
+    /**
+     * Returns a const T & to the element stored at the specified index.
+     * No range checking is performed.
+     * @param index the desired location
+     * @return a const T & to the desired element.
+     */
+    constexpr const T& operator[](const uint32_t& index) const;
+
+    /**
+     * Returns a pointer to the inline storage.
+     * @return a pointer to the first element.
+     */
+    constexpr T* data();
+
+    /**
+     * Returns a pointer to the inline storage.
+     * @return a const pointer to the first element.
+     */
+    constexpr const T* data() const;
+
+    /**
+     * Returns an iterator to the first element.
+     * @return an iterator to the beginning of this list
+     */
+    constexpr iterator begin();
+
+    /**
+     * Returns a const iterator to the first element.
+     * @return a const iterator to the beginning of this list
+     */
+    constexpr const_iterator begin() const;
+
+    /**
+     * Returns the past-the-end iterator.
+     * @return a past-the-end iterator of this list
+     */
+    constexpr iterator end();
+
+    /**
+     * Returns the past-the-end const iterator.
+     * @return a past-the-end const iterator of this list
+     */
+    constexpr const_iterator end() const;
+
+    /**
+     * Empty check.
+     * @return True if this list is empty and false otherwise.
+     */
+    [[nodiscard]] constexpr bool isEmpty() const;
+
+    /**
+     * Full check.
+     * @return True if this list holds N elements and false otherwise.
+     */
+    [[nodiscard]] constexpr bool isFull() const;
+
+    /**
+     * Removes an element at the specified location and returns it. Elements following index
+     * are shifted down. If index is out of range, std::out_of_range is thrown with index as its
+     * message, unless ARRAYLIST_BOUNDS_CHECK selects another policy.
+     * @param index the desired location
+     * @return a copy of the removed element.
+     */
+    constexpr T remove(const uint32_t& index);
+
+    /**
+     * Removes the element at the specified location if index is in range.
+     * @param index the desired location
+     * @return true if an element was removed, false if index is out of range.
+     */
+    constexpr bool tryRemove(const uint32_t& index);
+
+    /**
+     * Sets the element at the desired location to the specified value. If index is out of
+     * range, std::out_of_range is thrown with index as its message, unless
+     * ARRAYLIST_BOUNDS_CHECK selects another policy.
+     * @param index the location to change
+     * @param value the new value of the specified element.
+     */
+    constexpr void set(const uint32_t& index, const T& value);
+
+    /**
+     * Sets the element at the desired location to the specified value if index is in range.
+     * @param index the location to change
+     * @param value the new value of the specified element.
+     * @return true if the element was set, false if index is out of range.
+     */
+    constexpr bool trySet(const uint32_t& index, const T& value);
+
+    /**
+     * Returns the size of this list.
+     * @return the size of this list.
+     */
+    [[nodiscard]] constexpr uint32_t size() const;
+
+    /**
+     * Returns the fixed capacity.
+     * @return N
+     */
+    [[nodiscard]] static constexpr uint32_t capacity();
+
+    /**
+     * Swaps the contents of *this with src, element by element.
+     */
+    constexpr void swap(StaticArrayList<T, N>& src);
+
+private:
+    constexpr void checkIndex(uint32_t index) const;
+    constexpr void erase(uint32_t index);
+
+    /**
+     * The capacity, returned by reference from add() like ArrayList's.
+     */
+    static constexpr uint32_t kCapacity = N;
+
+    /**
+     * The inline storage.
+     */
+    T mData[N];
+
+    /**
+     * The logical size of this list.
+     */
+    uint32_t mSize;
+};
+
+#include "../src/StaticArrayList.cpp"
+
+#endif // STATIC_ARRAYLIST_H
@@ -0,0 +1,178 @@
+// Author: Mac-Noble Brako-Kusi
+// File: StringList.h
+// Date: October 19, 2026
+// Purpose: Declaration file for StringList class
+
+#ifndef STRING_LIST_H
+#define STRING_LIST_H
+
+#include "ArrayList.h"
+#include "ScopedArray.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * A list of strings whose characters all live in one byte arena. Each element is a span of the
+ * arena, an offset and a length, so adding a string is a copy of its bytes with no allocation of
+ * its own, and growing or copying the list copies the spans and the bytes as two flat buffers
+ * instead of one std::string at a time. Elements are read as std::string_view.
+ *
+ * Removing or shrinking an element leaves its bytes in the arena as dead bytes; compact() copies
+ * the live bytes, in element order, into an arena of the exact size. A view returned by the list
+ * is invalidated by anything that moves the arena: an add that grows it, set() with a longer
+ * string, reserve(), compact() and clear().
+ */
+class StringList {
+public:
+    /**
+     * Creates an empty StringList.
+     */
+    StringList();
+
+    /**
+     * Creates a StringList holding the strings of the provided list.
+     * @param values the strings, in order
+     */
+    explicit StringList(const ArrayList<std::string>& values);
+
+    /**
+     * Creates a compacted copy of another StringList.
+     * @param src the list to copy
+     */
+    StringList(const StringList& src);
+    StringList(StringList&& src) noexcept;
+    StringList& operator=(const StringList& src);
+    StringList& operator=(StringList&& src) noexcept;
+
+    /**
+     * Adds a string to the end of the list. If the arena would exceed 4 GiB or the list
+     * UINT32_MAX elements, std::length_error is thrown.
+     * @param value the string to add
+     */
+    void add(std::string_view value);
+
+    /**
+     * Adds every string of another StringList, growing the arena at most once and copying the
+     * other arena's bytes in one piece.
+     * @param values the strings to add
+     */
+    void addAll(const StringList& values);
+
+    /**
+     * Adds every string of an ArrayList, growing the arena at most once.
+     * @param values the strings to add
+     */
+    void addAll(const ArrayList<std::string>& values);
+
+    /**
+     * Returns the string at the specified index. If the index is out of bounds,
+     * std::out_of_range is thrown with the index as its message.
+     * @param index the desired location
+     * @return a view of the string
+     */
+    std::string_view get(uint32_t index) const;
+
+    /**
+     * Returns the string at the specified index. No range checking is performed.
+     * @param index the desired location
+     * @return a view of the string
+     */
+    std::string_view operator[](uint32_t index) const;
+
+    /**
+     * Replaces the string at the specified location, in place when the new string is no longer
+     * than the old one. If the index is out of range, std::out_of_range is thrown with the index
+     * as its message.
+     * @param index the location to change
+     * @param value the new string
+     */
+    void set(uint32_t index, std::string_view value);
+
+    /**
+     * Removes the string at the specified location, shifting later elements down; its bytes
+     * become dead bytes. If the index is out of range, std::out_of_range is thrown with the
+     * index as its message.
+     * @param index the location to remove
+     */
+    void remove(uint32_t index);
+
+    /**
+     * Makes room in the arena, so that adding strings of that many bytes in total does not
+     * grow it. If bytes exceeds 4 GiB, std::length_error is thrown.
+     * @param bytes the number of arena bytes to make room for, counting the used ones
+     */
+    void reserve(uint64_t bytes);
+
+    /**
+     * Rewrites the arena to hold only the live bytes, in element order, and frees the rest.
+     */
+    void compact();
+
+    /**
+     * Returns the strings as an ArrayList.
+     * @return the list of std::string
+     */
+    [[nodiscard]] ArrayList<std::string> toArrayList() const;
+
+    /**
+     * Returns the number of elements.
+     * @return the size
+     */
+    [[nodiscard]] uint32_t size() const;
+
+    [[nodiscard]] bool isEmpty() const;
+
+    /**
+     * Returns the number of bytes of the elements.
+     * @return the live bytes
+     */
+    [[nodiscard]] uint64_t byteSize() const;
+
+    /**
+     * Returns the number of arena bytes no element uses, which compact() would free.
+     * @return the dead bytes
+     */
+    [[nodiscard]] uint64_t deadBytes() const;
+
+    /**
+     * Clears this list, freeing the spans and the arena.
+     */
+    void clear();
+
+    /**
+     * Returns the bytes this list has allocated: the spans and the whole arena.
+     * @return the memory footprint in bytes
+     */
+    [[nodiscard]] size_t memoryFootprint() const;
+
+private:
+    /**
+     * Where an element lives in the arena.
+     */
+    struct Span {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    char* append(uint64_t bytes);
+    void reallocate(uint64_t capacity);
+    uint64_t pack(const char* from, char* to, uint64_t used, uint64_t dead);
+
+    ArrayList<Span> mSpans;
+    ScopedArray<char> mBytes;
+
+    /**
+     * The bytes allocated, and the bytes used from the start of the arena.
+     */
+    uint64_t mCapacity;
+    uint64_t mUsed;
+
+    /**
+     * The used bytes no span covers.
+     */
+    uint64_t mDead;
+};
+
+#endif // STRING_LIST_H
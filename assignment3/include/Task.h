@@ -0,0 +1,264 @@
+// Author: Mac-Noble Brako-Kusi
+// File: Task.h
+// Date: October 19, 2026
+// Purpose: Coroutine task producing one result, and syncWait() to block on one; needs C++20
+
+#ifndef TASK_H
+#define TASK_H
+
+#if __cplusplus < 202002L
+#error "Task.h needs C++20 coroutines: build the target with cxx_std_20"
+#endif
+
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+/**
+ * An asynchronous computation producing one T, written as a coroutine that co_returns it. A Task
+ * is lazy: the body starts when the Task is first awaited, or earlier if start() is called, and
+ * runs on the calling thread until it suspends, typically by moving to a ThreadPool with
+ * co_await pool.schedule(). Starting several tasks before awaiting any of them runs them
+ * concurrently:
+ *
+ *     Task<int> square(ThreadPool& pool, int x) {
+ *         co_await pool.schedule();
+ *         co_return x * x;
+ *     }
+ *
+ *     Task<int> sum(ThreadPool& pool) {
+ *         Task<int> a = square(pool, 3);
+ *         Task<int> b = square(pool, 4);
+ *         a.start();
+ *         b.start();
+ *         co_return co_await a + co_await b;
+ *     }
+ *
+ * Awaiting a Task yields its result, moved out, or rethrows what its body threw; await it once.
+ * The awaiting coroutine resumes on whichever thread finishes the body. A started Task must have
+ * finished before it is destroyed, so await every Task that was started, even after a failure.
+ * T may not be void or a reference.
+ */
+template<typename T> class Task {
+    static_assert(!std::is_void_v<T> && !std::is_reference_v<T>, "Task produces a value");
+
+public:
+    class promise_type;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    /**
+     * The promise of a Task coroutine, used by the compiler.
+     */
+    class promise_type {
+    public:
+        Task get_return_object() {return Task(Handle::from_promise(*this));}
+        std::suspend_always initial_suspend() noexcept {return {};}
+        void unhandled_exception() noexcept {mError = std::current_exception();}
+
+        template<typename U> void return_value(U&& value) {mResult.emplace(std::forward<U>(value));}
+
+        /**
+         * Hands control to the coroutine awaiting the Task, if one is waiting already; otherwise
+         * marks the Task finished, so that whoever awaits it later does not suspend.
+         */
+        struct FinalAwaiter {
+            bool await_ready() const noexcept {return false;}
+            void await_resume() const noexcept {}
+
+            std::coroutine_handle<> await_suspend(Handle handle) const noexcept {
+                promise_type& promise = handle.promise();
+                void* waiting = promise.mWaiting.exchange(promise.finished(),
+                                                          std::memory_order_acq_rel);
+                if (waiting)
+                    return std::coroutine_handle<>::from_address(waiting);
+                return std::noop_coroutine();
+            }
+        };
+
+        FinalAwaiter final_suspend() noexcept {return {};}
+
+    private:
+        friend class Task;
+
+        // Never the address of another coroutine frame, since it lies inside this one
+        void* finished() noexcept {return this;}
+
+        std::optional<T> mResult;
+        std::exception_ptr mError;
+
+        // The awaiting coroutine's frame, nullptr before anyone awaits, finished() once done
+        std::atomic<void*> mWaiting{nullptr};
+    };
+
+    /**
+     * Suspends the awaiting coroutine until the Task has finished, starting it if need be.
+     */
+    class ReadyAwaiter {
+    public:
+        explicit ReadyAwaiter(Task& task) noexcept : mTask(task) {}
+
+        bool await_ready() {
+            mTask.start();
+            return mTask.isReady();
+        }
+
+        bool await_suspend(std::coroutine_handle<> waiting) noexcept {
+            void* expected = nullptr;
+            return mTask.mHandle.promise().mWaiting.compare_exchange_strong(
+                expected, waiting.address(), std::memory_order_acq_rel);
+        }
+
+        void await_resume() const noexcept {}
+
+    protected:
+        Task& mTask;
+    };
+
+    /**
+     * Suspends the awaiting coroutine until the Task has finished, then yields its result.
+     */
+    class ResultAwaiter : public ReadyAwaiter {
+    public:
+        using ReadyAwaiter::ReadyAwaiter;
+
+        T await_resume() {return this->mTask.result();}
+    };
+
+    Task(Task&& src) noexcept
+        : mHandle(std::exchange(src.mHandle, nullptr)),
+          mStarted(std::exchange(src.mStarted, false)) {}
+
+    Task& operator=(Task&& src) noexcept {
+        if (this != &src) {
+            release();
+            mHandle = std::exchange(src.mHandle, nullptr);
+            mStarted = std::exchange(src.mStarted, false);
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {release();}
+
+    /**
+     * Starts the body, unless it has started already. It runs on the calling thread until it
+     * first suspends or finishes.
+     */
+    void start() {
+        if (!mStarted) {
+            mStarted = true;
+            mHandle.resume();
+        }
+    }
+
+    /**
+     * Checks whether the body has finished, by returning or by throwing.
+     * @return true if the result is available
+     */
+    [[nodiscard]] bool isReady() const noexcept {
+        promise_type& promise = mHandle.promise();
+        return promise.mWaiting.load(std::memory_order_acquire) == promise.finished();
+    }
+
+    /**
+     * Returns an awaitable that waits for the Task to finish without taking its result, which
+     * can then be taken with result().
+     * @return the awaitable
+     */
+    ReadyAwaiter whenReady() noexcept {return ReadyAwaiter(*this);}
+
+    ResultAwaiter operator co_await() noexcept {return ResultAwaiter(*this);}
+
+    /**
+     * Moves the result out of a finished Task.
+     * @return the value the body returned
+     * @throws whatever the body threw
+     */
+    T result() {
+        assert(isReady() && "Task::result() called before the task finished");
+        promise_type& promise = mHandle.promise();
+        if (promise.mError)
+            std::rethrow_exception(promise.mError);
+        return std::move(*promise.mResult);
+    }
+
+private:
+    explicit Task(Handle handle) noexcept : mHandle(handle), mStarted(false) {}
+
+    void release() noexcept {
+        if (mHandle) {
+            assert((!mStarted || isReady()) && "a started Task was destroyed while running");
+            mHandle.destroy();
+        }
+    }
+
+    Handle mHandle;
+    bool mStarted;
+};
+
+namespace task_detail {
+/**
+ * A one-shot event a thread can wait for.
+ */
+class Signal {
+public:
+    void set() {
+        // Notified under the lock: once the waiter sees mSet, it may destroy the Signal
+        std::lock_guard<std::mutex> lock(mMutex);
+        mSet = true;
+        mChanged.notify_all();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mChanged.wait(lock, [this]() {return mSet;});
+    }
+
+private:
+    std::mutex mMutex;
+    std::condition_variable mChanged;
+    bool mSet = false;
+};
+
+/**
+ * A coroutine nobody awaits, which runs at once and frees itself when it returns.
+ */
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() noexcept {return {};}
+        std::suspend_never initial_suspend() noexcept {return {};}
+        std::suspend_never final_suspend() noexcept {return {};}
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept {std::terminate();}
+    };
+};
+
+template<typename T> Detached signalWhenReady(Task<T>& task, Signal& signal) {
+    co_await task.whenReady();
+    signal.set();
+}
+} // Namespace
+
+/**
+ * Runs a Task to completion, blocking the calling thread, which is how ordinary code calls into
+ * coroutines.
+ * @param task the task, which must not have been awaited yet
+ * @return the task's result
+ * @throws whatever the task's body threw
+ */
+template<typename T> T syncWait(Task<T>&& task) {
+    task_detail::Signal signal;
+    task_detail::signalWhenReady(task, signal);
+    signal.wait();
+    return task.result();
+}
+
+#endif // TASK_H
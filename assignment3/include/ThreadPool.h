@@ -0,0 +1,102 @@
+// Author: Mac-Noble Brako-Kusi
+// File: ThreadPool.h
+// Date: October 19, 2026
+// Purpose: Fixed set of threads that coroutines move onto with co_await schedule(); needs C++20
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#if __cplusplus < 202002L
+#error "ThreadPool.h needs C++20 coroutines: build the target with cxx_std_20"
+#endif
+
+#include "BlockingQueue.h"
+#include "ContainerError.h"
+#include "MpmcQueue.h"
+#include "ParallelFor.h"
+#include <coroutine>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+/**
+ * A fixed set of threads running suspended coroutines. A coroutine moves onto the pool with
+ * co_await pool.schedule(): it is queued, and the first idle thread resumes it. The queue is a
+ * BlockingQueue of the given capacity, so scheduling waits while that many coroutines are already
+ * queued; size it for the most coroutines that may be waiting at once.
+ *
+ * Destroying the pool lets the threads finish what is queued, then joins them. Every coroutine
+ * scheduled on the pool must have finished or moved elsewhere by then; one scheduled after the
+ * destruction has begun runs on the scheduling thread instead.
+ */
+class ThreadPool {
+public:
+    /**
+     * The awaitable returned by schedule().
+     */
+    class ScheduleAwaiter {
+    public:
+        explicit ScheduleAwaiter(ThreadPool& pool) noexcept : mPool(pool) {}
+
+        bool await_ready() const noexcept {return false;}
+        bool await_suspend(std::coroutine_handle<> waiting) {return mPool.mQueue.push(waiting);}
+        void await_resume() const noexcept {}
+
+    private:
+        ThreadPool& mPool;
+    };
+
+    /**
+     * Starts the threads. If one cannot be started, those already started are joined and the
+     * std::system_error is rethrown.
+     * @param threads the number of threads, or 0 for one per hardware thread
+     * @param capacity the most coroutines that can be queued at once
+     */
+    explicit ThreadPool(uint32_t threads = 0, uint32_t capacity = 64) : mQueue(capacity) {
+        threads = threadsFor(threads);
+        mThreads.reserve(threads);
+        CONTAINER_TRY {
+            for (uint32_t t = 0; t < threads; ++t)
+                mThreads.emplace_back([this]() {run();});
+        } CONTAINER_CATCH_ALL {
+            stop();
+            CONTAINER_RETHROW;
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {stop();}
+
+    /**
+     * Returns an awaitable that resumes the awaiting coroutine on one of the pool's threads.
+     * @return the awaitable
+     */
+    ScheduleAwaiter schedule() noexcept {return ScheduleAwaiter(*this);}
+
+    /**
+     * Returns the number of threads.
+     * @return the number of threads
+     */
+    [[nodiscard]] uint32_t size() const {return static_cast<uint32_t>(mThreads.size());}
+
+private:
+    void run() {
+        std::coroutine_handle<> coroutine;
+        while (mQueue.pop(coroutine))
+            coroutine.resume();
+    }
+
+    void stop() {
+        mQueue.close();
+        for (std::thread& thread : mThreads)
+            thread.join();
+        mThreads.clear();
+    }
+
+    BlockingQueue<MpmcQueue<std::coroutine_handle<>>> mQueue;
+    std::vector<std::thread> mThreads;
+};
+
+#endif // THREAD_POOL_H
@@ -13,7 +13,21 @@ template<typename T>
 ArrayList<T>::ArrayList()
     : mArray(nullptr),
       mSize(0),
-      mCapacity(0){}
+      mCapacity(0),
+      mResource(nullptr){}
+
+/**
+ * Constructor: Creates an empty ArrayList that allocates its buffers from a memory resource.
+ * @param resource The memory resource to allocate buffers from.
+ * @modifies Initializes an empty ArrayList bound to 'resource'.
+ * @return N/A
+ */
+template<typename T>
+ArrayList<T>::ArrayList(std::pmr::memory_resource &resource)
+    : mArray(nullptr),
+      mSize(0),
+      mCapacity(0),
+      mResource(&resource){}
 
 /**
  * Constructor: Creates an ArrayList with a specified size and initializes elements with a given value.
@@ -24,10 +38,28 @@ ArrayList<T>::ArrayList()
  */
 template<typename T>
 ArrayList<T>::ArrayList(const uint32_t &size, const T &value)
-        : mArray(new T[size]),
+        : mArray(size, nullptr),
           mSize(size),
-          mCapacity(size)
-        {std::fill(mArray.get(), mArray.get() + mSize, value);}
+          mCapacity(size),
+          mResource(nullptr) {
+    std::fill(mArray.get(), mArray.get() + mSize, value);
+    ARRAYLIST_COUNT_CAPACITY();
+}
+
+/**
+ * Creates an ArrayList whose elements are left default-initialized, for the caller to overwrite.
+ * @param size The size of the ArrayList.
+ * @modifies N/A
+ * @return An ArrayList of 'size' default-initialized elements.
+ */
+template<typename T>
+ArrayList<T> ArrayList<T>::forOverwrite(uint32_t size) {
+    ArrayList<T> list;
+    ScopedArray<T> array(size, nullptr);
+    list.mArray.swap(array);
+    list.mSize = list.mCapacity = size;
+    return list;
+}
 
 /**
  * Copy Constructor: Creates a copy of an existing ArrayList.
@@ -37,10 +69,18 @@ ArrayList<T>::ArrayList(const uint32_t &size, const T &value)
  */
 template<typename T>
 ArrayList<T>::ArrayList(const ArrayList<T> &src)
-    : mArray(new T[src.mCapacity]),
+    : mArray(src.mCapacity, src.mResource),
       mSize(src.mSize),
-      mCapacity(src.mCapacity)
-    {std::copy(src.mArray.get(), src.mArray.get() + src.mSize, mArray.get());}
+      mCapacity(src.mCapacity),
+      mResource(src.mResource) {
+    CONTAINER_TRACE_SCOPE(arraylist_copy, src.mSize);
+    std::copy(src.mArray.get(), src.mArray.get() + src.mSize, mArray.get());
+    ARRAYLIST_COUNT(copies, 1);
+    ARRAYLIST_COUNT(reallocations, 1);
+    ARRAYLIST_COUNT(elementsCopied, mSize);
+    ARRAYLIST_COUNT(bytesTransferred, uint64_t(mSize) * sizeof(T));
+    ARRAYLIST_COUNT_CAPACITY();
+}
 
 /**
  * Move Constructor: Creates an ArrayList by moving the contents from another ArrayList.
@@ -50,21 +90,42 @@ ArrayList<T>::ArrayList(const ArrayList<T> &src)
  */
 template<typename T>
 ArrayList<T>::ArrayList(ArrayList<T> &&src) noexcept
-    : mArray(src.mArray.release()),
-      mSize(src.mSize),
-      mCapacity(src.mCapacity)
-    {src.mSize = src.mCapacity = 0;}
+    : ArrayList() {
+    CONTAINER_TRACE_SCOPE(arraylist_move, src.mSize);
+    swap(src);
+}
+
+#if ARRAYLIST_STATS
+/**
+ * Destructor: Adds the counters of this list to the totals of every list.
+ * @param N/A
+ * @modifies Updates ArrayListStats::totals().
+ * @return N/A
+ */
+template<typename T>
+ArrayList<T>::~ArrayList() {ArrayListStats::record(stats());}
+#endif
 
 /**
  * Copy Assignment Operator: Assigns the contents of another ArrayList to this ArrayList.
  * @param src The ArrayList to be copied.
- * @modifies Copies the contents of 'src' to this ArrayList.
+ * @modifies Copies the contents of 'src' into a new buffer from this list's own resource.
  * @return A reference to this ArrayList.
  */
 template<typename T>
 ArrayList<T> &ArrayList<T>::operator=(const ArrayList<T> &src) {
     if (this != &src) {
-        ArrayList<T>(src).swap(*this);
+        CONTAINER_TRACE_SCOPE(arraylist_copy, src.mSize);
+        ScopedArray<T> temp(src.mCapacity, mResource);
+        std::copy(src.mArray.get(), src.mArray.get() + src.mSize, temp.get());
+        mArray.swap(temp);
+        mSize = src.mSize;
+        mCapacity = src.mCapacity;
+        ARRAYLIST_COUNT(copies, 1);
+        ARRAYLIST_COUNT(reallocations, 1);
+        ARRAYLIST_COUNT(elementsCopied, mSize);
+        ARRAYLIST_COUNT(bytesTransferred, uint64_t(mSize) * sizeof(T));
+        ARRAYLIST_COUNT_CAPACITY();
     }
     return *this;
 }
@@ -72,15 +133,38 @@ ArrayList<T> &ArrayList<T>::operator=(const ArrayList<T> &src) {
 /**
  * Move Assignment Operator: Assigns the contents of another ArrayList to this ArrayList by moving.
  * @param src The ArrayList to be moved.
- * @modifies Moves the contents of 'src' to this ArrayList.
+ * @modifies Takes over the buffer of 'src' if both lists allocate from the same resource, and
+ *           otherwise moves the elements into a new buffer from this list's resource. Leaves
+ *           'src' empty.
  * @return A reference to this ArrayList.
  */
 template<typename T>
-ArrayList<T> &ArrayList<T>::operator=(ArrayList<T> &&src) noexcept {
-    if (this != &src) {
+ArrayList<T> &ArrayList<T>::operator=(ArrayList<T> &&src) {
+    if (this == &src)
+        return *this;
+
+    bool sameResource = mResource == src.mResource ||
+                        (mResource && src.mResource && mResource->is_equal(*src.mResource));
+    if (sameResource) {
         this->swap(src);
-        src.clear();
+    } else {
+        CONTAINER_TRACE_SCOPE(arraylist_move, src.mSize);
+        ScopedArray<T> temp(src.mCapacity, mResource);
+        if constexpr (std::is_nothrow_move_assignable_v<T>) {
+            std::move(src.mArray.get(), src.mArray.get() + src.mSize, temp.get());
+            ARRAYLIST_COUNT(elementsMoved, src.mSize);
+        } else {
+            std::copy(src.mArray.get(), src.mArray.get() + src.mSize, temp.get());
+            ARRAYLIST_COUNT(elementsCopied, src.mSize);
+        }
+        mArray.swap(temp);
+        mSize = src.mSize;
+        mCapacity = src.mCapacity;
+        ARRAYLIST_COUNT(reallocations, 1);
+        ARRAYLIST_COUNT(bytesTransferred, uint64_t(mSize) * sizeof(T));
+        ARRAYLIST_COUNT_CAPACITY();
     }
+    src.clear();
     return *this;
 }
 
@@ -97,29 +181,100 @@ const uint32_t &ArrayList<T>::add(const T &value) {return add(mSize, value);}
  * Inserts an element at a specific index in the ArrayList.
  * @param index The index at which to insert the element.
  * @param value The value to be inserted.
- * @modifies Inserts 'value' at 'index' in the ArrayList, shifting elements if necessary.
+ * @modifies Inserts 'value' at 'index' in the ArrayList, shifting elements if necessary. Appends
+ *           reuse spare capacity; any other insertion builds a new buffer and swaps it in.
+ * @throws std::length_error if the list would exceed UINT32_MAX elements.
  * @return A reference to the capacity of the ArrayList.
  */
 template<typename T>
 const uint32_t &ArrayList<T>::add(const uint32_t &index, const T &value) {
-    if(!check_range(index)) {
-        resize();
-        std::fill_n(mArray.get() + mSize, index - mSize, T());
+    if (index == mSize) {
+        if (mSize == UINT32_MAX)
+            throwLengthError("ArrayList cannot exceed UINT32_MAX elements");
+        ARRAYLIST_COUNT(appends, 1);
+        if (mSize == mCapacity) {
+            T copy(value); // 'value' may live in the buffer that resize() releases
+            resize();
+            mArray[mSize] = copy;
+        } else {
+            mArray[mSize] = value;
+        }
+        ++mSize;
+        return mCapacity;
     }
 
-    if(index < mSize && mSize == mCapacity) {
-        resize();
-        std::move_backward(mArray.get() + index, mArray.get() + mSize, mArray.get() + mSize + 1);
-    }
+    uint64_t newSize = uint64_t(std::max(index, mSize)) + 1;
+    if (newSize > UINT32_MAX)
+        throwLengthError("ArrayList cannot exceed UINT32_MAX elements");
 
-    ScopedArray<T> temp(new T[mCapacity]);
-    std::copy(mArray.get(), mArray.get() + index, temp.get());
+    ARRAYLIST_COUNT(inserts, 1);
+    CONTAINER_TRACE_SCOPE(arraylist_insert, mSize);
+    uint64_t newCapacity = std::max<uint64_t>(mCapacity, 1);
+    while (newCapacity < newSize)
+        newCapacity *= 2;
+    newCapacity = std::min<uint64_t>(newCapacity, UINT32_MAX);
+
+    uint32_t prefix = std::min(index, mSize);
+    ScopedArray<T> temp(newCapacity, mResource);
+    std::copy(mArray.get(), mArray.get() + prefix, temp.get());
+    std::fill(temp.get() + prefix, temp.get() + index, T());
     temp[index] = value;
-    std::copy(mArray.get() + index, mArray.get() + mSize, temp.get() + index + 1);
+    if (index < mSize)
+        std::copy(mArray.get() + index, mArray.get() + mSize, temp.get() + index + 1);
 
     mArray.swap(temp);
-    ++mSize;
+    ARRAYLIST_COUNT(reallocations, 1);
+    ARRAYLIST_COUNT(elementsCopied, mSize);
+    ARRAYLIST_COUNT(bytesTransferred, uint64_t(mSize) * sizeof(T));
+    mSize = static_cast<uint32_t>(newSize);
+    mCapacity = static_cast<uint32_t>(newCapacity);
+    ARRAYLIST_COUNT_CAPACITY();
+
+    return mCapacity;
+}
+
+/**
+ * Appends every element of another ArrayList.
+ * @param src The elements to append, which may be this ArrayList.
+ * @modifies Appends copies of the elements of 'src'. Spare capacity is reused; otherwise one
+ *           buffer large enough for both is built and swapped in.
+ * @throws std::length_error if the list would exceed UINT32_MAX elements.
+ * @return A reference to the capacity of the ArrayList.
+ */
+template<typename T>
+const uint32_t &ArrayList<T>::addAll(const ArrayList<T> &src) {
+    const uint32_t count = src.mSize;
+    uint64_t newSize = uint64_t(mSize) + count;
+    if (newSize > UINT32_MAX)
+        throwLengthError("ArrayList cannot exceed UINT32_MAX elements");
+    if (count == 0)
+        return mCapacity;
 
+    ARRAYLIST_COUNT(appends, count);
+    if (newSize <= mCapacity) {
+        // The slots past mSize are not part of the list, so a throwing copy leaves it unchanged
+        std::copy(src.mArray.get(), src.mArray.get() + count, mArray.get() + mSize);
+    } else {
+        CONTAINER_TRACE_SCOPE(arraylist_resize, mSize);
+        uint64_t newCapacity = std::min<uint64_t>(
+            std::max<uint64_t>(uint64_t(mCapacity) * 2, newSize), UINT32_MAX);
+        ScopedArray<T> temp(newCapacity, mResource);
+        // 'src' may be this list, so it is copied before anything is moved out of the buffer
+        std::copy(src.mArray.get(), src.mArray.get() + count, temp.get() + mSize);
+        if constexpr (std::is_nothrow_move_assignable_v<T>) {
+            std::move(mArray.get(), mArray.get() + mSize, temp.get());
+            ARRAYLIST_COUNT(elementsMoved, mSize);
+        } else {
+            std::copy(mArray.get(), mArray.get() + mSize, temp.get());
+            ARRAYLIST_COUNT(elementsCopied, mSize);
+        }
+        mArray.swap(temp);
+        mCapacity = static_cast<uint32_t>(newCapacity);
+        ARRAYLIST_COUNT(reallocations, 1);
+        ARRAYLIST_COUNT(bytesTransferred, uint64_t(mSize) * sizeof(T));
+    }
+    mSize = static_cast<uint32_t>(newSize);
+    ARRAYLIST_COUNT_CAPACITY();
     return mCapacity;
 }
 
@@ -131,11 +286,17 @@ const uint32_t &ArrayList<T>::add(const uint32_t &index, const T &value) {
  */
 template<typename T>
 void ArrayList<T>::resize() {
-    uint32_t newCapacity = (mCapacity == 0) ? 1 : mCapacity * 2;
-    ScopedArray<T> newArray(new T[newCapacity]);
+    CONTAINER_TRACE_SCOPE(arraylist_resize, mSize);
+    uint32_t newCapacity = static_cast<uint32_t>(
+        std::min<uint64_t>(std::max<uint64_t>(uint64_t(mCapacity) * 2, 1), UINT32_MAX));
+    ScopedArray<T> newArray(newCapacity, mResource);
     std::move(mArray.get(), mArray.get() + mSize, newArray.get());
     mArray.swap(newArray);
     std::swap(mCapacity, newCapacity);
+    ARRAYLIST_COUNT(reallocations, 1);
+    ARRAYLIST_COUNT(elementsMoved, mSize);
+    ARRAYLIST_COUNT(bytesTransferred, uint64_t(mSize) * sizeof(T));
+    ARRAYLIST_COUNT_CAPACITY();
 }
 
 /**
@@ -148,6 +309,7 @@ template<typename T>
 void ArrayList<T>::clear() {
     mArray.reset();
     mSize = mCapacity = 0;
+    ARRAYLIST_COUNT(clears, 1);
 }
 
 /**
@@ -159,9 +321,8 @@ void ArrayList<T>::clear() {
  */
 template<typename T>
 const T& ArrayList<T>::get(const uint32_t &index) const {
-    if (!check_range(index))
-        throw out_of_range(index);
-
+    ARRAYLIST_COUNT(gets, 1);
+    checkIndex(index);
     return mArray[index];
 }
 
@@ -172,7 +333,40 @@ const T& ArrayList<T>::get(const uint32_t &index) const {
  * @return 'true' if the index is within the valid range, 'false' otherwise.
  */
 template<typename T>
-bool ArrayList<T>::check_range(uint32_t index) const {return index < mCapacity;}
+bool ArrayList<T>::check_range(uint32_t index) const {return index < mSize;}
+
+/**
+ * Applies the bounds checking policy selected by ARRAYLIST_BOUNDS_CHECK to an index.
+ * @param index The index to be checked.
+ * @modifies N/A
+ * @throws ArrayList::out_of_range if the index is out of bounds and the policy is ARRAYLIST_CHECKED.
+ * @return N/A
+ */
+template<typename T>
+void ArrayList<T>::checkIndex(uint32_t index) const {
+#if ARRAYLIST_BOUNDS_CHECK == ARRAYLIST_CHECKED
+    if (__builtin_expect(!check_range(index), 0)) {
+        ARRAYLIST_COUNT(outOfRange, 1);
+        outOfRange(index);
+    }
+#elif ARRAYLIST_BOUNDS_CHECK == ARRAYLIST_ASSERTED
+    assert(check_range(index) && "ArrayList index out of range");
+#else
+    (void) index;
+#endif
+}
+
+/**
+ * Reports an out-of-range index. Kept out of line and cold, so that building the message and the
+ * exception adds nothing to the accessors but a call.
+ * @param index The offending index.
+ * @modifies N/A
+ * @throws ArrayList::out_of_range with the index as its message; aborts instead when exceptions
+ *         are disabled.
+ * @return N/A
+ */
+template<typename T>
+CONTAINER_COLD void ArrayList<T>::outOfRange(uint32_t index) {raiseError(out_of_range(index));}
 
 /**
  * Retrieves a reference to the element at a specific index in the ArrayList.
@@ -183,12 +377,35 @@ bool ArrayList<T>::check_range(uint32_t index) const {return index < mCapacity;}
  */
 template<typename T>
 T& ArrayList<T>::get(const uint32_t &index) {
-    if (!check_range(index))
-        throw out_of_range(index);
-
+    ARRAYLIST_COUNT(gets, 1);
+    checkIndex(index);
     return mArray[index];
 }
 
+/**
+ * Retrieves a pointer to the element at a specific index, if there is one.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @return A pointer to the element at the specified index, or nullptr if it is out of bounds.
+ */
+template<typename T>
+T* ArrayList<T>::tryGet(const uint32_t &index) noexcept {
+    ARRAYLIST_COUNT(gets, 1);
+    return check_range(index) ? mArray.get() + index : nullptr;
+}
+
+/**
+ * Retrieves a constant pointer to the element at a specific index, if there is one.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @return A constant pointer to the element at the specified index, or nullptr if it is out of bounds.
+ */
+template<typename T>
+const T* ArrayList<T>::tryGet(const uint32_t &index) const noexcept {
+    ARRAYLIST_COUNT(gets, 1);
+    return check_range(index) ? mArray.get() + index : nullptr;
+}
+
 /**
  * Accesses and returns a reference to the element at a specific index in the ArrayList.
  * @param index The index of the element to access.
@@ -207,6 +424,33 @@ T& ArrayList<T>::operator[](const uint32_t &index) {return mArray[index];}
 template<typename T>
 const T& ArrayList<T>::operator[](const uint32_t &index) const {return mArray[index];}
 
+/**
+ * Returns a pointer to the contiguous buffer holding the elements.
+ * @param N/A
+ * @modifies N/A
+ * @return A pointer to the first element, or nullptr if no buffer has been allocated.
+ */
+template<typename T>
+T* ArrayList<T>::data() {return mArray.get();}
+
+/**
+ * Returns a pointer to the contiguous buffer holding the elements.
+ * @param N/A
+ * @modifies N/A
+ * @return A constant pointer to the first element, or nullptr if no buffer has been allocated.
+ */
+template<typename T>
+const T* ArrayList<T>::data() const {return mArray.get();}
+
+/**
+ * Returns the memory resource buffers are allocated from.
+ * @param N/A
+ * @modifies N/A
+ * @return The memory resource, or nullptr if buffers come from new[].
+ */
+template<typename T>
+std::pmr::memory_resource* ArrayList<T>::resource() const {return mResource;}
+
 /**
  * Checks if the ArrayList is empty.
  * @param N/A
@@ -225,18 +469,172 @@ bool ArrayList<T>::isEmpty() const {return mSize == 0;}
  */
 template<typename T>
 T ArrayList<T>::remove(const uint32_t &index) {
+    ARRAYLIST_COUNT(removes, 1);
+    checkIndex(index);
+    T removeValue = mArray[index];
+    erase(index);
+    return removeValue;
+}
+
+/**
+ * Removes the element at a specific index, if there is one.
+ * @param index The index of the element to remove.
+ * @modifies Removes the element at the specified index, shifting elements if necessary.
+ * @return 'true' if an element was removed, 'false' if the index is out of bounds.
+ */
+template<typename T>
+bool ArrayList<T>::tryRemove(const uint32_t &index) {
+    ARRAYLIST_COUNT(removes, 1);
+    if (!check_range(index))
+        return false;
+
+    erase(index);
+    return true;
+}
+
+/**
+ * Removes the element at a specific index, if there is one, and hands it to the caller.
+ * @param index The index of the element to remove.
+ * @param removed Receives the removed element.
+ * @modifies Removes the element at the specified index, shifting elements if necessary.
+ * @return 'true' if an element was removed, 'false' if the index is out of bounds.
+ */
+template<typename T>
+bool ArrayList<T>::tryRemove(const uint32_t &index, T &removed) {
+    ARRAYLIST_COUNT(removes, 1);
     if (!check_range(index))
-        throw out_of_range(index);
+        return false;
 
-    ScopedArray<T> newArray(new T[mCapacity]);
+    T removeValue = mArray[index];
+    erase(index);
+    removed = std::move(removeValue);
+    return true;
+}
 
-    std::copy(mArray.get(), mArray.get() + mSize, newArray.get());
-    T removeValue = newArray[index];
+/**
+ * Copies the elements at a sequence of indices into an output buffer, prefetching ahead.
+ * @param indices The indices of the elements to copy.
+ * @param count The number of indices.
+ * @param out The buffer receiving the elements.
+ * @param prefetchDistance The number of indices to look ahead when prefetching.
+ * @modifies Overwrites the first 'count' elements of 'out'.
+ * @throws ArrayList::out_of_range if an index is out of bounds and the policy is ARRAYLIST_CHECKED.
+ * @return N/A
+ */
+template<typename T>
+void ArrayList<T>::gather(const uint32_t *indices, uint32_t count, T *out,
+                          uint32_t prefetchDistance) const {
+    ARRAYLIST_COUNT(gets, count);
+    CONTAINER_TRACE_SCOPE(arraylist_gather, count);
+    checkIndices(indices, count);
+    const T* array = mArray.get();
+    uint32_t i = 0;
+#ifdef __AVX2__
+    // The gather instructions take signed 32-bit indices
+    if constexpr (std::is_trivially_copyable_v<T> && (sizeof(T) == 4 || sizeof(T) == 8)) {
+        const uint32_t kLanes = 32 / sizeof(T);
+        if (mSize <= INT32_MAX) {
+            for (; i + kLanes <= count; i += kLanes) {
+                if (prefetchDistance != 0 && i + prefetchDistance + kLanes <= count) {
+                    for (uint32_t lane = 0; lane < kLanes; ++lane)
+                        __builtin_prefetch(array + indices[i + prefetchDistance + lane]);
+                }
+                __m256i values;
+                if constexpr (sizeof(T) == 4) {
+                    __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+                    values = _mm256_i32gather_epi32(reinterpret_cast<const int*>(array), lanes, 4);
+                } else {
+                    __m128i lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+                    values = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(array),
+                                                    lanes, 8);
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), values);
+            }
+        }
+    }
+#endif
+    if (prefetchDistance != 0) {
+        for (; i + prefetchDistance < count; ++i) {
+            __builtin_prefetch(array + indices[i + prefetchDistance]);
+            out[i] = array[indices[i]];
+        }
+    }
+    for (; i < count; ++i)
+        out[i] = array[indices[i]];
+}
 
-    std::copy(newArray.get() + index + 1, newArray.get() + mSize, newArray.get() + index);
-    mArray.swap(newArray);
+/**
+ * Writes a sequence of values to a sequence of indices, prefetching ahead.
+ * @param indices The indices of the elements to write.
+ * @param count The number of indices.
+ * @param values The values to write.
+ * @param prefetchDistance The number of indices to look ahead when prefetching.
+ * @modifies Sets the element at each index to the matching value, in order.
+ * @throws ArrayList::out_of_range if an index is out of bounds and the policy is ARRAYLIST_CHECKED.
+ * @return N/A
+ */
+template<typename T>
+void ArrayList<T>::scatter(const uint32_t *indices, uint32_t count, const T *values,
+                           uint32_t prefetchDistance) {
+    ARRAYLIST_COUNT(sets, count);
+    CONTAINER_TRACE_SCOPE(arraylist_scatter, count);
+    checkIndices(indices, count);
+    T* array = mArray.get();
+    uint32_t i = 0;
+    if (prefetchDistance != 0) {
+        for (; i + prefetchDistance < count; ++i) {
+            __builtin_prefetch(array + indices[i + prefetchDistance], 1);
+            array[indices[i]] = values[i];
+        }
+    }
+    for (; i < count; ++i)
+        array[indices[i]] = values[i];
+}
+
+/**
+ * Applies the bounds checking policy selected by ARRAYLIST_BOUNDS_CHECK to a sequence of indices.
+ * @param indices The indices to be checked.
+ * @param count The number of indices.
+ * @modifies N/A
+ * @throws ArrayList::out_of_range for the first index out of bounds if the policy is
+ *         ARRAYLIST_CHECKED.
+ * @return N/A
+ */
+template<typename T>
+void ArrayList<T>::checkIndices(const uint32_t *indices, uint32_t count) const {
+#if ARRAYLIST_BOUNDS_CHECK != ARRAYLIST_UNCHECKED
+    for (uint32_t i = 0; i < count; ++i)
+        checkIndex(indices[i]);
+#else
+    (void) indices;
+    (void) count;
+#endif
+}
+
+/**
+ * Shifts the elements following an index down by one. If T can be moved without throwing this
+ * happens in place; otherwise the elements are copied into a new buffer that is swapped in, so a
+ * throwing copy leaves the list untouched.
+ * @param index The index of the element to remove, which must be in range.
+ * @modifies Removes the element at the specified index.
+ * @return N/A
+ */
+template<typename T>
+void ArrayList<T>::erase(uint32_t index) {
+    if constexpr (std::is_nothrow_move_assignable_v<T>) {
+        std::move(mArray.get() + index + 1, mArray.get() + mSize, mArray.get() + index);
+        ARRAYLIST_COUNT(elementsMoved, mSize - index - 1);
+        ARRAYLIST_COUNT(bytesTransferred, uint64_t(mSize - index - 1) * sizeof(T));
+    } else {
+        ScopedArray<T> newArray(mCapacity, mResource);
+        std::copy(mArray.get(), mArray.get() + index, newArray.get());
+        std::copy(mArray.get() + index + 1, mArray.get() + mSize, newArray.get() + index);
+        mArray.swap(newArray);
+        ARRAYLIST_COUNT(reallocations, 1);
+        ARRAYLIST_COUNT(elementsCopied, mSize - 1);
+        ARRAYLIST_COUNT(bytesTransferred, uint64_t(mSize - 1) * sizeof(T));
+    }
     --mSize;
-    return removeValue;
 }
 
 /**
@@ -249,10 +647,196 @@ T ArrayList<T>::remove(const uint32_t &index) {
  */
 template<typename T>
 void ArrayList<T>::set(const uint32_t &index, const T &value)  {
+    ARRAYLIST_COUNT(sets, 1);
+    checkIndex(index);
+    mArray[index] = value;
+}
+
+/**
+ * Sets the value of the element at a specific index, if there is one.
+ * @param index The index of the element to set.
+ * @param value The new value to set.
+ * @modifies Sets the value of the element at the specified index.
+ * @return 'true' if the element was set, 'false' if the index is out of bounds.
+ */
+template<typename T>
+bool ArrayList<T>::trySet(const uint32_t &index, const T &value) {
+    ARRAYLIST_COUNT(sets, 1);
     if (!check_range(index))
-        throw out_of_range(index);
+        return false;
 
     mArray[index] = value;
+    return true;
+}
+
+/**
+ * Applies a batch of edits. The edits are visited in index order, inserts at an index before the
+ * other edits of that index, through a stably sorted permutation, while the list is copied into a
+ * new buffer. Copying is all that can throw, and it only writes the new buffer.
+ * @param batch The edits to apply.
+ * @modifies Rebuilds the list with every edit applied, or sets the elements in place for a batch
+ *           of sets only whose element type cannot throw on assignment.
+ * @throws ArrayList::out_of_range if an index is out of range, before anything changes.
+ * @throws std::length_error if the list would exceed UINT32_MAX elements.
+ * @return N/A
+ */
+template<typename T>
+void ArrayList<T>::apply(const Batch &batch) {
+    typedef typename Batch::Edit Edit;
+    const ArrayList<Edit>& edits = batch.mEdits;
+    const uint32_t count = edits.size();
+    // Checked whatever ARRAYLIST_BOUNDS_CHECK selects: a bad index would write past the buffer
+    for (uint32_t e = 0; e < count; ++e) {
+        const Edit& edit = edits[e];
+        bool valid = edit.kind == Batch::kInsert ? edit.index <= mSize : check_range(edit.index);
+        if (!valid) {
+            ARRAYLIST_COUNT(outOfRange, 1);
+            outOfRange(edit.index);
+        }
+    }
+    if (count == 0)
+        return;
+
+    CONTAINER_TRACE_SCOPE(arraylist_batch, count);
+    if (batch.mInserts == 0 && std::is_nothrow_copy_assignable_v<T>) {
+        bool setsOnly = true;
+        for (uint32_t e = 0; e < count && setsOnly; ++e)
+            setsOnly = edits[e].kind == Batch::kSet;
+        if (setsOnly) {
+            for (uint32_t e = 0; e < count; ++e)
+                mArray[edits[e].index] = edits[e].value;
+            ARRAYLIST_COUNT(sets, count);
+            return;
+        }
+    }
+
+    ArrayList<uint32_t> order = ArrayList<uint32_t>::forOverwrite(count);
+    for (uint32_t e = 0; e < count; ++e)
+        order[e] = e;
+    std::stable_sort(order.data(), order.data() + count, [&edits](uint32_t lhs, uint32_t rhs) {
+        const Edit& left = edits[lhs];
+        const Edit& right = edits[rhs];
+        if (left.index != right.index)
+            return left.index < right.index;
+        return left.kind == Batch::kInsert && right.kind != Batch::kInsert;
+    });
+
+    // Each removed element is counted once, however many times it was removed: the edits of one
+    // index are adjacent, so it is enough to remember whether the current index saw a removal
+    uint32_t removed = 0;
+    bool indexRemoved = false;
+    for (uint32_t e = 0; e < count; ++e) {
+        const Edit& edit = edits[order[e]];
+        if (e > 0 && edits[order[e - 1]].index != edit.index)
+            indexRemoved = false;
+        if (edit.kind == Batch::kRemove && !indexRemoved) {
+            ++removed;
+            indexRemoved = true;
+        }
+    }
+    uint64_t newSize = uint64_t(mSize) + batch.mInserts - removed;
+    if (newSize > UINT32_MAX)
+        throwLengthError("ArrayList cannot exceed UINT32_MAX elements");
+
+    uint64_t newCapacity = std::max<uint64_t>(mCapacity, 1);
+    while (newCapacity < newSize)
+        newCapacity *= 2;
+    newCapacity = std::min<uint64_t>(newCapacity, UINT32_MAX);
+
+    ScopedArray<T> temp(newCapacity, mResource);
+    uint32_t out = 0;
+    uint32_t e = 0;
+    for (uint32_t i = 0; i <= mSize; ++i) {
+        while (e < count && edits[order[e]].index == i && edits[order[e]].kind == Batch::kInsert)
+            temp[out++] = edits[order[e++]].value;
+        if (i == mSize)
+            break;
+
+        const T* element = &mArray[i];
+        bool erased = false;
+        for (; e < count && edits[order[e]].index == i; ++e) {
+            if (edits[order[e]].kind == Batch::kSet)
+                element = &edits[order[e]].value;
+            else
+                erased = true;
+        }
+        if (!erased)
+            temp[out++] = *element;
+    }
+
+    mArray.swap(temp);
+    ARRAYLIST_COUNT(inserts, batch.mInserts);
+    ARRAYLIST_COUNT(removes, removed);
+    ARRAYLIST_COUNT(reallocations, 1);
+    ARRAYLIST_COUNT(elementsCopied, mSize);
+    ARRAYLIST_COUNT(bytesTransferred, uint64_t(mSize) * sizeof(T));
+    mSize = static_cast<uint32_t>(newSize);
+    mCapacity = static_cast<uint32_t>(newCapacity);
+    ARRAYLIST_COUNT_CAPACITY();
+}
+
+/**
+ * Records an insertion.
+ * @param index The index, in the list before the batch, to insert before.
+ * @param value The value to insert.
+ * @modifies Appends the edit to the batch.
+ * @return N/A
+ */
+template<typename T>
+void ArrayList<T>::Batch::insert(uint32_t index, const T &value) {
+    mEdits.add(Edit{index, kInsert, value});
+    ++mInserts;
+}
+
+/**
+ * Records a replacement.
+ * @param index The index, in the list before the batch, of the element to replace.
+ * @param value The new value.
+ * @modifies Appends the edit to the batch.
+ * @return N/A
+ */
+template<typename T>
+void ArrayList<T>::Batch::set(uint32_t index, const T &value) {
+    mEdits.add(Edit{index, kSet, value});
+}
+
+/**
+ * Records a removal.
+ * @param index The index, in the list before the batch, of the element to remove.
+ * @modifies Appends the edit to the batch.
+ * @return N/A
+ */
+template<typename T>
+void ArrayList<T>::Batch::remove(uint32_t index) {mEdits.add(Edit{index, kRemove, T()});}
+
+/**
+ * Returns the number of edits in the batch.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of edits.
+ */
+template<typename T>
+uint32_t ArrayList<T>::Batch::size() const {return mEdits.size();}
+
+/**
+ * Checks if the batch has no edits.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the batch is empty, 'false' otherwise.
+ */
+template<typename T>
+bool ArrayList<T>::Batch::isEmpty() const {return mEdits.size() == 0;}
+
+/**
+ * Discards the edits of the batch.
+ * @param N/A
+ * @modifies Empties the batch.
+ * @return N/A
+ */
+template<typename T>
+void ArrayList<T>::Batch::clear() {
+    mEdits.clear();
+    mInserts = 0;
 }
 
 /**
@@ -264,6 +848,94 @@ void ArrayList<T>::set(const uint32_t &index, const T &value)  {
 template<typename T>
 uint32_t ArrayList<T>::size() const {return mSize;}
 
+/**
+ * Returns the capacity of the ArrayList.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of elements the buffer holds.
+ */
+template<typename T>
+uint32_t ArrayList<T>::capacity() const {return mCapacity;}
+
+/**
+ * Returns the size of the buffer.
+ * @param N/A
+ * @modifies N/A
+ * @return The bytes allocated for elements.
+ */
+template<typename T>
+size_t ArrayList<T>::memoryFootprint() const {return mArray.memoryFootprint();}
+
+/**
+ * Releases the spare capacity of the ArrayList.
+ * @param N/A
+ * @modifies Moves the elements into a buffer of exactly size() elements, or releases the buffer
+ *           if the list is empty. Elements are copied unless T can be moved without throwing, so
+ *           a throwing copy leaves the list untouched.
+ * @return N/A
+ */
+template<typename T>
+void ArrayList<T>::shrinkToFit() {
+    if (mSize == mCapacity)
+        return;
+
+    ScopedArray<T> newArray(nullptr);
+    if (mSize > 0) {
+        ScopedArray<T> fitted(mSize, mResource);
+        if constexpr (std::is_nothrow_move_assignable_v<T>) {
+            std::move(mArray.get(), mArray.get() + mSize, fitted.get());
+            ARRAYLIST_COUNT(elementsMoved, mSize);
+        } else {
+            std::copy(mArray.get(), mArray.get() + mSize, fitted.get());
+            ARRAYLIST_COUNT(elementsCopied, mSize);
+        }
+        newArray.swap(fitted);
+        ARRAYLIST_COUNT(reallocations, 1);
+        ARRAYLIST_COUNT(bytesTransferred, uint64_t(mSize) * sizeof(T));
+    }
+    mArray.swap(newArray);
+    mCapacity = mSize;
+}
+
+#if ARRAYLIST_REGISTRY
+/**
+ * How ContainerRegistry measures and trims ArrayLists of this element type.
+ */
+template<typename T>
+const ContainerKind ArrayList<T>::kRegistryKind = {
+    typeid(ArrayList<T>).name(),
+    [](const void* list) {return static_cast<const ArrayList<T>*>(list)->memoryFootprint();},
+    [](const void* list) {
+        return static_cast<const ArrayList<T>*>(list)->size() * sizeof(T);
+    },
+    [](void* list) {
+        ArrayList<T>& self = *static_cast<ArrayList<T>*>(list);
+        size_t before = self.memoryFootprint();
+        self.shrinkToFit();
+        return before - self.memoryFootprint();
+    },
+};
+#endif
+
+/**
+ * Returns the operation counters of the ArrayList.
+ * @param N/A
+ * @modifies N/A
+ * @return The counters, with the current size and capacity filled in.
+ */
+template<typename T>
+ArrayListStats ArrayList<T>::stats() const {
+#if ARRAYLIST_STATS
+    ArrayListStats stats = mStats;
+#else
+    ArrayListStats stats;
+#endif
+    stats.capacity = mCapacity;
+    stats.size = mSize;
+    stats.lists = 1;
+    return stats;
+}
+
 /**
  * Swaps the contents of two ArrayList objects, effectively exchanging their elements and capacity.
  * @param src The ArrayList to swap content with.
@@ -274,6 +946,7 @@ template<typename T>
 void ArrayList<T>::swap(ArrayList<T> &src) noexcept {
     std::swap(mSize, src.mSize);
     std::swap(mCapacity, src.mCapacity);
+    std::swap(mResource, src.mResource);
     mArray.swap(src.mArray);
 }
 
@@ -0,0 +1,513 @@
+// Author: Mac-Noble Brako-Kusi
+// File: ArrayListView.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for the lazy view template classes over ArrayList
+
+#include <algorithm>
+
+namespace array_list_view {
+/**
+ * Turns an element of a view into what collect() stores: a chunk, itself a view, is collected
+ * into an ArrayList, and anything else is passed through.
+ * @param element The element.
+ * @modifies N/A
+ * @return The value to store.
+ */
+template<typename Element> decltype(auto) materialize(Element &&element) {
+    typedef std::decay_t<Element> Type;
+    if constexpr (std::is_base_of_v<View<Type>, Type>)
+        return element.collect();
+    else
+        return std::forward<Element>(element);
+}
+} // Namespace
+
+/**
+ * Creates a view applying a function to each element.
+ * @param function The function.
+ * @modifies N/A
+ * @return The view.
+ */
+template<typename Derived>
+template<typename Function>
+MapView<Derived, Function> View<Derived>::map(Function function) const {
+    return MapView<Derived, Function>(derived(), function);
+}
+
+/**
+ * Creates a view of the elements a predicate selects.
+ * @param predicate The predicate.
+ * @modifies N/A
+ * @return The view.
+ */
+template<typename Derived>
+template<typename Predicate>
+FilterView<Derived, Predicate> View<Derived>::filter(Predicate predicate) const {
+    return FilterView<Derived, Predicate>(derived(), predicate);
+}
+
+/**
+ * Creates a view of the first elements.
+ * @param count The number of elements to keep.
+ * @modifies N/A
+ * @return The view.
+ */
+template<typename Derived>
+TakeView<Derived> View<Derived>::take(uint32_t count) const {
+    return TakeView<Derived>(derived(), count);
+}
+
+/**
+ * Creates a view skipping the first elements.
+ * @param count The number of elements to skip.
+ * @modifies N/A
+ * @return The view.
+ */
+template<typename Derived>
+DropView<Derived> View<Derived>::drop(uint32_t count) const {
+    return DropView<Derived>(derived(), count);
+}
+
+/**
+ * Creates a view pairing the elements with those of another view.
+ * @param other The other view.
+ * @modifies N/A
+ * @return The view.
+ */
+template<typename Derived>
+template<typename Other>
+ZipView<Derived, Other> View<Derived>::zip(const Other &other) const {
+    return ZipView<Derived, Other>(derived(), other);
+}
+
+/**
+ * Creates a view pairing the elements with their positions.
+ * @param N/A
+ * @modifies N/A
+ * @return The view.
+ */
+template<typename Derived>
+EnumerateView<Derived> View<Derived>::enumerate() const {return EnumerateView<Derived>(derived());}
+
+/**
+ * Creates a view of consecutive chunks.
+ * @param size The number of elements in each chunk.
+ * @modifies N/A
+ * @throws std::invalid_argument if 'size' is 0.
+ * @return The view.
+ */
+template<typename Derived>
+ChunkView<Derived> View<Derived>::chunk(uint32_t size) const {
+    if (size == 0)
+        throwInvalidArgument("chunk size must be positive");
+
+    return ChunkView<Derived>(derived(), size);
+}
+
+/**
+ * Creates a view of every step-th element.
+ * @param step The distance between elements.
+ * @modifies N/A
+ * @throws std::invalid_argument if 'step' is 0.
+ * @return The view.
+ */
+template<typename Derived>
+StrideView<Derived> View<Derived>::stride(uint32_t step) const {
+    if (step == 0)
+        throwInvalidArgument("stride step must be positive");
+
+    return StrideView<Derived>(derived(), step);
+}
+
+/**
+ * Calls a function with each element.
+ * @param visit The function.
+ * @modifies Whatever 'visit' does.
+ * @return N/A
+ */
+template<typename Derived>
+template<typename Visit>
+void View<Derived>::forEach(Visit visit) const {
+    each([&visit](auto&& element) {
+        visit(std::forward<decltype(element)>(element));
+        return true;
+    });
+}
+
+/**
+ * Materializes the view into an ArrayList.
+ * @param N/A
+ * @modifies Runs the pipeline once.
+ * @return The elements.
+ */
+template<typename Derived>
+auto View<Derived>::collect() const {
+    typedef typename Derived::value_type Value;
+    const Derived& self = derived();
+    if constexpr (Derived::kRandomAccess) {
+        ArrayList<Value> out = ArrayList<Value>::forOverwrite(self.size());
+        Value* data = out.data();
+        for (uint32_t i = 0; i < out.size(); ++i)
+            data[i] = array_list_view::materialize(self[i]);
+        return out;
+    } else {
+        ArrayList<Value> out;
+        each([&out](auto&& element) {
+            out.add(Value(array_list_view::materialize(std::forward<decltype(element)>(element))));
+            return true;
+        });
+        out.shrinkToFit();
+        return out;
+    }
+}
+
+/**
+ * Passes the elements to a sink until it returns false. A random-access view loops over its
+ * indexes; any other view asks its source to push elements through it.
+ * @param sink The function receiving each element.
+ * @modifies Whatever 'sink' does.
+ * @return 'false' if the sink stopped the loop, 'true' otherwise.
+ */
+template<typename Derived>
+template<typename Sink>
+bool View<Derived>::each(Sink &&sink) const {
+    const Derived& self = derived();
+    if constexpr (Derived::kRandomAccess) {
+        const uint32_t size = self.size();
+        for (uint32_t i = 0; i < size; ++i) {
+            if (!sink(self[i]))
+                return false;
+        }
+        return true;
+    } else {
+        return self.push(sink);
+    }
+}
+
+/**
+ * Constructor: Creates a view of a contiguous range.
+ * @param data The first element.
+ * @param size The number of elements.
+ * @modifies N/A
+ * @return N/A
+ */
+template<typename T>
+SliceView<T>::SliceView(T *data, uint32_t size)
+    : mData(data),
+      mSize(size) {}
+
+template<typename T>
+T &SliceView<T>::operator[](uint32_t index) const {return mData[index];}
+
+template<typename T>
+uint32_t SliceView<T>::size() const {return mSize;}
+
+template<typename T>
+bool SliceView<T>::isEmpty() const {return mSize == 0;}
+
+template<typename T>
+T *SliceView<T>::data() const {return mData;}
+
+/**
+ * Creates a view of part of this slice.
+ * @param first The index of the first element.
+ * @param last The index past the last element.
+ * @modifies N/A
+ * @throws std::out_of_range if the range is not within the slice.
+ * @return The subslice.
+ */
+template<typename T>
+SliceView<T> SliceView<T>::slice(uint32_t first, uint32_t last) const {
+    if (first > last || last > mSize)
+        throwOutOfRange("slice range is not within the view");
+
+    return SliceView<T>(mData + first, last - first);
+}
+
+/**
+ * Constructor: Creates a view applying a function to each element of a source.
+ * @param source The source view.
+ * @param function The function.
+ * @modifies N/A
+ * @return N/A
+ */
+template<typename Source, typename Function>
+MapView<Source, Function>::MapView(const Source &source, const Function &function)
+    : mSource(source),
+      mFunction(function) {}
+
+template<typename Source, typename Function>
+typename MapView<Source, Function>::reference
+MapView<Source, Function>::operator[](uint32_t index) const {return mFunction(mSource[index]);}
+
+template<typename Source, typename Function>
+uint32_t MapView<Source, Function>::size() const {return mSource.size();}
+
+/**
+ * Pushes the mapped elements of the source into a sink.
+ * @param sink The function receiving each element.
+ * @modifies Whatever 'sink' does.
+ * @return 'false' if the sink stopped the loop, 'true' otherwise.
+ */
+template<typename Source, typename Function>
+template<typename Sink>
+bool MapView<Source, Function>::push(Sink &sink) const {
+    return mSource.each([this, &sink](auto&& element) {
+        return sink(mFunction(std::forward<decltype(element)>(element)));
+    });
+}
+
+/**
+ * Constructor: Creates a view of the elements of a source a predicate selects.
+ * @param source The source view.
+ * @param predicate The predicate.
+ * @modifies N/A
+ * @return N/A
+ */
+template<typename Source, typename Predicate>
+FilterView<Source, Predicate>::FilterView(const Source &source, const Predicate &predicate)
+    : mSource(source),
+      mPredicate(predicate) {}
+
+/**
+ * Pushes the selected elements of the source into a sink.
+ * @param sink The function receiving each element.
+ * @modifies Whatever 'sink' does.
+ * @return 'false' if the sink stopped the loop, 'true' otherwise.
+ */
+template<typename Source, typename Predicate>
+template<typename Sink>
+bool FilterView<Source, Predicate>::push(Sink &sink) const {
+    return mSource.each([this, &sink](auto&& element) {
+        return !mPredicate(element) || sink(std::forward<decltype(element)>(element));
+    });
+}
+
+/**
+ * Constructor: Creates a view of the first elements of a source.
+ * @param source The source view.
+ * @param count The number of elements to keep.
+ * @modifies N/A
+ * @return N/A
+ */
+template<typename Source>
+TakeView<Source>::TakeView(const Source &source, uint32_t count)
+    : mSource(source),
+      mCount(count) {}
+
+template<typename Source>
+typename TakeView<Source>::reference TakeView<Source>::operator[](uint32_t index) const {
+    return mSource[index];
+}
+
+template<typename Source>
+uint32_t TakeView<Source>::size() const {return std::min(mCount, mSource.size());}
+
+/**
+ * Pushes the first elements of the source into a sink, stopping the source once they are out.
+ * @param sink The function receiving each element.
+ * @modifies Whatever 'sink' does.
+ * @return 'false' if the sink stopped the loop, 'true' otherwise.
+ */
+template<typename Source>
+template<typename Sink>
+bool TakeView<Source>::push(Sink &sink) const {
+    if (mCount == 0)
+        return true;
+
+    uint32_t taken = 0;
+    bool stopped = false;
+    mSource.each([this, &sink, &taken, &stopped](auto&& element) {
+        stopped = !sink(std::forward<decltype(element)>(element));
+        return !stopped && ++taken < mCount;
+    });
+    return !stopped;
+}
+
+/**
+ * Constructor: Creates a view of a source without its first elements.
+ * @param source The source view.
+ * @param count The number of elements to skip.
+ * @modifies N/A
+ * @return N/A
+ */
+template<typename Source>
+DropView<Source>::DropView(const Source &source, uint32_t count)
+    : mSource(source),
+      mCount(count) {}
+
+template<typename Source>
+typename DropView<Source>::reference DropView<Source>::operator[](uint32_t index) const {
+    return mSource[mCount + index];
+}
+
+template<typename Source>
+uint32_t DropView<Source>::size() const {
+    uint32_t size = mSource.size();
+    return size > mCount ? size - mCount : 0;
+}
+
+/**
+ * Pushes the elements of the source after the first ones into a sink.
+ * @param sink The function receiving each element.
+ * @modifies Whatever 'sink' does.
+ * @return 'false' if the sink stopped the loop, 'true' otherwise.
+ */
+template<typename Source>
+template<typename Sink>
+bool DropView<Source>::push(Sink &sink) const {
+    uint32_t skipped = 0;
+    return mSource.each([this, &sink, &skipped](auto&& element) {
+        if (skipped < mCount) {
+            ++skipped;
+            return true;
+        }
+        return sink(std::forward<decltype(element)>(element));
+    });
+}
+
+/**
+ * Constructor: Creates a view pairing the elements of two views.
+ * @param first The view supplying the first members.
+ * @param second The view supplying the second members.
+ * @modifies N/A
+ * @return N/A
+ */
+template<typename First, typename Second>
+ZipView<First, Second>::ZipView(const First &first, const Second &second)
+    : mFirst(first),
+      mSecond(second) {}
+
+template<typename First, typename Second>
+typename ZipView<First, Second>::reference
+ZipView<First, Second>::operator[](uint32_t index) const {
+    return reference(mFirst[index], mSecond[index]);
+}
+
+template<typename First, typename Second>
+uint32_t ZipView<First, Second>::size() const {return std::min(mFirst.size(), mSecond.size());}
+
+/**
+ * Constructor: Creates a view pairing the elements of a source with their positions.
+ * @param source The source view.
+ * @modifies N/A
+ * @return N/A
+ */
+template<typename Source>
+EnumerateView<Source>::EnumerateView(const Source &source)
+    : mSource(source) {}
+
+template<typename Source>
+typename EnumerateView<Source>::reference EnumerateView<Source>::operator[](uint32_t index) const {
+    return reference(index, mSource[index]);
+}
+
+template<typename Source>
+uint32_t EnumerateView<Source>::size() const {return mSource.size();}
+
+/**
+ * Pushes the elements of the source, with their positions, into a sink.
+ * @param sink The function receiving each element.
+ * @modifies Whatever 'sink' does.
+ * @return 'false' if the sink stopped the loop, 'true' otherwise.
+ */
+template<typename Source>
+template<typename Sink>
+bool EnumerateView<Source>::push(Sink &sink) const {
+    uint32_t position = 0;
+    return mSource.each([&sink, &position](auto&& element) {
+        return sink(reference(position++, std::forward<decltype(element)>(element)));
+    });
+}
+
+/**
+ * Constructor: Creates a view of consecutive chunks of a source.
+ * @param source The source view.
+ * @param size The number of elements in each chunk.
+ * @modifies N/A
+ * @return N/A
+ */
+template<typename Source>
+ChunkView<Source>::ChunkView(const Source &source, uint32_t size)
+    : mSource(source),
+      mChunkSize(size) {}
+
+template<typename Source>
+typename ChunkView<Source>::reference ChunkView<Source>::operator[](uint32_t index) const {
+    return mSource.drop(index * mChunkSize).take(mChunkSize);
+}
+
+template<typename Source>
+uint32_t ChunkView<Source>::size() const {
+    return static_cast<uint32_t>((uint64_t(mSource.size()) + mChunkSize - 1) / mChunkSize);
+}
+
+/**
+ * Constructor: Creates a view of every step-th element of a source.
+ * @param source The source view.
+ * @param step The distance between elements.
+ * @modifies N/A
+ * @return N/A
+ */
+template<typename Source>
+StrideView<Source>::StrideView(const Source &source, uint32_t step)
+    : mSource(source),
+      mStep(step) {}
+
+template<typename Source>
+typename StrideView<Source>::reference StrideView<Source>::operator[](uint32_t index) const {
+    return mSource[index * mStep];
+}
+
+template<typename Source>
+uint32_t StrideView<Source>::size() const {
+    return static_cast<uint32_t>((uint64_t(mSource.size()) + mStep - 1) / mStep);
+}
+
+/**
+ * Pushes every step-th element of the source into a sink.
+ * @param sink The function receiving each element.
+ * @modifies Whatever 'sink' does.
+ * @return 'false' if the sink stopped the loop, 'true' otherwise.
+ */
+template<typename Source>
+template<typename Sink>
+bool StrideView<Source>::push(Sink &sink) const {
+    uint32_t position = 0;
+    return mSource.each([this, &sink, &position](auto&& element) {
+        return position++ % mStep != 0 || sink(std::forward<decltype(element)>(element));
+    });
+}
+
+/**
+ * Creates a view of a whole list.
+ * @param list The list.
+ * @modifies N/A
+ * @return The slice.
+ */
+template<typename T>
+SliceView<T> slice(ArrayList<T> &list) {return SliceView<T>(list.data(), list.size());}
+
+template<typename T>
+SliceView<const T> slice(const ArrayList<T> &list) {
+    return SliceView<const T>(list.data(), list.size());
+}
+
+/**
+ * Creates a view of part of a list.
+ * @param list The list.
+ * @param first The index of the first element.
+ * @param last The index past the last element.
+ * @modifies N/A
+ * @throws std::out_of_range if the range is not within the list.
+ * @return The slice.
+ */
+template<typename T>
+SliceView<T> slice(ArrayList<T> &list, uint32_t first, uint32_t last) {
+    return slice(list).slice(first, last);
+}
+
+template<typename T>
+SliceView<const T> slice(const ArrayList<T> &list, uint32_t first, uint32_t last) {
+    return slice(list).slice(first, last);
+}
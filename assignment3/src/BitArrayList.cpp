@@ -0,0 +1,993 @@
+// Author: Mac-Noble Brako-Kusi
+// File: BitArrayList.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for BitArrayList class
+
+#include "BitArrayList.h"
+#include "ContainerError.h"
+#include <algorithm>
+#include <string>
+
+namespace {
+const uint32_t kWordBits = 64;
+
+// The largest word count whose capacity in bits still fits in a uint32_t.
+const uint32_t kMaxWords = UINT32_MAX / kWordBits;
+
+uint32_t wordsFor(uint32_t bits) {
+    return bits / kWordBits + (bits % kWordBits != 0);
+}
+
+uint32_t popcount(uint64_t word) {
+    return static_cast<uint32_t>(__builtin_popcountll(word));
+}
+
+uint32_t lowestSetBit(uint64_t word) {
+    return static_cast<uint32_t>(__builtin_ctzll(word));
+}
+} // Namespace
+
+/**
+ * Constructor: Creates a proxy for one bit.
+ * @param word The word holding the bit.
+ * @param mask The mask selecting the bit within 'word'.
+ * @modifies N/A
+ * @return N/A
+ */
+BitArrayList::reference::reference(uint64_t *word, uint64_t mask)
+    : mWord(word),
+      mMask(mask) {}
+
+/**
+ * Reads the bit.
+ * @param N/A
+ * @modifies N/A
+ * @return The value of the bit.
+ */
+BitArrayList::reference::operator bool() const {return (*mWord & mMask) != 0;}
+
+/**
+ * Writes the bit.
+ * @param value The new value of the bit.
+ * @modifies Sets or clears the bit.
+ * @return A reference to this proxy.
+ */
+BitArrayList::reference &BitArrayList::reference::operator=(bool value) {
+    if (value)
+        *mWord |= mMask;
+    else
+        *mWord &= ~mMask;
+    return *this;
+}
+
+/**
+ * Copies the value of another bit, not the proxy itself.
+ * @param rhs The proxy of the bit to copy.
+ * @modifies Sets or clears the bit.
+ * @return A reference to this proxy.
+ */
+BitArrayList::reference &BitArrayList::reference::operator=(const reference &rhs) {
+    return *this = static_cast<bool>(rhs);
+}
+
+/**
+ * Inverts the bit.
+ * @param N/A
+ * @modifies Toggles the bit.
+ * @return N/A
+ */
+void BitArrayList::reference::flip() {*mWord ^= mMask;}
+
+/**
+ * Constructor: Creates a singular iterator, which may only be assigned to.
+ * @param N/A
+ * @modifies N/A
+ * @return N/A
+ */
+BitArrayList::iterator::iterator()
+    : mList(nullptr),
+      mIndex(0) {}
+
+/**
+ * Constructor: Creates an iterator at a bit position.
+ * @param list The list to iterate over.
+ * @param index The position of the bit.
+ * @modifies N/A
+ * @return N/A
+ */
+BitArrayList::iterator::iterator(BitArrayList *list, uint32_t index)
+    : mList(list),
+      mIndex(index) {}
+
+/**
+ * Tests for iterator equality.
+ * @param rhs The iterator to compare against.
+ * @modifies N/A
+ * @return 'true' if both iterators point at the same bit.
+ */
+bool BitArrayList::iterator::operator==(const iterator &rhs) const {
+    return mList == rhs.mList && mIndex == rhs.mIndex;
+}
+
+/**
+ * Tests for iterator inequality.
+ * @param rhs The iterator to compare against.
+ * @modifies N/A
+ * @return 'true' if the iterators point at different bits.
+ */
+bool BitArrayList::iterator::operator!=(const iterator &rhs) const {return !(*this == rhs);}
+
+/**
+ * Tests whether this iterator comes before another into the same list.
+ * @param rhs The iterator to compare against.
+ * @modifies N/A
+ * @return 'true' if this iterator points at an earlier bit.
+ */
+bool BitArrayList::iterator::operator<(const iterator &rhs) const {return mIndex < rhs.mIndex;}
+
+/**
+ * Tests whether this iterator comes after another into the same list.
+ * @param rhs The iterator to compare against.
+ * @modifies N/A
+ * @return 'true' if this iterator points at a later bit.
+ */
+bool BitArrayList::iterator::operator>(const iterator &rhs) const {return rhs < *this;}
+
+/**
+ * Tests whether this iterator does not come after another into the same list.
+ * @param rhs The iterator to compare against.
+ * @modifies N/A
+ * @return 'true' if this iterator points at an earlier or the same bit.
+ */
+bool BitArrayList::iterator::operator<=(const iterator &rhs) const {return !(rhs < *this);}
+
+/**
+ * Tests whether this iterator does not come before another into the same list.
+ * @param rhs The iterator to compare against.
+ * @modifies N/A
+ * @return 'true' if this iterator points at a later or the same bit.
+ */
+bool BitArrayList::iterator::operator>=(const iterator &rhs) const {return !(*this < rhs);}
+
+/**
+ * Dereference operator.
+ * @param N/A
+ * @modifies N/A
+ * @return A proxy for the bit pointed to.
+ */
+BitArrayList::reference BitArrayList::iterator::operator*() const {return (*mList)[mIndex];}
+
+/**
+ * Subscript operator.
+ * @param offset The distance from this iterator to the bit.
+ * @modifies N/A
+ * @return A proxy for the bit.
+ */
+BitArrayList::reference BitArrayList::iterator::operator[](difference_type offset) const {
+    return *(*this + offset);
+}
+
+/**
+ * Preincrement operator.
+ * @param N/A
+ * @modifies Moves to the next bit.
+ * @return This iterator after the increment.
+ */
+BitArrayList::iterator &BitArrayList::iterator::operator++() {
+    ++mIndex;
+    return *this;
+}
+
+/**
+ * Postincrement operator.
+ * @param N/A
+ * @modifies Moves to the next bit.
+ * @return The iterator before the increment.
+ */
+BitArrayList::iterator BitArrayList::iterator::operator++(int) {
+    iterator previous = *this;
+    ++mIndex;
+    return previous;
+}
+
+/**
+ * Predecrement operator.
+ * @param N/A
+ * @modifies Moves to the previous bit.
+ * @return This iterator after the decrement.
+ */
+BitArrayList::iterator &BitArrayList::iterator::operator--() {
+    --mIndex;
+    return *this;
+}
+
+/**
+ * Postdecrement operator.
+ * @param N/A
+ * @modifies Moves to the previous bit.
+ * @return The iterator before the decrement.
+ */
+BitArrayList::iterator BitArrayList::iterator::operator--(int) {
+    iterator previous = *this;
+    --mIndex;
+    return previous;
+}
+
+/**
+ * Moves the iterator a number of bits forward.
+ * @param offset The distance to move forward, which may be negative.
+ * @modifies Moves to another bit.
+ * @return This iterator after the move.
+ */
+BitArrayList::iterator &BitArrayList::iterator::operator+=(difference_type offset) {
+    mIndex = static_cast<uint32_t>(static_cast<difference_type>(mIndex) + offset);
+    return *this;
+}
+
+/**
+ * Moves the iterator a number of bits back.
+ * @param offset The distance to move back, which may be negative.
+ * @modifies Moves to another bit.
+ * @return This iterator after the move.
+ */
+BitArrayList::iterator &BitArrayList::iterator::operator-=(difference_type offset) {
+    mIndex = static_cast<uint32_t>(static_cast<difference_type>(mIndex) - offset);
+    return *this;
+}
+
+/**
+ * Returns an iterator a number of bits forward.
+ * @param offset The distance to move forward.
+ * @modifies N/A
+ * @return The moved iterator.
+ */
+BitArrayList::iterator BitArrayList::iterator::operator+(difference_type offset) const {
+    iterator moved = *this;
+    return moved += offset;
+}
+
+/**
+ * Returns an iterator a number of bits back.
+ * @param offset The distance to move back.
+ * @modifies N/A
+ * @return The moved iterator.
+ */
+BitArrayList::iterator BitArrayList::iterator::operator-(difference_type offset) const {
+    iterator moved = *this;
+    return moved -= offset;
+}
+
+/**
+ * Iterator subtraction.
+ * @param rhs The iterator to subtract.
+ * @modifies N/A
+ * @return The distance between the iterators, which always fits since indices are 32-bit.
+ */
+BitArrayList::iterator::difference_type
+BitArrayList::iterator::operator-(const iterator &rhs) const {
+    return static_cast<difference_type>(mIndex) - static_cast<difference_type>(rhs.mIndex);
+}
+
+/**
+ * Returns an iterator a number of bits forward, with the offset first.
+ * @param offset The distance to move forward.
+ * @param it The iterator to move from.
+ * @modifies N/A
+ * @return The moved iterator.
+ */
+BitArrayList::iterator operator+(BitArrayList::iterator::difference_type offset,
+                                 const BitArrayList::iterator &it) {
+    return it + offset;
+}
+
+/**
+ * Constructor: Creates a singular constant iterator, which may only be assigned to.
+ * @param N/A
+ * @modifies N/A
+ * @return N/A
+ */
+BitArrayList::const_iterator::const_iterator()
+    : mList(nullptr),
+      mIndex(0) {}
+
+/**
+ * Constructor: Converts an iterator into a constant iterator at the same bit.
+ * @param it The iterator to convert.
+ * @modifies N/A
+ * @return N/A
+ */
+BitArrayList::const_iterator::const_iterator(const iterator &it)
+    : mList(it.mList),
+      mIndex(it.mIndex) {}
+
+/**
+ * Constructor: Creates a constant iterator at a bit position.
+ * @param list The list to iterate over.
+ * @param index The position of the bit.
+ * @modifies N/A
+ * @return N/A
+ */
+BitArrayList::const_iterator::const_iterator(const BitArrayList *list, uint32_t index)
+    : mList(list),
+      mIndex(index) {}
+
+/**
+ * Tests for iterator equality.
+ * @param rhs The iterator to compare against.
+ * @modifies N/A
+ * @return 'true' if both iterators point at the same bit.
+ */
+bool BitArrayList::const_iterator::operator==(const const_iterator &rhs) const {
+    return mList == rhs.mList && mIndex == rhs.mIndex;
+}
+
+/**
+ * Tests for iterator inequality.
+ * @param rhs The iterator to compare against.
+ * @modifies N/A
+ * @return 'true' if the iterators point at different bits.
+ */
+bool BitArrayList::const_iterator::operator!=(const const_iterator &rhs) const {
+    return !(*this == rhs);
+}
+
+/**
+ * Tests whether this iterator comes before another into the same list.
+ * @param rhs The iterator to compare against.
+ * @modifies N/A
+ * @return 'true' if this iterator points at an earlier bit.
+ */
+bool BitArrayList::const_iterator::operator<(const const_iterator &rhs) const {
+    return mIndex < rhs.mIndex;
+}
+
+/**
+ * Tests whether this iterator comes after another into the same list.
+ * @param rhs The iterator to compare against.
+ * @modifies N/A
+ * @return 'true' if this iterator points at a later bit.
+ */
+bool BitArrayList::const_iterator::operator>(const const_iterator &rhs) const {return rhs < *this;}
+
+/**
+ * Tests whether this iterator does not come after another into the same list.
+ * @param rhs The iterator to compare against.
+ * @modifies N/A
+ * @return 'true' if this iterator points at an earlier or the same bit.
+ */
+bool BitArrayList::const_iterator::operator<=(const const_iterator &rhs) const {
+    return !(rhs < *this);
+}
+
+/**
+ * Tests whether this iterator does not come before another into the same list.
+ * @param rhs The iterator to compare against.
+ * @modifies N/A
+ * @return 'true' if this iterator points at a later or the same bit.
+ */
+bool BitArrayList::const_iterator::operator>=(const const_iterator &rhs) const {
+    return !(*this < rhs);
+}
+
+/**
+ * Dereference operator.
+ * @param N/A
+ * @modifies N/A
+ * @return The bit pointed to.
+ */
+bool BitArrayList::const_iterator::operator*() const {return (*mList)[mIndex];}
+
+/**
+ * Subscript operator.
+ * @param offset The distance from this iterator to the bit.
+ * @modifies N/A
+ * @return The bit.
+ */
+bool BitArrayList::const_iterator::operator[](difference_type offset) const {
+    return *(*this + offset);
+}
+
+/**
+ * Preincrement operator.
+ * @param N/A
+ * @modifies Moves to the next bit.
+ * @return This iterator after the increment.
+ */
+BitArrayList::const_iterator &BitArrayList::const_iterator::operator++() {
+    ++mIndex;
+    return *this;
+}
+
+/**
+ * Postincrement operator.
+ * @param N/A
+ * @modifies Moves to the next bit.
+ * @return The iterator before the increment.
+ */
+BitArrayList::const_iterator BitArrayList::const_iterator::operator++(int) {
+    const_iterator previous = *this;
+    ++mIndex;
+    return previous;
+}
+
+/**
+ * Predecrement operator.
+ * @param N/A
+ * @modifies Moves to the previous bit.
+ * @return This iterator after the decrement.
+ */
+BitArrayList::const_iterator &BitArrayList::const_iterator::operator--() {
+    --mIndex;
+    return *this;
+}
+
+/**
+ * Postdecrement operator.
+ * @param N/A
+ * @modifies Moves to the previous bit.
+ * @return The iterator before the decrement.
+ */
+BitArrayList::const_iterator BitArrayList::const_iterator::operator--(int) {
+    const_iterator previous = *this;
+    --mIndex;
+    return previous;
+}
+
+/**
+ * Moves the iterator a number of bits forward.
+ * @param offset The distance to move forward, which may be negative.
+ * @modifies Moves to another bit.
+ * @return This iterator after the move.
+ */
+BitArrayList::const_iterator &BitArrayList::const_iterator::operator+=(difference_type offset) {
+    mIndex = static_cast<uint32_t>(static_cast<difference_type>(mIndex) + offset);
+    return *this;
+}
+
+/**
+ * Moves the iterator a number of bits back.
+ * @param offset The distance to move back, which may be negative.
+ * @modifies Moves to another bit.
+ * @return This iterator after the move.
+ */
+BitArrayList::const_iterator &BitArrayList::const_iterator::operator-=(difference_type offset) {
+    mIndex = static_cast<uint32_t>(static_cast<difference_type>(mIndex) - offset);
+    return *this;
+}
+
+/**
+ * Returns an iterator a number of bits forward.
+ * @param offset The distance to move forward.
+ * @modifies N/A
+ * @return The moved iterator.
+ */
+BitArrayList::const_iterator BitArrayList::const_iterator::operator+(difference_type offset) const {
+    const_iterator moved = *this;
+    return moved += offset;
+}
+
+/**
+ * Returns an iterator a number of bits back.
+ * @param offset The distance to move back.
+ * @modifies N/A
+ * @return The moved iterator.
+ */
+BitArrayList::const_iterator BitArrayList::const_iterator::operator-(difference_type offset) const {
+    const_iterator moved = *this;
+    return moved -= offset;
+}
+
+/**
+ * Iterator subtraction.
+ * @param rhs The iterator to subtract.
+ * @modifies N/A
+ * @return The distance between the iterators, which always fits since indices are 32-bit.
+ */
+BitArrayList::const_iterator::difference_type
+BitArrayList::const_iterator::operator-(const const_iterator &rhs) const {
+    return static_cast<difference_type>(mIndex) - static_cast<difference_type>(rhs.mIndex);
+}
+
+/**
+ * Returns an iterator a number of bits forward, with the offset first.
+ * @param offset The distance to move forward.
+ * @param it The iterator to move from.
+ * @modifies N/A
+ * @return The moved iterator.
+ */
+BitArrayList::const_iterator operator+(BitArrayList::const_iterator::difference_type offset,
+                                       const BitArrayList::const_iterator &it) {
+    return it + offset;
+}
+
+/**
+ * Constructor: Creates an empty BitArrayList.
+ * @param N/A
+ * @modifies Initializes an empty list without allocating.
+ * @return N/A
+ */
+BitArrayList::BitArrayList()
+    : mWords(nullptr),
+      mSize(0),
+      mCapacity(0) {}
+
+/**
+ * Constructor: Creates a BitArrayList with every bit set to one value.
+ * @param size The number of bits.
+ * @param value The value of every bit.
+ * @modifies Allocates exactly enough words for 'size' bits.
+ * @return N/A
+ */
+BitArrayList::BitArrayList(const uint32_t &size, bool value)
+    : mWords(new uint64_t[wordsFor(size)]()),
+      mSize(size),
+      mCapacity(wordsFor(size) * kWordBits) {
+    fill(value);
+}
+
+/**
+ * Copy Constructor: Creates a copy of an existing BitArrayList.
+ * @param src The BitArrayList to be copied.
+ * @modifies Allocates the same number of words as 'src' and copies them.
+ * @return N/A
+ */
+BitArrayList::BitArrayList(const BitArrayList &src)
+    : mWords(new uint64_t[src.mCapacity / kWordBits]()),
+      mSize(src.mSize),
+      mCapacity(src.mCapacity) {
+    std::copy(src.mWords.get(), src.mWords.get() + wordsFor(mSize), mWords.get());
+}
+
+/**
+ * Move Constructor: Creates a BitArrayList by taking over the words of another.
+ * @param src The BitArrayList to be moved.
+ * @modifies Leaves 'src' empty.
+ * @return N/A
+ */
+BitArrayList::BitArrayList(BitArrayList &&src) noexcept
+    : mWords(src.mWords.release()),
+      mSize(src.mSize),
+      mCapacity(src.mCapacity) {
+    src.mSize = src.mCapacity = 0;
+}
+
+/**
+ * Copy Assignment Operator: Makes this list a copy of another.
+ * @param src The BitArrayList to be copied.
+ * @modifies Replaces the contents of this list.
+ * @return A reference to this BitArrayList.
+ */
+BitArrayList &BitArrayList::operator=(const BitArrayList &src) {
+    if (this != &src) {
+        BitArrayList(src).swap(*this);
+    }
+    return *this;
+}
+
+/**
+ * Move Assignment Operator: Takes over the words of another BitArrayList.
+ * @param src The BitArrayList to be moved.
+ * @modifies Replaces the contents of this list and leaves 'src' empty.
+ * @return A reference to this BitArrayList.
+ */
+BitArrayList &BitArrayList::operator=(BitArrayList &&src) noexcept {
+    if (this != &src) {
+        this->swap(src);
+        src.clear();
+    }
+    return *this;
+}
+
+/**
+ * Adds a bit to the end of the list.
+ * @param value The bit to add.
+ * @modifies Sets or leaves clear the bit after the last one, growing if necessary.
+ * @return A reference to the capacity of the list in bits.
+ */
+const uint32_t &BitArrayList::add(bool value) {
+    return addWord(value ? 1 : 0, 1);
+}
+
+/**
+ * Adds up to 64 bits to the end of the list.
+ * @param word The bits to add, lowest bit first.
+ * @param count The number of bits to take from 'word'.
+ * @modifies Writes the bits into at most two words, growing if necessary.
+ * @throws std::invalid_argument if 'count' is greater than 64.
+ * @throws std::length_error if the list cannot hold 'count' more bits.
+ * @return A reference to the capacity of the list in bits.
+ */
+const uint32_t &BitArrayList::addWord(uint64_t word, uint32_t count) {
+    if (count > kWordBits)
+        throwInvalidArgument("count must not exceed 64");
+    if (count == 0)
+        return mCapacity;
+    if (count > UINT32_MAX - mSize)
+        throwLengthError("BitArrayList is full");
+
+    if (mSize + count > mCapacity) {
+        uint32_t words = mCapacity / kWordBits;
+        uint32_t needed = wordsFor(mSize + count);
+        if (needed > kMaxWords)
+            throwLengthError("BitArrayList is full");
+        reserveWords(std::min(std::max({words * 2, needed, 1U}), kMaxWords));
+    }
+
+    if (count < kWordBits)
+        word &= (uint64_t(1) << count) - 1;
+
+    uint32_t index = mSize / kWordBits;
+    uint32_t offset = mSize % kWordBits;
+    mWords[index] |= word << offset;
+    if (offset != 0 && offset + count > kWordBits)
+        mWords[index + 1] |= word >> (kWordBits - offset);
+
+    mSize += count;
+    return mCapacity;
+}
+
+/**
+ * Retrieves the bit at a specific index.
+ * @param index The index of the bit.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return The bit.
+ */
+bool BitArrayList::get(const uint32_t &index) const {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    return (*this)[index];
+}
+
+/**
+ * Sets the bit at a specific index.
+ * @param index The index of the bit.
+ * @param value The new value of the bit.
+ * @modifies Sets or clears one bit.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return N/A
+ */
+void BitArrayList::set(const uint32_t &index, bool value) {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    (*this)[index] = value;
+}
+
+/**
+ * Reads the bit at a specific index without range checking.
+ * @param index The index of the bit.
+ * @modifies N/A
+ * @return The bit.
+ */
+bool BitArrayList::operator[](const uint32_t &index) const {
+    return (mWords[index / kWordBits] >> (index % kWordBits)) & 1;
+}
+
+/**
+ * Returns a proxy to the bit at a specific index without range checking.
+ * @param index The index of the bit.
+ * @modifies N/A
+ * @return A proxy for the bit.
+ */
+BitArrayList::reference BitArrayList::operator[](const uint32_t &index) {
+    return reference(mWords.get() + index / kWordBits, uint64_t(1) << (index % kWordBits));
+}
+
+/**
+ * Sets every bit to one value.
+ * @param value The new value of every bit.
+ * @modifies Overwrites every word holding bits.
+ * @return N/A
+ */
+void BitArrayList::fill(bool value) {
+    std::fill(mWords.get(), mWords.get() + wordsFor(mSize), value ? ~uint64_t(0) : 0);
+    clearTail();
+}
+
+/**
+ * In-place bitwise and.
+ * @param rhs The other operand.
+ * @modifies Clears every bit that is clear in 'rhs'.
+ * @throws std::invalid_argument if the sizes differ.
+ * @return A reference to this BitArrayList.
+ */
+BitArrayList &BitArrayList::operator&=(const BitArrayList &rhs) {
+    checkSameSize(rhs);
+    uint64_t* words = mWords.get();
+    const uint64_t* other = rhs.mWords.get();
+    for (uint32_t i = 0; i < wordsFor(mSize); ++i)
+        words[i] &= other[i];
+    return *this;
+}
+
+/**
+ * In-place bitwise or.
+ * @param rhs The other operand.
+ * @modifies Sets every bit that is set in 'rhs'.
+ * @throws std::invalid_argument if the sizes differ.
+ * @return A reference to this BitArrayList.
+ */
+BitArrayList &BitArrayList::operator|=(const BitArrayList &rhs) {
+    checkSameSize(rhs);
+    uint64_t* words = mWords.get();
+    const uint64_t* other = rhs.mWords.get();
+    for (uint32_t i = 0; i < wordsFor(mSize); ++i)
+        words[i] |= other[i];
+    return *this;
+}
+
+/**
+ * In-place bitwise xor.
+ * @param rhs The other operand.
+ * @modifies Toggles every bit that is set in 'rhs'.
+ * @throws std::invalid_argument if the sizes differ.
+ * @return A reference to this BitArrayList.
+ */
+BitArrayList &BitArrayList::operator^=(const BitArrayList &rhs) {
+    checkSameSize(rhs);
+    uint64_t* words = mWords.get();
+    const uint64_t* other = rhs.mWords.get();
+    for (uint32_t i = 0; i < wordsFor(mSize); ++i)
+        words[i] ^= other[i];
+    return *this;
+}
+
+/**
+ * Inverts every bit in place.
+ * @param N/A
+ * @modifies Toggles every bit, keeping the bits past size() clear.
+ * @return A reference to this BitArrayList.
+ */
+BitArrayList &BitArrayList::flip() {
+    uint64_t* words = mWords.get();
+    for (uint32_t i = 0; i < wordsFor(mSize); ++i)
+        words[i] = ~words[i];
+    clearTail();
+    return *this;
+}
+
+/**
+ * Counts the set bits a word at a time.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of set bits.
+ */
+uint32_t BitArrayList::count() const {
+    uint32_t total = 0;
+    const uint64_t* words = mWords.get();
+    for (uint32_t i = 0; i < wordsFor(mSize); ++i)
+        total += popcount(words[i]);
+    return total;
+}
+
+/**
+ * Finds the first set bit.
+ * @param N/A
+ * @modifies N/A
+ * @return The index of the bit, or npos if no bit is set.
+ */
+uint32_t BitArrayList::findFirst() const {
+    const uint64_t* words = mWords.get();
+    for (uint32_t i = 0; i < wordsFor(mSize); ++i) {
+        if (words[i] != 0)
+            return i * kWordBits + lowestSetBit(words[i]);
+    }
+    return npos;
+}
+
+/**
+ * Finds the first set bit after a position.
+ * @param index The position to search after.
+ * @modifies N/A
+ * @return The index of the bit, or npos if no later bit is set.
+ */
+uint32_t BitArrayList::findNext(const uint32_t &index) const {
+    if (index >= mSize || index + 1 >= mSize)
+        return npos;
+
+    uint32_t next = index + 1;
+    uint32_t i = next / kWordBits;
+    const uint64_t* words = mWords.get();
+    uint64_t word = words[i] & (~uint64_t(0) << (next % kWordBits));
+    while (word == 0) {
+        if (++i == wordsFor(mSize))
+            return npos;
+        word = words[i];
+    }
+    return i * kWordBits + lowestSetBit(word);
+}
+
+/**
+ * Returns an iterator to the first bit.
+ * @param N/A
+ * @modifies N/A
+ * @return An iterator to the beginning of this list.
+ */
+BitArrayList::iterator BitArrayList::begin() {return iterator(this, 0);}
+
+/**
+ * Returns the past-the-end iterator.
+ * @param N/A
+ * @modifies N/A
+ * @return A past-the-end iterator of this list.
+ */
+BitArrayList::iterator BitArrayList::end() {return iterator(this, mSize);}
+
+/**
+ * Returns a constant iterator to the first bit.
+ * @param N/A
+ * @modifies N/A
+ * @return An iterator at index 0.
+ */
+BitArrayList::const_iterator BitArrayList::begin() const {return const_iterator(this, 0);}
+
+/**
+ * Returns the past-the-end constant iterator.
+ * @param N/A
+ * @modifies N/A
+ * @return An iterator at index size().
+ */
+BitArrayList::const_iterator BitArrayList::end() const {return const_iterator(this, mSize);}
+
+/**
+ * Returns a constant iterator to the first bit.
+ * @param N/A
+ * @modifies N/A
+ * @return An iterator at index 0.
+ */
+BitArrayList::const_iterator BitArrayList::cbegin() const {return begin();}
+
+/**
+ * Returns the past-the-end constant iterator.
+ * @param N/A
+ * @modifies N/A
+ * @return An iterator at index size().
+ */
+BitArrayList::const_iterator BitArrayList::cend() const {return end();}
+
+/**
+ * Returns the packed words.
+ * @param N/A
+ * @modifies N/A
+ * @return A pointer to the first word.
+ */
+const uint64_t* BitArrayList::words() const {return mWords.get();}
+
+/**
+ * Returns the number of words holding bits.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of words holding bits.
+ */
+uint32_t BitArrayList::wordCount() const {return wordsFor(mSize);}
+
+/**
+ * Clears the list, releasing its words.
+ * @param N/A
+ * @modifies Deallocates the words and resets the size and capacity.
+ * @return N/A
+ */
+void BitArrayList::clear() {
+    mWords.reset();
+    mSize = mCapacity = 0;
+}
+
+/**
+ * Checks if the list is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the list is empty, 'false' otherwise.
+ */
+bool BitArrayList::isEmpty() const {return mSize == 0;}
+
+/**
+ * Returns the number of bits.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of bits.
+ */
+uint32_t BitArrayList::size() const {return mSize;}
+
+/**
+ * Swaps the contents of two BitArrayList objects.
+ * @param src The BitArrayList to swap content with.
+ * @modifies Exchanges the words, size, and capacity between this and 'src'.
+ * @return N/A
+ */
+void BitArrayList::swap(BitArrayList &src) noexcept {
+    std::swap(mSize, src.mSize);
+    std::swap(mCapacity, src.mCapacity);
+    mWords.swap(src.mWords);
+}
+
+/**
+ * Moves the bits into a larger, zeroed block of words.
+ * @param words The number of words to allocate.
+ * @modifies Replaces the words and the capacity.
+ * @return N/A
+ */
+void BitArrayList::reserveWords(uint32_t words) {
+    ScopedArray<uint64_t> newWords(new uint64_t[words]());
+    std::copy(mWords.get(), mWords.get() + wordsFor(mSize), newWords.get());
+    mWords.swap(newWords);
+    mCapacity = words * kWordBits;
+}
+
+/**
+ * Checks that another list has the same number of bits.
+ * @param rhs The other list.
+ * @modifies N/A
+ * @throws std::invalid_argument if the sizes differ.
+ * @return N/A
+ */
+void BitArrayList::checkSameSize(const BitArrayList &rhs) const {
+    if (mSize != rhs.mSize)
+        throwInvalidArgument("BitArrayList sizes differ");
+}
+
+/**
+ * Clears the unused bits of the last word so that counting and searching never see them.
+ * @param N/A
+ * @modifies Clears the bits past size() in the last word.
+ * @return N/A
+ */
+void BitArrayList::clearTail() {
+    if (mSize % kWordBits != 0)
+        mWords[mSize / kWordBits] &= (uint64_t(1) << (mSize % kWordBits)) - 1;
+}
+
+/**
+ * Bitwise and of two lists.
+ * @param lhs The first operand.
+ * @param rhs The second operand.
+ * @modifies N/A
+ * @throws std::invalid_argument if the sizes differ.
+ * @return A new list holding 'lhs' & 'rhs'.
+ */
+BitArrayList operator&(const BitArrayList &lhs, const BitArrayList &rhs) {
+    BitArrayList result(lhs);
+    result &= rhs;
+    return result;
+}
+
+/**
+ * Bitwise or of two lists.
+ * @param lhs The first operand.
+ * @param rhs The second operand.
+ * @modifies N/A
+ * @throws std::invalid_argument if the sizes differ.
+ * @return A new list holding 'lhs' | 'rhs'.
+ */
+BitArrayList operator|(const BitArrayList &lhs, const BitArrayList &rhs) {
+    BitArrayList result(lhs);
+    result |= rhs;
+    return result;
+}
+
+/**
+ * Bitwise xor of two lists.
+ * @param lhs The first operand.
+ * @param rhs The second operand.
+ * @modifies N/A
+ * @throws std::invalid_argument if the sizes differ.
+ * @return A new list holding 'lhs' ^ 'rhs'.
+ */
+BitArrayList operator^(const BitArrayList &lhs, const BitArrayList &rhs) {
+    BitArrayList result(lhs);
+    result ^= rhs;
+    return result;
+}
+
+/**
+ * Bitwise not of a list.
+ * @param list The operand.
+ * @modifies N/A
+ * @return A new list holding ~'list'.
+ */
+BitArrayList operator~(const BitArrayList &list) {
+    BitArrayList result(list);
+    result.flip();
+    return result;
+}
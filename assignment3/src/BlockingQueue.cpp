@@ -0,0 +1,173 @@
+// Author: Mac-Noble Brako-Kusi
+// File: BlockingQueue.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for BlockingQueue template class
+
+/**
+ * Constructor: Creates an open, empty BlockingQueue.
+ * @param capacity The least number of elements the queue can hold.
+ * @modifies Creates the wrapped queue.
+ * @throws Whatever the wrapped queue's constructor throws.
+ * @return N/A
+ */
+template<typename Queue>
+BlockingQueue<Queue>::BlockingQueue(uint32_t capacity)
+    : mQueue(capacity),
+      mClosed(false),
+      mPushed(0),
+      mConsumersAsleep(0),
+      mPopped(0),
+      mProducersAsleep(0) {}
+
+/**
+ * Appends an element, waiting while the queue is full.
+ * @param value The element to append.
+ * @modifies Publishes the element, waking a sleeping consumer.
+ * @return 'true' if the element was appended, 'false' if the queue is closed.
+ */
+template<typename Queue>
+bool BlockingQueue<Queue>::push(const value_type &value) {
+    return pushBatch(&value, 1) == 1;
+}
+
+/**
+ * Appends every provided element, waiting for room as needed.
+ * @param values The elements to append.
+ * @param count The number of elements.
+ * @modifies Publishes the elements, waking sleeping consumers.
+ * @return The number of elements appended.
+ */
+template<typename Queue>
+uint32_t BlockingQueue<Queue>::pushBatch(const value_type *values, uint32_t count) {
+    uint32_t pushed = 0;
+    while (pushed < count) {
+        uint32_t added = await(mPopped, mProducersAsleep, [&]() {
+            return mClosed.load(std::memory_order_acquire)
+                   ? UINT32_MAX : mQueue.tryPushBatch(values + pushed, count - pushed);
+        });
+        if (added == UINT32_MAX)
+            break;
+        pushed += added;
+        signal(mPushed, mConsumersAsleep, added);
+    }
+    return pushed;
+}
+
+/**
+ * Removes the oldest element, waiting while the queue is empty.
+ * @param out Receives the element.
+ * @modifies Frees the element's slot, waking a sleeping producer.
+ * @return 'true' if an element was removed, 'false' if the queue is closed and drained.
+ */
+template<typename Queue>
+bool BlockingQueue<Queue>::pop(value_type &out) {return popBatch(&out, 1) == 1;}
+
+/**
+ * Removes between one and a number of the oldest elements, waiting while the queue is empty.
+ * @param out Receives the elements.
+ * @param max The most elements to remove.
+ * @modifies Frees the elements' slots, waking sleeping producers.
+ * @return The number of elements removed.
+ */
+template<typename Queue>
+uint32_t BlockingQueue<Queue>::popBatch(value_type *out, uint32_t max) {
+    if (max == 0)
+        return 0;
+
+    uint32_t removed = await(mPushed, mConsumersAsleep, [&]() {
+        uint32_t popped = mQueue.tryPopBatch(out, max);
+        if (popped > 0 || !mClosed.load(std::memory_order_acquire))
+            return popped;
+        // Closed: one more pop, so that nothing pushed before close() is left behind
+        popped = mQueue.tryPopBatch(out, max);
+        return popped > 0 ? popped : UINT32_MAX;
+    });
+    if (removed == UINT32_MAX)
+        return 0;
+
+    signal(mPopped, mProducersAsleep, removed);
+    return removed;
+}
+
+/**
+ * Closes the queue.
+ * @param N/A
+ * @modifies Marks the queue closed and wakes every sleeping thread.
+ * @return N/A
+ */
+template<typename Queue>
+void BlockingQueue<Queue>::close() {
+    mClosed.store(true, std::memory_order_seq_cst);
+    mPushed.fetch_add(1, std::memory_order_seq_cst);
+    mPopped.fetch_add(1, std::memory_order_seq_cst);
+    Futex::wake(mPushed);
+    Futex::wake(mPopped);
+}
+
+/**
+ * Checks if the queue is closed.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' once close() has been called.
+ */
+template<typename Queue>
+bool BlockingQueue<Queue>::isClosed() const {return mClosed.load(std::memory_order_acquire);}
+
+/**
+ * Repeats an attempt until it makes progress, spinning briefly, then yielding the processor a few
+ * times in case the other side is waiting for it, and then sleeping on an event word. A sleeper
+ * registers before reading the word and retries once more before sleeping; a signaller changes
+ * the queue before checking for sleepers. With both sides fenced, either the retry sees the
+ * change or the signaller sees the sleeper, so no wake is lost.
+ * @param event The word the other side bumps when this side may progress.
+ * @param sleepers The count of this side's sleepers.
+ * @param attempt Returns the number of elements handled, 0 to wait, or UINT32_MAX to give up.
+ * @modifies Whatever 'attempt' does.
+ * @return The first nonzero result of 'attempt'.
+ */
+template<typename Queue>
+template<typename Attempt>
+uint32_t BlockingQueue<Queue>::await(std::atomic<uint32_t> &event, std::atomic<uint32_t> &sleepers,
+                                     Attempt attempt) {
+    const uint32_t kSpins = 100;
+    const uint32_t kYields = 4;
+    for (uint32_t spins = 0; spins < kSpins + kYields; ++spins) {
+        if (uint32_t result = attempt())
+            return result;
+        if (spins < kSpins)
+            Futex::pause();
+        else
+            std::this_thread::yield();
+    }
+
+    while (true) {
+        sleepers.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        uint32_t seen = event.load(std::memory_order_seq_cst);
+        uint32_t result = attempt();
+        if (result == 0)
+            Futex::wait(event, seen);
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+        if (result != 0)
+            return result;
+    }
+}
+
+/**
+ * Tells the other side that this side made progress, waking its sleepers if it has any.
+ * @param event The word the other side sleeps on.
+ * @param sleepers The count of the other side's sleepers.
+ * @param count The number of elements handled, the most sleepers that can use them.
+ * @modifies Bumps 'event' if anyone sleeps on it.
+ * @return N/A
+ */
+template<typename Queue>
+void BlockingQueue<Queue>::signal(std::atomic<uint32_t> &event, std::atomic<uint32_t> &sleepers,
+                                  uint32_t count) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepers.load(std::memory_order_relaxed) == 0)
+        return;
+
+    event.fetch_add(1, std::memory_order_seq_cst);
+    Futex::wake(event, count);
+}
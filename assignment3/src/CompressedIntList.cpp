@@ -0,0 +1,386 @@
+// Author: Mac-Noble Brako-Kusi
+// File: CompressedIntList.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for CompressedIntList class
+
+#include "CompressedIntList.h"
+#include "ContainerError.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+
+namespace {
+const uint32_t kLanes = 4;
+const uint32_t kSlots = CompressedIntList::kBlockSize / kLanes;
+
+/**
+ * Four 64-bit values, one per lane, operated on together.
+ */
+typedef uint64_t Lanes __attribute__((vector_size(kLanes * sizeof(uint64_t))));
+
+// Lanes are passed by reference: by value, their ABI would depend on whether AVX is enabled
+void load(Lanes& lanes, const uint64_t* in) {
+    std::memcpy(&lanes, in, sizeof(lanes));
+}
+
+void store(uint64_t* out, const Lanes& lanes) {
+    std::memcpy(out, &lanes, sizeof(lanes));
+}
+
+uint32_t bitsFor(uint64_t value) {
+    return value == 0 ? 0 : 64 - static_cast<uint32_t>(__builtin_clzll(value));
+}
+
+/**
+ * Packs a block of values, each less than 2^Width, into 4 * Width words. Slot s of every lane is
+ * written at bit s * Width of its lane, and word j of lane l lands at out[4 * j + l]. With the
+ * width fixed and the loop unrolled, every shift is a constant.
+ */
+template<uint32_t Width> void packWidth(const uint64_t* in, uint64_t* out) {
+    if constexpr (Width > 0) {
+        Lanes word = {0, 0, 0, 0};
+        uint32_t position = 0;
+#pragma GCC unroll 64
+        for (uint32_t slot = 0; slot < kSlots; ++slot) {
+            Lanes values;
+            load(values, in + slot * kLanes);
+            word |= values << position;
+            position += Width;
+            if (position >= 64) {
+                store(out, word);
+                out += kLanes;
+                position -= 64;
+                word = position == 0 ? Lanes{0, 0, 0, 0} : values >> (Width - position);
+            }
+        }
+    }
+}
+
+/**
+ * Unpacks a block packed by packWidth<Width>() into kBlockSize values.
+ */
+template<uint32_t Width> void unpackWidth(const uint64_t* in, uint64_t* out) {
+    if constexpr (Width == 0) {
+        std::fill(out, out + CompressedIntList::kBlockSize, 0);
+    } else {
+        const uint64_t mask = Width == 64 ? ~uint64_t(0) : (uint64_t(1) << (Width % 64)) - 1;
+        Lanes word;
+        load(word, in);
+        uint32_t position = 0;
+#pragma GCC unroll 64
+        for (uint32_t slot = 0; slot < kSlots; ++slot) {
+            Lanes values = word >> position;
+            position += Width;
+            if (position >= 64) {
+                position -= 64;
+                // The last slot ends exactly on the last word, so there is no next word to load
+                if (slot + 1 < kSlots) {
+                    in += kLanes;
+                    load(word, in);
+                }
+                if (position != 0)
+                    values |= word << (Width - position);
+            }
+            store(out + slot * kLanes, values & mask);
+        }
+    }
+}
+
+/**
+ * Sums the first slots of one lane of a block packed by packWidth<Width>(), reading the lane
+ * alone. in points at the lane's first word. Every slot is extracted, at constant shifts, and
+ * those past the wanted ones are masked out, which is cheaper than a loop of unpredictable
+ * length.
+ */
+template<uint32_t Width> uint64_t sumLane(const uint64_t* in, uint32_t slots) {
+    if constexpr (Width == 0) {
+        return 0;
+    } else {
+        const uint64_t mask = Width == 64 ? ~uint64_t(0) : (uint64_t(1) << (Width % 64)) - 1;
+        uint64_t sum = 0;
+#pragma GCC unroll 64
+        for (uint32_t slot = 0; slot < kSlots; ++slot) {
+            uint32_t bit = slot * Width;
+            uint64_t value = in[bit / 64 * kLanes] >> (bit % 64);
+            if (bit % 64 + Width > 64)
+                value |= in[(bit / 64 + 1) * kLanes] << (64 - bit % 64);
+            sum += value & mask & (slot < slots ? ~uint64_t(0) : 0);
+        }
+        return sum;
+    }
+}
+
+typedef void (*PackFunction)(const uint64_t* in, uint64_t* out);
+
+template<size_t... Widths> constexpr std::array<PackFunction, sizeof...(Widths)>
+packTable(std::index_sequence<Widths...>) {
+    return {&packWidth<Widths>...};
+}
+
+template<size_t... Widths> constexpr std::array<PackFunction, sizeof...(Widths)>
+unpackTable(std::index_sequence<Widths...>) {
+    return {&unpackWidth<Widths>...};
+}
+
+typedef uint64_t (*SumFunction)(const uint64_t* in, uint32_t slots);
+
+template<size_t... Widths> constexpr std::array<SumFunction, sizeof...(Widths)>
+sumTable(std::index_sequence<Widths...>) {
+    return {&sumLane<Widths>...};
+}
+
+// The kernels of every width from 0 to 64, indexed by width
+const std::array<PackFunction, 65> kPack = packTable(std::make_index_sequence<65>());
+const std::array<PackFunction, 65> kUnpack = unpackTable(std::make_index_sequence<65>());
+const std::array<SumFunction, 65> kSumLane = sumTable(std::make_index_sequence<65>());
+} // Namespace
+
+/**
+ * Constructor: Creates an empty CompressedIntList.
+ * @param N/A
+ * @modifies Initializes an empty list.
+ * @return N/A
+ */
+CompressedIntList::CompressedIntList()
+    : mWords(),
+      mBlocks(),
+      mTail(),
+      mSize(0) {}
+
+/**
+ * Constructor: Creates a CompressedIntList from an ArrayList.
+ * @param values The values, in order.
+ * @modifies Compresses every full block of 'values'.
+ * @return N/A
+ */
+CompressedIntList::CompressedIntList(const ArrayList<uint64_t> &values)
+    : CompressedIntList() {
+    for (uint32_t i = 0; i < values.size(); ++i)
+        add(values[i]);
+}
+
+/**
+ * Adds a value to the end of the list.
+ * @param value The value to add.
+ * @modifies Appends 'value', sealing the unsealed values into a block once there are kBlockSize.
+ * @throws std::length_error if the list is full.
+ * @return N/A
+ */
+void CompressedIntList::add(uint64_t value) {
+    if (mSize == UINT32_MAX)
+        throwLengthError("CompressedIntList is full");
+    if (mTail.isEmpty())
+        mTail = ArrayList<uint64_t>::forOverwrite(kBlockSize);
+
+    mTail[mSize % kBlockSize] = value;
+    ++mSize;
+    if (mSize % kBlockSize == 0)
+        seal();
+}
+
+/**
+ * Retrieves the value at a specific index.
+ * @param index The index of the value to retrieve.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return The value at the specified index.
+ */
+uint64_t CompressedIntList::get(uint32_t index) const {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    return (*this)[index];
+}
+
+/**
+ * Retrieves the value at a specific index without range checking.
+ * @param index The index of the value to retrieve.
+ * @modifies N/A
+ * @return The value at the specified index.
+ */
+uint64_t CompressedIntList::operator[](uint32_t index) const {
+    uint32_t block = index / kBlockSize;
+    if (block == mBlocks.size())
+        return mTail[index % kBlockSize];
+
+    return extract(block, index % kBlockSize);
+}
+
+/**
+ * Decodes a range of values.
+ * @param first The index of the first value.
+ * @param count The number of values.
+ * @param out Receives the values.
+ * @modifies Writes 'count' values to 'out'.
+ * @throws std::out_of_range if the range goes past the end of the list.
+ * @return N/A
+ */
+void CompressedIntList::decode(uint32_t first, uint32_t count, uint64_t *out) const {
+    if (uint64_t(first) + count > mSize)
+        throwOutOfRange(uint64_t(first) + count - 1);
+
+    uint64_t values[kBlockSize];
+    while (count > 0) {
+        uint32_t block = first / kBlockSize;
+        uint32_t offset = first % kBlockSize;
+        uint32_t taken = std::min(count, kBlockSize - offset);
+        if (block == mBlocks.size()) {
+            std::copy(mTail.data() + offset, mTail.data() + offset + taken, out);
+        } else if (taken == kBlockSize) {
+            decodeBlock(block, out);
+        } else {
+            decodeBlock(block, values);
+            std::copy(values + offset, values + offset + taken, out);
+        }
+        first += taken;
+        count -= taken;
+        out += taken;
+    }
+}
+
+/**
+ * Returns the values as an ArrayList.
+ * @param N/A
+ * @modifies N/A
+ * @return The decoded list.
+ */
+ArrayList<uint64_t> CompressedIntList::toArrayList() const {
+    ArrayList<uint64_t> values = ArrayList<uint64_t>::forOverwrite(mSize);
+    decode(0, mSize, values.data());
+    return values;
+}
+
+/**
+ * Returns the number of values.
+ * @param N/A
+ * @modifies N/A
+ * @return The size of the list.
+ */
+uint32_t CompressedIntList::size() const {return mSize;}
+
+/**
+ * Checks if the list is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the list holds no values, 'false' otherwise.
+ */
+bool CompressedIntList::isEmpty() const {return mSize == 0;}
+
+/**
+ * Clears the list.
+ * @param N/A
+ * @modifies Frees the blocks and the unsealed values.
+ * @return N/A
+ */
+void CompressedIntList::clear() {
+    mWords.clear();
+    mBlocks.clear();
+    mTail.clear();
+    mSize = 0;
+}
+
+/**
+ * Returns the bytes this list has allocated.
+ * @param N/A
+ * @modifies N/A
+ * @return The memory footprint in bytes.
+ */
+size_t CompressedIntList::memoryFootprint() const {
+    return mWords.memoryFootprint() + mBlocks.memoryFootprint() + mTail.memoryFootprint();
+}
+
+/**
+ * Compresses the kBlockSize unsealed values into a block, choosing the encoding with the
+ * narrower width: differences from the minimum, or, for a non-decreasing block, differences
+ * from the value four places earlier, the first four taken from the first value.
+ * @param N/A
+ * @modifies Appends the block and its words; the unsealed values are then free to overwrite.
+ * @return N/A
+ */
+void CompressedIntList::seal() {
+    const uint64_t* values = mTail.data();
+    uint64_t minimum = values[0];
+    uint64_t maximum = values[0];
+    bool sorted = true;
+    uint64_t widestDelta = 0;
+    for (uint32_t i = 1; i < kBlockSize; ++i) {
+        minimum = std::min(minimum, values[i]);
+        maximum = std::max(maximum, values[i]);
+        sorted = sorted && values[i - 1] <= values[i];
+        widestDelta |= values[i] - values[i < kLanes ? 0 : i - kLanes];
+    }
+
+    Block block;
+    block.offset = mWords.size();
+    block.width = static_cast<uint8_t>(bitsFor(maximum - minimum));
+    block.delta = sorted && bitsFor(widestDelta) < block.width;
+    if (block.delta)
+        block.width = static_cast<uint8_t>(bitsFor(widestDelta));
+    block.base = block.delta ? values[0] : minimum;
+
+    uint64_t residuals[kBlockSize];
+    for (uint32_t i = 0; i < kBlockSize; ++i) {
+        uint64_t reference = !block.delta ? minimum : values[i < kLanes ? 0 : i - kLanes];
+        residuals[i] = values[i] - reference;
+    }
+    uint64_t words[kLanes * 64];
+    kPack[block.width](residuals, words);
+    for (uint32_t i = 0; i < kLanes * block.width; ++i)
+        mWords.add(words[i]);
+    mBlocks.add(block);
+}
+
+/**
+ * Decodes a whole block: unpacks the residuals into 'out', then adds the minimum to each, or
+ * runs the prefix sum of each lane from the first value.
+ * @param block The block number.
+ * @param out Receives kBlockSize values.
+ * @modifies Writes the values to 'out'.
+ * @return N/A
+ */
+void CompressedIntList::decodeBlock(uint32_t block, uint64_t *out) const {
+    const Block& header = mBlocks[block];
+    kUnpack[header.width](mWords.data() + header.offset, out);
+
+    const uint64_t base = header.base;
+    Lanes sum = {base, base, base, base};
+    for (uint32_t slot = 0; slot < kSlots; ++slot) {
+        Lanes residuals;
+        load(residuals, out + slot * kLanes);
+        if (header.delta) {
+            sum += residuals;
+            store(out + slot * kLanes, sum);
+        } else {
+            store(out + slot * kLanes, residuals + base);
+        }
+    }
+}
+
+/**
+ * Decodes one value of a block: a single residual for frame of reference; for delta, the
+ * residuals of its lane up to it, summed onto the first value.
+ * @param block The block number.
+ * @param index The index of the value within the block.
+ * @modifies N/A
+ * @return The value.
+ */
+uint64_t CompressedIntList::extract(uint32_t block, uint32_t index) const {
+    const Block& header = mBlocks[block];
+    const uint32_t width = header.width;
+    const uint64_t* in = mWords.data() + header.offset + index % kLanes;
+    if (header.delta)
+        return header.base + kSumLane[width](in, index / kLanes + 1);
+    if (width == 0)
+        return header.base;
+
+    uint32_t bit = index / kLanes * width;
+    uint32_t word = bit / 64;
+    uint32_t shift = bit % 64;
+    uint64_t residual = in[word * kLanes] >> shift;
+    if (shift + width > 64)
+        residual |= in[(word + 1) * kLanes] << (64 - shift);
+    if (width < 64)
+        residual &= (uint64_t(1) << width) - 1;
+    return header.base + residual;
+}
@@ -0,0 +1,353 @@
+// Author: Mac-Noble Brako-Kusi
+// File: DictionaryList.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for DictionaryList class
+
+#include "DictionaryList.h"
+#include "ContainerError.h"
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+namespace {
+/**
+ * The code type of a code array.
+ */
+template<typename Codes> using CodeOf = std::decay_t<decltype(*std::declval<Codes&>().data())>;
+
+/**
+ * Copies a code array into a wider one.
+ */
+template<typename To, typename From> ArrayList<To> widen(const ArrayList<From>& codes) {
+    ArrayList<To> wider = ArrayList<To>::forOverwrite(codes.size());
+    std::copy(codes.data(), codes.data() + codes.size(), wider.data());
+    return wider;
+}
+
+/**
+ * Sets a bit for every code equal to 'code', building the result a word at a time. The inner
+ * loop has no branches, so the compiler vectorizes it.
+ */
+template<typename Code> BitArrayList matchCodes(const ArrayList<Code>& codes, Code code) {
+    const uint32_t size = codes.size();
+    const Code* data = codes.data();
+    BitArrayList matches;
+    for (uint32_t base = 0; base < size; base += 64) {
+        uint32_t count = std::min<uint32_t>(64, size - base);
+        uint64_t word = 0;
+        for (uint32_t i = 0; i < count; ++i)
+            word |= uint64_t(data[base + i] == code) << i;
+        matches.addWord(word, count);
+    }
+    return matches;
+}
+} // Namespace
+
+/**
+ * Constructor: Creates an empty DictionaryList.
+ * @param N/A
+ * @modifies Starts with 8-bit codes and no dictionary.
+ * @return N/A
+ */
+DictionaryList::DictionaryList()
+    : mStrings(),
+      mDictionary(),
+      mIndex(),
+      mCodes() {}
+
+/**
+ * Constructor: Creates a DictionaryList from an ArrayList of strings.
+ * @param values The strings, in order.
+ * @modifies Encodes every string of 'values'.
+ * @return N/A
+ */
+DictionaryList::DictionaryList(const ArrayList<std::string> &values)
+    : DictionaryList() {
+    for (uint32_t i = 0; i < values.size(); ++i)
+        add(values[i]);
+}
+
+/**
+ * Copy Constructor: Creates a copy of another DictionaryList.
+ * @param src The list to copy.
+ * @modifies Copies the dictionary and the codes, and indexes the copied dictionary.
+ * @return N/A
+ */
+DictionaryList::DictionaryList(const DictionaryList &src)
+    : mStrings(),
+      mDictionary(),
+      mIndex(),
+      mCodes(src.mCodes) {
+    copyDictionary(src);
+}
+
+/**
+ * Copy Assignment Operator: Replaces the contents with a copy of another DictionaryList.
+ * @param src The list to copy.
+ * @modifies Replaces the dictionary and the codes; unchanged if the copy throws.
+ * @return A reference to this list.
+ */
+DictionaryList &DictionaryList::operator=(const DictionaryList &src) {
+    if (this != &src)
+        *this = DictionaryList(src);
+    return *this;
+}
+
+/**
+ * Adds a string to the end of the list.
+ * @param value The string to add.
+ * @modifies Appends the code of 'value', entering it in the dictionary if it is new.
+ * @throws std::length_error if the list is full.
+ * @return N/A
+ */
+void DictionaryList::add(std::string_view value) {
+    if (size() == UINT32_MAX)
+        throwLengthError("DictionaryList is full");
+
+    uint32_t code = encode(value);
+    std::visit([code](auto& codes) {
+        codes.add(static_cast<CodeOf<decltype(codes)>>(code));
+    }, mCodes);
+}
+
+/**
+ * Retrieves the string at a specific index.
+ * @param index The index of the string to retrieve.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return A view of the string.
+ */
+std::string_view DictionaryList::get(uint32_t index) const {
+    if (index >= size())
+        throwOutOfRange(index);
+
+    return (*this)[index];
+}
+
+/**
+ * Retrieves the string at a specific index without range checking.
+ * @param index The index of the string to retrieve.
+ * @modifies N/A
+ * @return A view of the string.
+ */
+std::string_view DictionaryList::operator[](uint32_t index) const {return mDictionary[code(index)];}
+
+/**
+ * Replaces the string at a specific index.
+ * @param index The index of the string to replace.
+ * @param value The new string.
+ * @modifies Changes the code at 'index', entering 'value' in the dictionary if it is new.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return N/A
+ */
+void DictionaryList::set(uint32_t index, std::string_view value) {
+    if (index >= size())
+        throwOutOfRange(index);
+
+    uint32_t code = encode(value);
+    std::visit([index, code](auto& codes) {
+        codes[index] = static_cast<CodeOf<decltype(codes)>>(code);
+    }, mCodes);
+}
+
+/**
+ * Retrieves the code at a specific index without range checking.
+ * @param index The index of the code to retrieve.
+ * @modifies N/A
+ * @return The code at the specified index.
+ */
+uint32_t DictionaryList::code(uint32_t index) const {
+    return std::visit([index](const auto& codes) -> uint32_t {return codes[index];}, mCodes);
+}
+
+/**
+ * Looks a string up in the dictionary.
+ * @param value The string to look up.
+ * @modifies N/A
+ * @return The code of 'value', or npos if it is not in the dictionary.
+ */
+uint32_t DictionaryList::codeOf(std::string_view value) const {
+    if (!mIndex)
+        return npos;
+
+    const uint32_t* found = mIndex->find(value);
+    return found ? *found : npos;
+}
+
+/**
+ * Retrieves the string a code stands for.
+ * @param code The code, less than dictionarySize().
+ * @modifies N/A
+ * @return A view of the string.
+ */
+std::string_view DictionaryList::decode(uint32_t code) const {return mDictionary[code];}
+
+/**
+ * Returns the number of strings in the dictionary.
+ * @param N/A
+ * @modifies N/A
+ * @return The size of the dictionary.
+ */
+uint32_t DictionaryList::dictionarySize() const {return mDictionary.size();}
+
+/**
+ * Returns the width of the codes.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of bytes per code.
+ */
+uint32_t DictionaryList::codeBytes() const {
+    return std::visit([](const auto& codes) -> uint32_t {
+        return sizeof(CodeOf<decltype(codes)>);
+    }, mCodes);
+}
+
+/**
+ * Finds the elements equal to a string. The string is looked up once; the scan compares codes.
+ * @param value The string to look for.
+ * @modifies N/A
+ * @return A BitArrayList with a bit set for every element equal to 'value'.
+ */
+BitArrayList DictionaryList::equals(std::string_view value) const {
+    uint32_t code = codeOf(value);
+    if (code == npos)
+        return BitArrayList(size(), false);
+
+    return std::visit([code](const auto& codes) {
+        return matchCodes(codes, static_cast<CodeOf<decltype(codes)>>(code));
+    }, mCodes);
+}
+
+/**
+ * Counts the elements equal to a string. The string is looked up once; the scan compares codes.
+ * @param value The string to look for.
+ * @modifies N/A
+ * @return The number of elements equal to 'value'.
+ */
+uint32_t DictionaryList::count(std::string_view value) const {
+    uint32_t code = codeOf(value);
+    if (code == npos)
+        return 0;
+
+    return std::visit([code](const auto& codes) -> uint32_t {
+        const auto* data = codes.data();
+        return static_cast<uint32_t>(std::count(data, data + codes.size(), code));
+    }, mCodes);
+}
+
+/**
+ * Decodes the list into an ArrayList of strings.
+ * @param N/A
+ * @modifies N/A
+ * @return The strings, in order.
+ */
+ArrayList<std::string> DictionaryList::toArrayList() const {
+    ArrayList<std::string> values(size());
+    for (uint32_t i = 0; i < values.size(); ++i)
+        values[i].assign((*this)[i]);
+    return values;
+}
+
+/**
+ * Returns the number of elements.
+ * @param N/A
+ * @modifies N/A
+ * @return The size of the list.
+ */
+uint32_t DictionaryList::size() const {
+    return std::visit([](const auto& codes) {return codes.size();}, mCodes);
+}
+
+/**
+ * Checks if the list is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the list is empty, 'false' otherwise.
+ */
+bool DictionaryList::isEmpty() const {return size() == 0;}
+
+/**
+ * Clears the list and its dictionary.
+ * @param N/A
+ * @modifies Frees the codes, the dictionary and the index, and goes back to 8-bit codes.
+ * @return N/A
+ */
+void DictionaryList::clear() {
+    mCodes = ArrayList<uint8_t>();
+    mIndex.reset();
+    mDictionary.clear();
+    mStrings.clear();
+}
+
+/**
+ * Returns the bytes allocated by the list. Strings short enough to be stored inside their
+ * std::string count only the object itself.
+ * @param N/A
+ * @modifies N/A
+ * @return The memory footprint in bytes.
+ */
+size_t DictionaryList::memoryFootprint() const {
+    size_t bytes = std::visit([](const auto& codes) {return codes.memoryFootprint();}, mCodes);
+    bytes += mDictionary.memoryFootprint();
+    for (const std::string& value : mStrings) {
+        const char* object = reinterpret_cast<const char*>(&value);
+        bool embedded = value.data() >= object && value.data() < object + sizeof(value);
+        bytes += sizeof(value) + (embedded ? 0 : value.capacity() + 1);
+    }
+    if (mIndex)
+        bytes += size_t(mIndex->capacity()) * (sizeof(std::pair<std::string_view, uint32_t>) + 1);
+    return bytes;
+}
+
+/**
+ * Finds the code of a string, entering it in the dictionary if it is new. Codes widen as the
+ * dictionary outgrows them.
+ * @param value The string.
+ * @modifies Adds 'value' to the dictionary and the index if absent; may widen the codes.
+ * @return The code of 'value'.
+ */
+uint32_t DictionaryList::encode(std::string_view value) {
+    if (!mIndex)
+        mIndex = std::make_unique<Index>();
+    if (const uint32_t* found = mIndex->find(value))
+        return *found;
+
+    uint32_t code = mDictionary.size();
+    if (code == 1U << 8 && std::holds_alternative<ArrayList<uint8_t>>(mCodes))
+        mCodes = widen<uint16_t>(std::get<ArrayList<uint8_t>>(mCodes));
+    else if (code == 1U << 16 && std::holds_alternative<ArrayList<uint16_t>>(mCodes))
+        mCodes = widen<uint32_t>(std::get<ArrayList<uint16_t>>(mCodes));
+
+    mStrings.emplace_back(value);
+    std::string_view stored = mStrings.back();
+    CONTAINER_TRY {
+        mDictionary.add(stored);
+        mIndex->insert(stored, code);
+    } CONTAINER_CATCH_ALL {
+        if (mDictionary.size() > code)
+            mDictionary.remove(code);
+        mStrings.pop_back();
+        CONTAINER_RETHROW;
+    }
+    return code;
+}
+
+/**
+ * Copies the dictionary of another list and indexes the copy.
+ * @param src The list whose dictionary to copy.
+ * @modifies Replaces the dictionary and the index.
+ * @return N/A
+ */
+void DictionaryList::copyDictionary(const DictionaryList &src) {
+    mStrings = src.mStrings;
+    mDictionary = ArrayList<std::string_view>();
+    mIndex.reset();
+    if (mStrings.empty())
+        return;
+
+    mIndex = std::make_unique<Index>(static_cast<uint32_t>(mStrings.size()));
+    for (const std::string& value : mStrings) {
+        mIndex->insert(value, mDictionary.size());
+        mDictionary.add(value);
+    }
+}
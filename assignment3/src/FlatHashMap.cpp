@@ -0,0 +1,644 @@
+// Author: Mac-Noble Brako-Kusi
+// File: FlatHashMap.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for FlatHashMap template class
+
+/**
+ * Constructor: Creates an empty FlatHashMap without allocating any slots.
+ * @param N/A
+ * @modifies Initializes an empty table.
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+FlatHashMap<K, V, Hash, KeyEqual>::FlatHashMap()
+    : mSlots(nullptr),
+      mDistances(nullptr),
+      mCapacity(0),
+      mSize(0),
+      mShift(64),
+      mHash(),
+      mEqual(),
+      mResource(nullptr) {}
+
+/**
+ * Constructor: Creates an empty FlatHashMap with room for a number of entries.
+ * @param count The number of entries to make room for.
+ * @modifies Allocates enough slots for 'count' entries.
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+FlatHashMap<K, V, Hash, KeyEqual>::FlatHashMap(const uint32_t &count)
+    : FlatHashMap() {
+    reserve(count);
+}
+
+/**
+ * Constructor: Creates an empty FlatHashMap that allocates its arrays from a memory resource.
+ * @param resource The memory resource to allocate the arrays from.
+ * @modifies Initializes an empty table bound to 'resource' without allocating.
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+FlatHashMap<K, V, Hash, KeyEqual>::FlatHashMap(std::pmr::memory_resource &resource)
+    : FlatHashMap() {
+    mResource = &resource;
+}
+
+/**
+ * Copy Constructor: Creates a copy of an existing FlatHashMap.
+ * @param src The FlatHashMap to be copied.
+ * @modifies Copies the entries of 'src' into arrays from the resource of 'src'.
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+FlatHashMap<K, V, Hash, KeyEqual>::FlatHashMap(const FlatHashMap &src)
+    : FlatHashMap() {
+    mResource = src.mResource;
+    assign(src);
+}
+
+/**
+ * Move Constructor: Creates a FlatHashMap by taking over the contents of another.
+ * @param src The FlatHashMap to be moved.
+ * @modifies Takes over the arrays and resource of 'src', leaving it empty.
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+FlatHashMap<K, V, Hash, KeyEqual>::FlatHashMap(FlatHashMap &&src) noexcept
+    : FlatHashMap() {
+    swap(src);
+}
+
+/**
+ * Copy Assignment Operator: Assigns the contents of another FlatHashMap to this one.
+ * @param src The FlatHashMap to be copied.
+ * @modifies Copies the entries of 'src' into new arrays from this map's own resource.
+ * @return A reference to this FlatHashMap.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+FlatHashMap<K, V, Hash, KeyEqual> &
+FlatHashMap<K, V, Hash, KeyEqual>::operator=(const FlatHashMap &src) {
+    if (this != &src)
+        assign(src);
+    return *this;
+}
+
+/**
+ * Move Assignment Operator: Assigns the contents of another FlatHashMap to this one by moving.
+ * @param src The FlatHashMap to be moved.
+ * @modifies Takes over the arrays of 'src' if both maps allocate from equal resources, and
+ *           otherwise moves the entries into new arrays from this map's resource. Leaves 'src'
+ *           empty.
+ * @return A reference to this FlatHashMap.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+FlatHashMap<K, V, Hash, KeyEqual> &FlatHashMap<K, V, Hash, KeyEqual>::operator=(FlatHashMap &&src) {
+    if (this == &src)
+        return *this;
+
+    bool sameResource = mResource == src.mResource ||
+                        (mResource && src.mResource && mResource->is_equal(*src.mResource));
+    if (sameResource) {
+        std::pmr::memory_resource* resource = mResource;
+        swap(src);
+        // Equal resources can free each other's memory, but each map keeps its own
+        src.mResource = mResource;
+        mResource = resource;
+    } else {
+        assign(std::move(src));
+    }
+    src.clear();
+    return *this;
+}
+
+/**
+ * Inserts an entry if its key is not present yet.
+ * @param key The key to insert.
+ * @param value The value to associate with 'key'.
+ * @modifies Places the entry, possibly displacing entries closer to their home slots.
+ * @return 'true' if the entry was inserted, 'false' if the key was already present.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+bool FlatHashMap<K, V, Hash, KeyEqual>::insert(const K &key, const V &value) {
+    if (indexOf(key) != mCapacity)
+        return false;
+
+    insertNew(key, value);
+    return true;
+}
+
+/**
+ * Inserts an entry or replaces the value of an existing key.
+ * @param key The key to insert.
+ * @param value The value to associate with 'key'.
+ * @modifies Either replaces one value or places a new entry.
+ * @return 'true' if the entry was inserted, 'false' if an existing value was replaced.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+bool FlatHashMap<K, V, Hash, KeyEqual>::insertOrAssign(const K &key, const V &value) {
+    uint32_t index = indexOf(key);
+    if (index != mCapacity) {
+        mSlots[index].value = value;
+        return false;
+    }
+
+    insertNew(key, value);
+    return true;
+}
+
+/**
+ * Returns the value of a key, inserting a default value if the key is not present.
+ * @param key The key to look for.
+ * @modifies Inserts an entry if 'key' is not present.
+ * @return A reference to the value.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+V& FlatHashMap<K, V, Hash, KeyEqual>::operator[](const K &key) {
+    uint32_t index = indexOf(key);
+    if (index == mCapacity) {
+        // Entries move while being placed, so look the new one up again afterwards.
+        insertNew(key, V());
+        index = indexOf(key);
+    }
+    return mSlots[index].value;
+}
+
+/**
+ * Finds the value associated with a key.
+ * @param key The key to look for.
+ * @modifies N/A
+ * @return A pointer to the value, or nullptr if the key is not present.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+V* FlatHashMap<K, V, Hash, KeyEqual>::find(const K &key) {
+    uint32_t index = indexOf(key);
+    return index == mCapacity ? nullptr : &mSlots[index].value;
+}
+
+/**
+ * Finds the value associated with a key.
+ * @param key The key to look for.
+ * @modifies N/A
+ * @return A constant pointer to the value, or nullptr if the key is not present.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+const V* FlatHashMap<K, V, Hash, KeyEqual>::find(const K &key) const {
+    uint32_t index = indexOf(key);
+    return index == mCapacity ? nullptr : &mSlots[index].value;
+}
+
+/**
+ * Finds the value associated with a key of another type.
+ * @param key The key to look for, hashed and compared without converting it to K.
+ * @modifies N/A
+ * @return A pointer to the value, or nullptr if the key is not present.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+template<typename Q, typename>
+V* FlatHashMap<K, V, Hash, KeyEqual>::find(const Q &key) {
+    uint32_t index = indexOf(key);
+    return index == mCapacity ? nullptr : &mSlots[index].value;
+}
+
+/**
+ * Finds the value associated with a key of another type.
+ * @param key The key to look for, hashed and compared without converting it to K.
+ * @modifies N/A
+ * @return A constant pointer to the value, or nullptr if the key is not present.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+template<typename Q, typename>
+const V* FlatHashMap<K, V, Hash, KeyEqual>::find(const Q &key) const {
+    uint32_t index = indexOf(key);
+    return index == mCapacity ? nullptr : &mSlots[index].value;
+}
+
+/**
+ * Checks whether a key is present.
+ * @param key The key to look for.
+ * @modifies N/A
+ * @return 'true' if the key is present, 'false' otherwise.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+bool FlatHashMap<K, V, Hash, KeyEqual>::contains(const K &key) const {
+    return indexOf(key) != mCapacity;
+}
+
+/**
+ * Removes an entry with backward-shift deletion.
+ * @param key The key of the entry to remove.
+ * @modifies Moves each following entry of the probe run one slot closer to its home.
+ * @return 'true' if the key was present, 'false' otherwise.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+bool FlatHashMap<K, V, Hash, KeyEqual>::erase(const K &key) {
+    uint32_t index = indexOf(key);
+    if (index == mCapacity)
+        return false;
+
+    uint32_t mask = mCapacity - 1;
+    uint32_t next = (index + 1) & mask;
+    while (mDistances[next] > 1) {
+        mSlots[index] = std::move(mSlots[next]);
+        mDistances[index] = mDistances[next] - 1;
+        index = next;
+        next = (next + 1) & mask;
+    }
+
+    // Reset the vacated slot so that it does not keep the removed entry's resources alive.
+    mSlots[index] = Slot();
+    mDistances[index] = kEmpty;
+    --mSize;
+    return true;
+}
+
+/**
+ * Makes room for a number of entries.
+ * @param count The number of entries to make room for.
+ * @modifies Rehashes into a larger table if the current one is too small.
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+void FlatHashMap<K, V, Hash, KeyEqual>::reserve(const uint32_t &count) {
+    uint32_t capacity = capacityFor(count);
+    if (capacity > mCapacity)
+        rehash(capacity);
+}
+
+/**
+ * Visits every entry.
+ * @param fn The callable to invoke with each key and value.
+ * @modifies Whatever 'fn' modifies in the values.
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+template<typename Function>
+void FlatHashMap<K, V, Hash, KeyEqual>::forEach(Function fn) {
+    for (uint32_t i = 0; i < mCapacity; ++i) {
+        if (mDistances[i] != kEmpty)
+            fn(static_cast<const K&>(mSlots[i].key), mSlots[i].value);
+    }
+}
+
+/**
+ * Visits every entry.
+ * @param fn The callable to invoke with each key and value.
+ * @modifies N/A
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+template<typename Function>
+void FlatHashMap<K, V, Hash, KeyEqual>::forEach(Function fn) const {
+    for (uint32_t i = 0; i < mCapacity; ++i) {
+        if (mDistances[i] != kEmpty)
+            fn(static_cast<const K&>(mSlots[i].key), static_cast<const V&>(mSlots[i].value));
+    }
+}
+
+/**
+ * Removes every entry.
+ * @param N/A
+ * @modifies Resets all slots but keeps them allocated.
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+void FlatHashMap<K, V, Hash, KeyEqual>::clear() {
+    for (uint32_t i = 0; i < mCapacity; ++i) {
+        if (mDistances[i] != kEmpty) {
+            mSlots[i] = Slot();
+            mDistances[i] = kEmpty;
+        }
+    }
+    mSize = 0;
+}
+
+/**
+ * Checks if the FlatHashMap is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the FlatHashMap is empty, 'false' otherwise.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+bool FlatHashMap<K, V, Hash, KeyEqual>::isEmpty() const {return mSize == 0;}
+
+/**
+ * Returns the number of entries.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of entries.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+uint32_t FlatHashMap<K, V, Hash, KeyEqual>::size() const {return mSize;}
+
+/**
+ * Returns the number of slots.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of slots.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+uint32_t FlatHashMap<K, V, Hash, KeyEqual>::capacity() const {return mCapacity;}
+
+/**
+ * Returns the memory resource the arrays are allocated from.
+ * @param N/A
+ * @modifies N/A
+ * @return The memory resource, or nullptr if the arrays come from new[].
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+std::pmr::memory_resource* FlatHashMap<K, V, Hash, KeyEqual>::resource() const {return mResource;}
+
+/**
+ * Swaps the contents of two FlatHashMap objects.
+ * @param src The FlatHashMap to swap content with.
+ * @modifies Exchanges the arrays, counts, functions and resources of this and 'src'.
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+void FlatHashMap<K, V, Hash, KeyEqual>::swap(FlatHashMap &src) noexcept {
+    mSlots.swap(src.mSlots);
+    mDistances.swap(src.mDistances);
+    std::swap(mCapacity, src.mCapacity);
+    std::swap(mSize, src.mSize);
+    std::swap(mShift, src.mShift);
+    std::swap(mHash, src.mHash);
+    std::swap(mEqual, src.mEqual);
+    std::swap(mResource, src.mResource);
+}
+
+/**
+ * Finds the slot holding a key. The search stops as soon as it reaches an entry that is closer
+ * to its home than the key would be, since Robin Hood placement would have put the key there.
+ * @param key The key to look for.
+ * @modifies N/A
+ * @return The index of the slot, or mCapacity if the key is not present.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+template<typename Q>
+uint32_t FlatHashMap<K, V, Hash, KeyEqual>::indexOf(const Q &key) const {
+    if (mSize == 0)
+        return mCapacity;
+
+    uint32_t mask = mCapacity - 1;
+    uint32_t index = home(key);
+    for (uint32_t distance = 1; distance <= mDistances[index]; ++distance) {
+        if (mDistances[index] == distance && mEqual(mSlots[index].key, key))
+            return index;
+        index = (index + 1) & mask;
+    }
+    return mCapacity;
+}
+
+/**
+ * Computes the home slot of a key. The hash is mixed with a Fibonacci multiplier so that weak
+ * hashes, such as the identity hash of integers, still spread over the whole table.
+ * @param key The key to hash.
+ * @modifies N/A
+ * @return The index of the slot where the key's probe sequence starts.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+template<typename Q>
+uint32_t FlatHashMap<K, V, Hash, KeyEqual>::home(const Q &key) const {return home(key, mShift);}
+
+/**
+ * Computes the home slot of a key in a table of any capacity.
+ * @param key The key to hash.
+ * @param shift The shift of the table, as computed by shiftFor().
+ * @modifies N/A
+ * @return The index of the slot where the key's probe sequence starts.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+template<typename Q>
+uint32_t FlatHashMap<K, V, Hash, KeyEqual>::home(const Q &key, uint32_t shift) const {
+    uint64_t hash = static_cast<uint64_t>(mHash(key));
+    return static_cast<uint32_t>((hash * 0x9E3779B97F4A7C15ULL) >> shift);
+}
+
+/**
+ * Walks the displacement chain an insertion starting at a slot would follow, without moving
+ * anything: each entry the new one displaces carries on with that entry's own distance.
+ * @param index The home slot of the entry to insert.
+ * @modifies N/A
+ * @return 'true' if a distance along the chain would no longer fit in a byte.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+bool FlatHashMap<K, V, Hash, KeyEqual>::chainOverflows(uint32_t index) const {
+    // The carried distance grows by at most one a slot, so only a long run of entries can overflow
+    uint32_t mask = mCapacity - 1;
+    uint32_t run = 0;
+    while (run < kMaxDistance && mDistances[(index + run) & mask] != kEmpty)
+        ++run;
+    if (run + 2 < kMaxDistance)
+        return false;
+
+    uint8_t distance = 1;
+    while (mDistances[index] != kEmpty) {
+        distance = std::min(distance, mDistances[index]);
+        index = (index + 1) & mask;
+        if (++distance == kMaxDistance)
+            return true;
+    }
+    return false;
+}
+
+/**
+ * Places an entry whose key is known not to be present.
+ * @param key The key to insert.
+ * @param value The value to associate with 'key'.
+ * @modifies Grows the table if needed, then swaps the entry forward along its probe sequence,
+ *           displacing entries that are closer to their home slots. The table grows before the
+ *           first swap, so a failed growth leaves every entry where it was.
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+void FlatHashMap<K, V, Hash, KeyEqual>::insertNew(K key, V value) {
+    if (static_cast<uint64_t>(mSize + 1) * 8 > static_cast<uint64_t>(mCapacity) * 7)
+        rehash(mCapacity == 0 ? 16 : mCapacity * 2);
+    // A probe run that no longer fits in a byte: spread the entries over a larger table.
+    uint32_t index = home(key);
+    while (chainOverflows(index)) {
+        rehash(mCapacity * 2);
+        index = home(key);
+    }
+
+    Slot carried{std::move(key), std::move(value)};
+    uint32_t mask = mCapacity - 1;
+    uint8_t distance = 1;
+
+    while (mDistances[index] != kEmpty) {
+        if (mDistances[index] < distance) {
+            std::swap(carried, mSlots[index]);
+            std::swap(distance, mDistances[index]);
+        }
+        index = (index + 1) & mask;
+        ++distance;
+    }
+
+    mSlots[index] = std::move(carried);
+    mDistances[index] = distance;
+    ++mSize;
+}
+
+/**
+ * Moves every entry into a new table. The entries are placed by index first, doubling the
+ * capacity until every probe distance fits in a byte, and only then transferred, so a failed
+ * allocation leaves the table as it was. Entries are copied if moving them could throw.
+ * @param capacity The least number of slots of the new table, a power of two.
+ * @modifies Replaces both arrays.
+ * @throws std::length_error if the table would exceed 2^31 slots.
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+void FlatHashMap<K, V, Hash, KeyEqual>::rehash(uint32_t capacity) {
+    ScopedArray<uint32_t> sources;
+    ScopedArray<Slot> slots;
+    ScopedArray<uint8_t> distances;
+    while (true) {
+        if (capacity == 0 || capacity > (1U << 31))
+            throwLengthError("FlatHashMap cannot exceed 2^31 slots");
+        ScopedArray<uint32_t> attempt(capacity, mResource);
+        sources.swap(attempt);
+        allocate(capacity, slots, distances);
+        if (place(capacity, sources.get(), distances.get()))
+            break;
+        capacity *= 2;
+    }
+
+    for (uint32_t i = 0; i < capacity; ++i) {
+        if (distances[i] == kEmpty)
+            continue;
+        Slot& source = mSlots[sources[i]];
+        if constexpr (std::is_nothrow_move_assignable_v<Slot>)
+            slots[i] = std::move(source);
+        else
+            slots[i] = source;
+    }
+
+    mSlots.swap(slots);
+    mDistances.swap(distances);
+    mCapacity = capacity;
+    mShift = shiftFor(capacity);
+}
+
+/**
+ * Allocates the two arrays of a table from this map's resource.
+ * @param capacity The number of slots, which must not be zero.
+ * @param slots Receives default-initialized slots.
+ * @param distances Receives probe distances that are all kEmpty.
+ * @modifies Replaces 'slots' and 'distances', freeing what they held.
+ * @throws std::bad_alloc or whatever the resource throws if an allocation fails.
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+void FlatHashMap<K, V, Hash, KeyEqual>::allocate(uint32_t capacity, ScopedArray<Slot> &slots,
+                                                  ScopedArray<uint8_t> &distances) const {
+    ScopedArray<Slot> newSlots(capacity, mResource);
+    ScopedArray<uint8_t> newDistances(capacity, mResource);
+    std::fill_n(newDistances.get(), capacity, kEmpty);
+    slots.swap(newSlots);
+    distances.swap(newDistances);
+}
+
+/**
+ * Replaces the table with one holding the entries of another map, in arrays from this map's
+ * resource. The new arrays are filled before anything is replaced, so a failure leaves this map
+ * as it was.
+ * @param src The FlatHashMap to take the entries from, an rvalue to move them.
+ * @modifies Replaces both arrays, the counts and the functions. Entries of an rvalue 'src' are
+ *           moved when that cannot throw and copied otherwise.
+ * @return N/A
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+template<typename Source>
+void FlatHashMap<K, V, Hash, KeyEqual>::assign(Source &&src) {
+    constexpr bool kMove = !std::is_lvalue_reference_v<Source> &&
+                           std::is_nothrow_move_assignable_v<Slot>;
+    ScopedArray<Slot> slots;
+    ScopedArray<uint8_t> distances;
+    if (src.mCapacity != 0)
+        allocate(src.mCapacity, slots, distances);
+    for (uint32_t i = 0; i < src.mCapacity; ++i) {
+        if (src.mDistances[i] == kEmpty)
+            continue;
+        if constexpr (kMove)
+            slots[i] = std::move(src.mSlots[i]);
+        else
+            slots[i] = src.mSlots[i];
+        distances[i] = src.mDistances[i];
+    }
+
+    mSlots.swap(slots);
+    mDistances.swap(distances);
+    mCapacity = src.mCapacity;
+    mSize = src.mSize;
+    mShift = src.mShift;
+    mHash = src.mHash;
+    mEqual = src.mEqual;
+}
+
+/**
+ * Lays out the entries in a table of another capacity by their slot numbers, with the same
+ * Robin Hood insertion insertNew() uses, without touching the entries themselves.
+ * @param capacity The number of slots of the new table, a power of two.
+ * @param sources Receives, for each occupied new slot, the current slot of its entry.
+ * @param distances Receives the probe distances of the new table; must start all kEmpty.
+ * @modifies Fills 'sources' and 'distances'.
+ * @return 'false' if some probe distance would not fit in a byte.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+bool FlatHashMap<K, V, Hash, KeyEqual>::place(uint32_t capacity, uint32_t *sources,
+                                               uint8_t *distances) const {
+    uint32_t mask = capacity - 1;
+    uint32_t shift = shiftFor(capacity);
+    for (uint32_t i = 0; i < mCapacity; ++i) {
+        if (mDistances[i] == kEmpty)
+            continue;
+
+        uint32_t carried = i;
+        uint32_t index = home(mSlots[i].key, shift);
+        uint8_t distance = 1;
+        while (distances[index] != kEmpty) {
+            if (distances[index] < distance) {
+                std::swap(carried, sources[index]);
+                std::swap(distance, distances[index]);
+            }
+            index = (index + 1) & mask;
+            if (++distance == kMaxDistance)
+                return false;
+        }
+        sources[index] = carried;
+        distances[index] = distance;
+    }
+    return true;
+}
+
+/**
+ * Computes the shift that maps a mixed 64-bit hash onto the slots of a table.
+ * @param capacity The number of slots, a power of two.
+ * @modifies N/A
+ * @return 64 minus the base-two logarithm of 'capacity'.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+uint32_t FlatHashMap<K, V, Hash, KeyEqual>::shiftFor(uint32_t capacity) {
+    uint32_t shift = 64;
+    for (uint32_t bits = capacity; bits > 1; bits >>= 1)
+        --shift;
+    return shift;
+}
+
+/**
+ * Computes the smallest table that holds a number of entries below the maximum load factor.
+ * @param count The number of entries.
+ * @modifies N/A
+ * @return A power of two of at least 16, or zero if 'count' is zero.
+ */
+template<typename K, typename V, typename Hash, typename KeyEqual>
+uint32_t FlatHashMap<K, V, Hash, KeyEqual>::capacityFor(uint32_t count) {
+    if (count == 0)
+        return 0;
+
+    uint64_t capacity = 16;
+    while (static_cast<uint64_t>(count) * 8 > capacity * 7)
+        capacity *= 2;
+    return static_cast<uint32_t>(capacity);
+}
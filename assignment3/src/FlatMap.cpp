@@ -0,0 +1,344 @@
+// Author: Mac-Noble Brako-Kusi
+// File: FlatMap.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for FlatMap template class
+
+/**
+ * Constructor: Creates an empty FlatMap.
+ * @param N/A
+ * @modifies Initializes empty key and value arrays.
+ * @return N/A
+ */
+template<typename K, typename V, typename Compare>
+FlatMap<K, V, Compare>::FlatMap()
+    : mKeys(),
+      mValues(),
+      mCompare() {}
+
+/**
+ * Constructor: Creates a FlatMap from unsorted parallel key and value lists.
+ * @param keys The keys to add, in any order.
+ * @param values The values matching 'keys'.
+ * @modifies Initializes the arrays with the sorted entries, keeping the last value of each key.
+ * @throws std::invalid_argument if the lists differ in size.
+ * @return N/A
+ */
+template<typename K, typename V, typename Compare>
+FlatMap<K, V, Compare>::FlatMap(const ArrayList<K> &keys, const ArrayList<V> &values)
+    : mKeys(),
+      mValues(),
+      mCompare() {
+    sortedUnique(keys, values, mKeys, mValues);
+}
+
+/**
+ * Inserts a single entry if its key is not present yet.
+ * @param key The key to insert.
+ * @param value The value to associate with 'key'.
+ * @modifies Shifts the entries with greater keys up by one.
+ * @return 'true' if the entry was inserted, 'false' if the key was already present.
+ */
+template<typename K, typename V, typename Compare>
+bool FlatMap<K, V, Compare>::insert(const K &key, const V &value) {
+    uint32_t index = lowerBound(key);
+    if (index < mKeys.size() && !mCompare(key, mKeys[index]))
+        return false;
+
+    // Insert the value first: if inserting the key then throws, the value is taken back out. That
+    // must not throw either, so unless V moves in place without throwing, the value goes into a
+    // copy that is swapped in only once the key is in.
+    if constexpr (std::is_nothrow_move_assignable_v<V>) {
+        mValues.add(index, value);
+        CONTAINER_TRY {
+            mKeys.add(index, key);
+        } CONTAINER_CATCH_ALL {
+            mValues.tryRemove(index);
+            CONTAINER_RETHROW;
+        }
+    } else {
+        ArrayList<V> values(mValues);
+        values.add(index, value);
+        mKeys.add(index, key);
+        mValues.swap(values);
+    }
+    return true;
+}
+
+/**
+ * Inserts a single entry or replaces the value of an existing key.
+ * @param key The key to insert.
+ * @param value The value to associate with 'key'.
+ * @modifies Either replaces one value or shifts the entries with greater keys up by one.
+ * @return 'true' if the entry was inserted, 'false' if an existing value was replaced.
+ */
+template<typename K, typename V, typename Compare>
+bool FlatMap<K, V, Compare>::insertOrAssign(const K &key, const V &value) {
+    uint32_t index = indexOf(key);
+    if (index == mKeys.size())
+        return insert(key, value);
+
+    mValues[index] = value;
+    return false;
+}
+
+/**
+ * Inserts a batch of unsorted entries by merging them with the existing entries.
+ * @param keys The keys to insert.
+ * @param values The values matching 'keys'.
+ * @modifies Replaces both arrays with the merged entries.
+ * @throws std::invalid_argument if the lists differ in size.
+ * @return N/A
+ */
+template<typename K, typename V, typename Compare>
+void FlatMap<K, V, Compare>::insert(const ArrayList<K> &keys, const ArrayList<V> &values) {
+    ArrayList<K> batchKeys;
+    ArrayList<V> batchValues;
+    sortedUnique(keys, values, batchKeys, batchValues);
+
+    // Count the merged entries first so that both arrays are allocated exactly once.
+    uint32_t i = 0, j = 0, count = 0;
+    while (i < mKeys.size() && j < batchKeys.size()) {
+        if (mCompare(mKeys[i], batchKeys[j])) {
+            ++i;
+        } else if (mCompare(batchKeys[j], mKeys[i])) {
+            ++j;
+        } else {
+            ++i;
+            ++j;
+        }
+        ++count;
+    }
+    count += (mKeys.size() - i) + (batchKeys.size() - j);
+
+    ArrayList<K> mergedKeys(count);
+    ArrayList<V> mergedValues(count);
+    i = j = 0;
+    for (uint32_t out = 0; out < count; ++out) {
+        bool takeOld = j == batchKeys.size()
+            || (i < mKeys.size() && mCompare(mKeys[i], batchKeys[j]));
+        if (takeOld) {
+            mergedKeys[out] = mKeys[i];
+            mergedValues[out] = mValues[i];
+            ++i;
+        } else {
+            if (i < mKeys.size() && !mCompare(batchKeys[j], mKeys[i]))
+                ++i;
+            mergedKeys[out] = batchKeys[j];
+            mergedValues[out] = batchValues[j];
+            ++j;
+        }
+    }
+
+    mKeys.swap(mergedKeys);
+    mValues.swap(mergedValues);
+}
+
+/**
+ * Removes an entry.
+ * @param key The key of the entry to remove.
+ * @modifies Shifts the entries with greater keys down by one.
+ * @return 'true' if the key was present, 'false' otherwise.
+ */
+template<typename K, typename V, typename Compare>
+bool FlatMap<K, V, Compare>::erase(const K &key) {
+    uint32_t index = indexOf(key);
+    if (index == mKeys.size())
+        return false;
+
+    // Copy the arrays first so that a throwing copy leaves both arrays untouched.
+    ArrayList<K> keys(mKeys);
+    ArrayList<V> values(mValues);
+    keys.remove(index);
+    values.remove(index);
+    mKeys.swap(keys);
+    mValues.swap(values);
+    return true;
+}
+
+/**
+ * Checks whether a key is present.
+ * @param key The key to look for.
+ * @modifies N/A
+ * @return 'true' if the key is present, 'false' otherwise.
+ */
+template<typename K, typename V, typename Compare>
+bool FlatMap<K, V, Compare>::contains(const K &key) const {return indexOf(key) != mKeys.size();}
+
+/**
+ * Finds the value associated with a key.
+ * @param key The key to look for.
+ * @modifies N/A
+ * @return A pointer to the value, or nullptr if the key is not present.
+ */
+template<typename K, typename V, typename Compare>
+V* FlatMap<K, V, Compare>::find(const K &key) {
+    uint32_t index = indexOf(key);
+    return index == mKeys.size() ? nullptr : &mValues[index];
+}
+
+/**
+ * Finds the value associated with a key.
+ * @param key The key to look for.
+ * @modifies N/A
+ * @return A constant pointer to the value, or nullptr if the key is not present.
+ */
+template<typename K, typename V, typename Compare>
+const V* FlatMap<K, V, Compare>::find(const K &key) const {
+    uint32_t index = indexOf(key);
+    return index == mKeys.size() ? nullptr : &mValues[index];
+}
+
+/**
+ * Returns the value associated with a key.
+ * @param key The key to look for.
+ * @modifies N/A
+ * @throws std::out_of_range if the key is not present.
+ * @return A constant reference to the value.
+ */
+template<typename K, typename V, typename Compare>
+const V& FlatMap<K, V, Compare>::at(const K &key) const {
+    const V* value = find(key);
+    if (value == nullptr)
+        throwOutOfRange("key not found");
+
+    return *value;
+}
+
+/**
+ * Returns the positions of all entries whose keys are in [low, high).
+ * @param low The inclusive lower bound.
+ * @param high The exclusive upper bound.
+ * @modifies N/A
+ * @return The matching positions.
+ */
+template<typename K, typename V, typename Compare>
+IndexRange FlatMap<K, V, Compare>::range(const K &low, const K &high) const {
+    uint32_t first = lowerBound(low);
+    uint32_t last = mCompare(low, high) ? lowerBound(high) : first;
+    return IndexRange{first, last};
+}
+
+/**
+ * Accesses the key at a specific position without range checking.
+ * @param index The position of the entry.
+ * @modifies N/A
+ * @return A constant reference to the key.
+ */
+template<typename K, typename V, typename Compare>
+const K& FlatMap<K, V, Compare>::keyAt(const uint32_t &index) const {return mKeys[index];}
+
+/**
+ * Accesses the value at a specific position without range checking.
+ * @param index The position of the entry.
+ * @modifies N/A
+ * @return A reference to the value, allowing modification.
+ */
+template<typename K, typename V, typename Compare>
+V& FlatMap<K, V, Compare>::valueAt(const uint32_t &index) {return mValues[index];}
+
+/**
+ * Accesses the value at a specific position without range checking.
+ * @param index The position of the entry.
+ * @modifies N/A
+ * @return A constant reference to the value.
+ */
+template<typename K, typename V, typename Compare>
+const V& FlatMap<K, V, Compare>::valueAt(const uint32_t &index) const {return mValues[index];}
+
+/**
+ * Clears the FlatMap.
+ * @param N/A
+ * @modifies Releases both arrays.
+ * @return N/A
+ */
+template<typename K, typename V, typename Compare>
+void FlatMap<K, V, Compare>::clear() {
+    mKeys.clear();
+    mValues.clear();
+}
+
+/**
+ * Checks if the FlatMap is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the FlatMap is empty, 'false' otherwise.
+ */
+template<typename K, typename V, typename Compare>
+bool FlatMap<K, V, Compare>::isEmpty() const {return mKeys.isEmpty();}
+
+/**
+ * Returns the number of entries.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of entries.
+ */
+template<typename K, typename V, typename Compare>
+uint32_t FlatMap<K, V, Compare>::size() const {return mKeys.size();}
+
+/**
+ * Sorts unsorted entries by key, keeping only the last entry of each key.
+ * @param keys The keys to sort.
+ * @param values The values matching 'keys'.
+ * @param outKeys Receives the sorted, unique keys.
+ * @param outValues Receives the values matching 'outKeys'.
+ * @modifies Replaces the contents of 'outKeys' and 'outValues'.
+ * @throws std::invalid_argument if 'keys' and 'values' differ in size.
+ * @return N/A
+ */
+template<typename K, typename V, typename Compare>
+void FlatMap<K, V, Compare>::sortedUnique(const ArrayList<K> &keys, const ArrayList<V> &values,
+        ArrayList<K> &outKeys, ArrayList<V> &outValues) const {
+    if (keys.size() != values.size())
+        throwInvalidArgument("keys and values differ in size");
+
+    // Sort positions rather than entries; the stable sort keeps repeated keys in input order.
+    ArrayList<uint32_t> order(keys.size());
+    uint32_t* first = order.data();
+    for (uint32_t i = 0; i < keys.size(); ++i)
+        first[i] = i;
+    std::stable_sort(first, first + order.size(), [&](uint32_t lhs, uint32_t rhs) {
+        return mCompare(keys[lhs], keys[rhs]);
+    });
+
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < order.size(); ++i) {
+        if (i + 1 == order.size() || mCompare(keys[first[i]], keys[first[i + 1]]))
+            first[count++] = first[i];
+    }
+
+    ArrayList<K> sortedKeys(count);
+    ArrayList<V> sortedValues(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        sortedKeys[i] = keys[first[i]];
+        sortedValues[i] = values[first[i]];
+    }
+    outKeys.swap(sortedKeys);
+    outValues.swap(sortedValues);
+}
+
+/**
+ * Returns the position of the first key not less than a bound.
+ * @param key The bound.
+ * @modifies N/A
+ * @return An index in [0, size()].
+ */
+template<typename K, typename V, typename Compare>
+uint32_t FlatMap<K, V, Compare>::lowerBound(const K &key) const {
+    const K* first = mKeys.data();
+    return std::lower_bound(first, first + mKeys.size(), key, mCompare) - first;
+}
+
+/**
+ * Finds the position of a key with a binary search.
+ * @param key The key to look for.
+ * @modifies N/A
+ * @return The index of the key, or size() if it is not present.
+ */
+template<typename K, typename V, typename Compare>
+uint32_t FlatMap<K, V, Compare>::indexOf(const K &key) const {
+    uint32_t index = lowerBound(key);
+    if (index < mKeys.size() && !mCompare(key, mKeys[index]))
+        return index;
+
+    return mKeys.size();
+}
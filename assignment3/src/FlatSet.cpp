@@ -0,0 +1,230 @@
+// Author: Mac-Noble Brako-Kusi
+// File: FlatSet.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for FlatSet template class
+
+/**
+ * Constructor: Creates an empty FlatSet.
+ * @param N/A
+ * @modifies Initializes an empty key array.
+ * @return N/A
+ */
+template<typename T, typename Compare>
+FlatSet<T, Compare>::FlatSet()
+    : mKeys(),
+      mCompare() {}
+
+/**
+ * Constructor: Creates a FlatSet from unsorted keys.
+ * @param keys The keys to add, in any order.
+ * @modifies Initializes the key array with the sorted, unique keys.
+ * @return N/A
+ */
+template<typename T, typename Compare>
+FlatSet<T, Compare>::FlatSet(const ArrayList<T> &keys)
+    : mKeys(sortedUnique(keys, Compare())),
+      mCompare() {}
+
+/**
+ * Inserts a single key at its sorted position.
+ * @param key The key to insert.
+ * @modifies Shifts the greater keys up by one.
+ * @return 'true' if the key was inserted, 'false' if it was already present.
+ */
+template<typename T, typename Compare>
+bool FlatSet<T, Compare>::insert(const T &key) {
+    uint32_t index = lowerBound(key);
+    if (index < mKeys.size() && equivalent(mKeys[index], key))
+        return false;
+
+    mKeys.add(index, key);
+    return true;
+}
+
+/**
+ * Inserts a batch of unsorted keys by merging them with the existing keys.
+ * @param keys The keys to insert.
+ * @modifies Replaces the key array with the union of both key sets.
+ * @return N/A
+ */
+template<typename T, typename Compare>
+void FlatSet<T, Compare>::insert(const ArrayList<T> &keys) {
+    ArrayList<T> batch = sortedUnique(keys, mCompare);
+    const T* lhs = mKeys.data();
+    const T* rhs = batch.data();
+
+    // Count the union first so that the result is allocated exactly once.
+    uint32_t i = 0, j = 0, count = 0;
+    while (i < mKeys.size() && j < batch.size()) {
+        if (mCompare(lhs[i], rhs[j])) {
+            ++i;
+        } else if (mCompare(rhs[j], lhs[i])) {
+            ++j;
+        } else {
+            ++i;
+            ++j;
+        }
+        ++count;
+    }
+    count += (mKeys.size() - i) + (batch.size() - j);
+
+    ArrayList<T> merged(count);
+    std::set_union(lhs, lhs + mKeys.size(), rhs, rhs + batch.size(), merged.data(), mCompare);
+    mKeys.swap(merged);
+}
+
+/**
+ * Removes a key.
+ * @param key The key to remove.
+ * @modifies Shifts the greater keys down by one.
+ * @return 'true' if the key was present, 'false' otherwise.
+ */
+template<typename T, typename Compare>
+bool FlatSet<T, Compare>::erase(const T &key) {
+    uint32_t index = find(key);
+    if (index == mKeys.size())
+        return false;
+
+    mKeys.remove(index);
+    return true;
+}
+
+/**
+ * Checks whether a key is present.
+ * @param key The key to look for.
+ * @modifies N/A
+ * @return 'true' if the key is present, 'false' otherwise.
+ */
+template<typename T, typename Compare>
+bool FlatSet<T, Compare>::contains(const T &key) const {return find(key) != mKeys.size();}
+
+/**
+ * Finds the position of a key with a binary search.
+ * @param key The key to look for.
+ * @modifies N/A
+ * @return The index of the key, or size() if it is not present.
+ */
+template<typename T, typename Compare>
+uint32_t FlatSet<T, Compare>::find(const T &key) const {
+    uint32_t index = lowerBound(key);
+    if (index < mKeys.size() && equivalent(mKeys[index], key))
+        return index;
+
+    return mKeys.size();
+}
+
+/**
+ * Returns the position of the first key not less than a bound.
+ * @param key The bound.
+ * @modifies N/A
+ * @return An index in [0, size()].
+ */
+template<typename T, typename Compare>
+uint32_t FlatSet<T, Compare>::lowerBound(const T &key) const {
+    const T* first = mKeys.data();
+    return std::lower_bound(first, first + mKeys.size(), key, mCompare) - first;
+}
+
+/**
+ * Returns the position of the first key greater than a bound.
+ * @param key The bound.
+ * @modifies N/A
+ * @return An index in [0, size()].
+ */
+template<typename T, typename Compare>
+uint32_t FlatSet<T, Compare>::upperBound(const T &key) const {
+    const T* first = mKeys.data();
+    return std::upper_bound(first, first + mKeys.size(), key, mCompare) - first;
+}
+
+/**
+ * Returns the positions of all keys in [low, high).
+ * @param low The inclusive lower bound.
+ * @param high The exclusive upper bound.
+ * @modifies N/A
+ * @return The matching positions.
+ */
+template<typename T, typename Compare>
+IndexRange FlatSet<T, Compare>::range(const T &low, const T &high) const {
+    uint32_t first = lowerBound(low);
+    uint32_t last = mCompare(low, high) ? lowerBound(high) : first;
+    return IndexRange{first, last};
+}
+
+/**
+ * Accesses the key at a specific position without range checking.
+ * @param index The position of the key.
+ * @modifies N/A
+ * @return A constant reference to the key.
+ */
+template<typename T, typename Compare>
+const T& FlatSet<T, Compare>::operator[](const uint32_t &index) const {return mKeys[index];}
+
+/**
+ * Returns the sorted keys.
+ * @param N/A
+ * @modifies N/A
+ * @return A constant reference to the key array.
+ */
+template<typename T, typename Compare>
+const ArrayList<T>& FlatSet<T, Compare>::keys() const {return mKeys;}
+
+/**
+ * Clears the FlatSet.
+ * @param N/A
+ * @modifies Releases the key array.
+ * @return N/A
+ */
+template<typename T, typename Compare>
+void FlatSet<T, Compare>::clear() {mKeys.clear();}
+
+/**
+ * Checks if the FlatSet is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the FlatSet is empty, 'false' otherwise.
+ */
+template<typename T, typename Compare>
+bool FlatSet<T, Compare>::isEmpty() const {return mKeys.isEmpty();}
+
+/**
+ * Returns the number of keys.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of keys.
+ */
+template<typename T, typename Compare>
+uint32_t FlatSet<T, Compare>::size() const {return mKeys.size();}
+
+/**
+ * Sorts a copy of some keys and drops the repeated ones.
+ * @param keys The keys to sort.
+ * @param compare The ordering of the keys.
+ * @modifies N/A
+ * @return An exactly sized ArrayList of sorted, unique keys.
+ */
+template<typename T, typename Compare>
+ArrayList<T> FlatSet<T, Compare>::sortedUnique(const ArrayList<T> &keys, const Compare &compare) {
+    ArrayList<T> sorted(keys);
+    T* first = sorted.data();
+    std::sort(first, first + sorted.size(), compare);
+    T* last = std::unique(first, first + sorted.size(), [&compare](const T& lhs, const T& rhs) {
+        return !compare(lhs, rhs) && !compare(rhs, lhs);
+    });
+
+    ArrayList<T> result(static_cast<uint32_t>(last - first));
+    std::copy(first, last, result.data());
+    return result;
+}
+
+/**
+ * Checks whether two keys are equivalent under the ordering.
+ * @param lhs The first key.
+ * @param rhs The second key.
+ * @modifies N/A
+ * @return 'true' if neither key is less than the other.
+ */
+template<typename T, typename Compare>
+bool FlatSet<T, Compare>::equivalent(const T &lhs, const T &rhs) const {
+    return !mCompare(lhs, rhs) && !mCompare(rhs, lhs);
+}
@@ -0,0 +1,218 @@
+// Author: Mac-Noble Brako-Kusi
+// File: HugePageResource.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for HugePageResource class
+
+#include "ContainerError.h"
+#include "HugePageResource.h"
+#include <new>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+const size_t kPageSize = 4096;
+
+size_t roundUp(size_t bytes, size_t multiple) {
+    return (bytes + multiple - 1) / multiple * multiple;
+}
+} // Namespace
+
+/**
+ * Constructor: Creates a HugePageResource with the provided settings.
+ * @param options The huge page, threshold and NUMA settings.
+ * @modifies Initializes the counters to zero.
+ * @return N/A
+ */
+HugePageResource::HugePageResource(const HugePageOptions &options)
+    : mOptions(options),
+      mMappedBytes(0),
+      mHugeTlbFallbacks(0),
+      mPlacementFailures(0) {}
+
+/**
+ * Returns the settings of this resource.
+ * @param N/A
+ * @modifies N/A
+ * @return The options this resource was created with.
+ */
+const HugePageOptions &HugePageResource::options() const {return mOptions;}
+
+/**
+ * Returns the number of bytes currently mapped for large buffers.
+ * @param N/A
+ * @modifies N/A
+ * @return The mapped bytes.
+ */
+size_t HugePageResource::mappedBytes() const {return mMappedBytes.load(std::memory_order_relaxed);}
+
+/**
+ * Returns how many Explicit mappings fell back to transparent huge pages.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of fallbacks.
+ */
+uint64_t HugePageResource::hugeTlbFallbacks() const {
+    return mHugeTlbFallbacks.load(std::memory_order_relaxed);
+}
+
+/**
+ * Returns how many large buffers could not be given the requested NUMA placement.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of failed placements.
+ */
+uint64_t HugePageResource::placementFailures() const {
+    return mPlacementFailures.load(std::memory_order_relaxed);
+}
+
+/**
+ * Allocates a buffer: large ones are mapped and placed, small ones come from the default heap.
+ * @param bytes The size of the buffer.
+ * @param alignment The required alignment.
+ * @modifies Adds the length of a new mapping to the mapped bytes.
+ * @throws std::bad_alloc if the mapping fails.
+ * @return A pointer to the buffer.
+ */
+void *HugePageResource::do_allocate(size_t bytes, size_t alignment) {
+    if (!isLarge(bytes, alignment))
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+
+    size_t length = mappingLength(bytes);
+    void* p = map(length);
+    place(p, length);
+    mMappedBytes.fetch_add(length, std::memory_order_relaxed);
+    return p;
+}
+
+/**
+ * Frees a buffer returned by do_allocate() with the same size and alignment.
+ * @param p The buffer.
+ * @param bytes The size it was allocated with.
+ * @param alignment The alignment it was allocated with.
+ * @modifies Unmaps large buffers and subtracts their length from the mapped bytes.
+ * @return N/A
+ */
+void HugePageResource::do_deallocate(void *p, size_t bytes, size_t alignment) {
+    if (!isLarge(bytes, alignment)) {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        return;
+    }
+
+    size_t length = mappingLength(bytes);
+#ifdef __linux__
+    munmap(p, length);
+#endif
+    mMappedBytes.fetch_sub(length, std::memory_order_relaxed);
+}
+
+/**
+ * Checks whether memory from this resource can be freed by another.
+ * @param other The other resource.
+ * @modifies N/A
+ * @return 'true' only if 'other' is this resource, since the settings decide how memory is freed.
+ */
+bool HugePageResource::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+    return this == &other;
+}
+
+/**
+ * Decides whether a buffer is mapped directly or comes from the default heap.
+ * @param bytes The size of the buffer.
+ * @param alignment The required alignment.
+ * @modifies N/A
+ * @return 'true' if the buffer is at least the threshold and a mapping satisfies its alignment.
+ */
+bool HugePageResource::isLarge(size_t bytes, size_t alignment) const {
+#ifdef __linux__
+    return bytes != 0 && bytes >= mOptions.threshold && alignment <= kPageSize;
+#else
+    (void) bytes;
+    (void) alignment;
+    return false;
+#endif
+}
+
+/**
+ * Computes the length of the mapping for a large buffer.
+ * @param bytes The size of the buffer.
+ * @modifies N/A
+ * @return 'bytes' rounded up to whole huge pages, or to whole regular pages if huge pages are off.
+ */
+size_t HugePageResource::mappingLength(size_t bytes) const {
+    return roundUp(bytes, mOptions.hugePages == HugePages::None ? kPageSize : kHugePageSize);
+}
+
+/**
+ * Maps anonymous memory with the configured kind of pages. A transparent huge page mapping is
+ * over-allocated by one huge page and trimmed so that it starts on a huge page boundary, which the
+ * kernel needs to back it with huge pages.
+ * @param length The length of the mapping.
+ * @modifies Counts a fallback if MAP_HUGETLB fails.
+ * @throws std::bad_alloc if no mapping can be made.
+ * @return The start of the mapping.
+ */
+void *HugePageResource::map(size_t length) {
+#ifdef __linux__
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    if (mOptions.hugePages == HugePages::Explicit) {
+        void* p = mmap(nullptr, length, PROT_READ | PROT_WRITE, flags | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED)
+            return p;
+        mHugeTlbFallbacks.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (mOptions.hugePages == HugePages::None) {
+        void* p = mmap(nullptr, length, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (p == MAP_FAILED)
+            throwBadAlloc();
+        return p;
+    }
+
+    void* raw = mmap(nullptr, length + kHugePageSize, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (raw == MAP_FAILED)
+        throwBadAlloc();
+
+    char* start = static_cast<char*>(raw);
+    char* aligned = reinterpret_cast<char*>(
+        roundUp(reinterpret_cast<uintptr_t>(start), kHugePageSize));
+    if (aligned != start)
+        munmap(start, aligned - start);
+    size_t tail = (start + length + kHugePageSize) - (aligned + length);
+    if (tail != 0)
+        munmap(aligned + length, tail);
+
+    madvise(aligned, length, MADV_HUGEPAGE);
+    return aligned;
+#else
+    (void) length;
+    throwBadAlloc();
+#endif
+}
+
+/**
+ * Applies the NUMA policy to a new mapping. Nothing has touched the mapping yet, so every page
+ * will be allocated according to the policy.
+ * @param p The start of the mapping.
+ * @param length The length of the mapping.
+ * @modifies Counts a placement failure if mbind() fails.
+ * @return N/A
+ */
+void HugePageResource::place(void *p, size_t length) {
+#ifdef __linux__
+    if (mOptions.numaPolicy == NumaPolicy::FirstTouch)
+        return;
+
+    int mode = mOptions.numaPolicy == NumaPolicy::Bind ? MPOL_BIND : MPOL_INTERLEAVE;
+    unsigned long mask = mOptions.nodeMask;
+    if (syscall(SYS_mbind, p, length, mode, &mask, sizeof(mask) * 8, 0) != 0)
+        mPlacementFailures.fetch_add(1, std::memory_order_relaxed);
+#else
+    (void) p;
+    (void) length;
+#endif
+}
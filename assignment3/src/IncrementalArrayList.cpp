@@ -0,0 +1,546 @@
+// Author: Mac-Noble Brako-Kusi
+// File: IncrementalArrayList.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for IncrementalArrayList template class
+
+/**
+ * Constructor: Creates an empty IncrementalArrayList.
+ * @param migrationStep The maximum number of elements migrated by each append.
+ * @modifies Initializes an empty list with no buffers, allocating from the heap.
+ * @throws std::invalid_argument if 'migrationStep' is 0.
+ * @return N/A
+ */
+template<typename T>
+IncrementalArrayList<T>::IncrementalArrayList(uint32_t migrationStep)
+    : IncrementalArrayList(*std::pmr::new_delete_resource(), migrationStep) {}
+
+/**
+ * Constructor: Creates an empty IncrementalArrayList that allocates from a memory resource.
+ * @param resource The memory resource to allocate buffers from.
+ * @param migrationStep The maximum number of elements migrated by each append.
+ * @modifies Initializes an empty list with no buffers.
+ * @throws std::invalid_argument if 'migrationStep' is 0.
+ * @return N/A
+ */
+template<typename T>
+IncrementalArrayList<T>::IncrementalArrayList(std::pmr::memory_resource &resource,
+                                              uint32_t migrationStep)
+    : mArray(nullptr),
+      mOld(nullptr),
+      mResource(&resource),
+      mSize(0),
+      mCapacity(0),
+      mOldSize(0),
+      mMigrated(0),
+      mMigrationStep(migrationStep) {
+    if (migrationStep == 0)
+        throwInvalidArgument("migration step must be at least 1");
+}
+
+/**
+ * Copy Constructor: Creates a copy of an existing IncrementalArrayList.
+ * @param src The IncrementalArrayList to be copied.
+ * @modifies Copies every element of 'src' into a single buffer of the same capacity, allocated
+ *           from the same resource.
+ * @return N/A
+ */
+template<typename T>
+IncrementalArrayList<T>::IncrementalArrayList(const IncrementalArrayList<T> &src)
+    : mArray(nullptr),
+      mOld(nullptr),
+      mResource(src.mResource),
+      mSize(0),
+      mCapacity(0),
+      mOldSize(0),
+      mMigrated(0),
+      mMigrationStep(src.mMigrationStep) {
+    mArray = copyOf(src);
+    mSize = src.mSize;
+    mCapacity = src.mCapacity;
+}
+
+/**
+ * Move Constructor: Creates an IncrementalArrayList by taking over the buffers of another.
+ * @param src The IncrementalArrayList to be moved.
+ * @modifies Leaves 'src' empty.
+ * @return N/A
+ */
+template<typename T>
+IncrementalArrayList<T>::IncrementalArrayList(IncrementalArrayList<T> &&src) noexcept
+    : IncrementalArrayList(*src.mResource, src.mMigrationStep) {
+    swap(src);
+}
+
+/**
+ * Destructor: Destroys the elements and releases both buffers.
+ * @param N/A
+ * @modifies Returns the buffers to the resource.
+ * @return N/A
+ */
+template<typename T>
+IncrementalArrayList<T>::~IncrementalArrayList() {clear();}
+
+/**
+ * Copy Assignment Operator: Makes this list a copy of another.
+ * @param src The IncrementalArrayList to be copied.
+ * @modifies Copies every element of 'src' into a single buffer of the same capacity, allocated
+ *           from this list's resource, and releases the old buffers. Takes the migration step of
+ *           'src'.
+ * @return A reference to this IncrementalArrayList.
+ */
+template<typename T>
+IncrementalArrayList<T> &IncrementalArrayList<T>::operator=(const IncrementalArrayList<T> &src) {
+    if (this != &src) {
+        T* buffer = copyOf(src);
+        clear();
+        mArray = buffer;
+        mSize = src.mSize;
+        mCapacity = src.mCapacity;
+        mMigrationStep = src.mMigrationStep;
+    }
+    return *this;
+}
+
+/**
+ * Move Assignment Operator: Assigns the contents of another IncrementalArrayList by moving.
+ * @param src The IncrementalArrayList to be moved.
+ * @modifies Takes over the buffers of 'src' if both lists allocate from the same resource, and
+ *           otherwise moves the elements into a single buffer from this list's resource. Takes the
+ *           migration step of 'src' and leaves 'src' empty.
+ * @return A reference to this IncrementalArrayList.
+ */
+template<typename T>
+IncrementalArrayList<T> &IncrementalArrayList<T>::operator=(IncrementalArrayList<T> &&src) {
+    if (this == &src)
+        return *this;
+
+    if (mResource == src.mResource || mResource->is_equal(*src.mResource)) {
+        clear();
+        swap(src);
+        std::swap(mResource, src.mResource);
+        return *this;
+    }
+
+    T* buffer;
+    if constexpr (std::is_nothrow_move_constructible_v<T>) {
+        buffer = allocate(src.mCapacity);
+        for (uint32_t i = 0; i < src.mSize; ++i)
+            ::new (static_cast<void*>(buffer + i)) T(std::move(src[i]));
+    } else {
+        buffer = copyOf(src);
+    }
+    clear();
+    mArray = buffer;
+    mSize = src.mSize;
+    mCapacity = src.mCapacity;
+    mMigrationStep = src.mMigrationStep;
+    src.clear();
+    return *this;
+}
+
+/**
+ * Adds an element to the end of the list.
+ * @param value The value to be added.
+ * @modifies Appends 'value', growing or migrating a bounded number of elements.
+ * @return A reference to the capacity of the list.
+ */
+template<typename T>
+const uint32_t &IncrementalArrayList<T>::add(const T &value) {return add(mSize, value);}
+
+/**
+ * Inserts an element at a specific index.
+ * @param index The index at which to insert the element.
+ * @param value The value to be inserted.
+ * @modifies Appends reuse spare capacity, or start a migration into a buffer of double the
+ *           capacity, and then migrate at most migrationStep() elements. Any other insertion
+ *           finishes the migration and then builds a new buffer and swaps it in.
+ * @throws std::length_error if the list would exceed UINT32_MAX elements.
+ * @return A reference to the capacity of the list.
+ */
+template<typename T>
+const uint32_t &IncrementalArrayList<T>::add(const uint32_t &index, const T &value) {
+    uint64_t newSize = uint64_t(std::max(index, mSize)) + 1;
+    if (newSize > UINT32_MAX)
+        throwLengthError("IncrementalArrayList cannot exceed UINT32_MAX elements");
+
+    if (index == mSize) {
+        if (mSize == mCapacity) {
+            finishMigration(); // Never needed: the migration always ends before the buffer fills
+            uint32_t newCapacity = static_cast<uint32_t>(
+                std::min<uint64_t>(std::max<uint64_t>(uint64_t(mCapacity) * 2, 1), UINT32_MAX));
+            T* grown = allocate(newCapacity);
+            CONTAINER_TRY {
+                ::new (static_cast<void*>(grown + mSize)) T(value);
+            } CONTAINER_CATCH_ALL {
+                release(grown, 0, newCapacity);
+                CONTAINER_RETHROW;
+            }
+            mOld = mArray;
+            mArray = grown;
+            mCapacity = newCapacity;
+            mOldSize = mSize;
+            mMigrated = 0;
+        } else {
+            ::new (static_cast<void*>(mArray + mSize)) T(value);
+        }
+        // 'value' is stored before migrating, since it may refer to a pending element. If the
+        // migration throws, the stored copy is destroyed and the size is unchanged.
+        CONTAINER_TRY {
+            migrate(mMigrationStep);
+        } CONTAINER_CATCH_ALL {
+            mArray[mSize].~T();
+            CONTAINER_RETHROW;
+        }
+        ++mSize;
+        return mCapacity;
+    }
+
+    T copy(value);
+    finishMigration();
+
+    uint64_t newCapacity = std::max<uint64_t>(mCapacity, 1);
+    while (newCapacity < newSize)
+        newCapacity *= 2;
+    newCapacity = std::min<uint64_t>(newCapacity, UINT32_MAX);
+
+    uint32_t prefix = std::min(index, mSize);
+    T* temp = allocate(static_cast<uint32_t>(newCapacity));
+    uint32_t built = 0;
+    CONTAINER_TRY {
+        for (; built < prefix; ++built)
+            ::new (static_cast<void*>(temp + built)) T(mArray[built]);
+        for (; built < index; ++built)
+            ::new (static_cast<void*>(temp + built)) T();
+        ::new (static_cast<void*>(temp + built)) T(copy);
+        for (++built; built < newSize; ++built)
+            ::new (static_cast<void*>(temp + built)) T(mArray[built - 1]);
+    } CONTAINER_CATCH_ALL {
+        release(temp, built, static_cast<uint32_t>(newCapacity));
+        CONTAINER_RETHROW;
+    }
+
+    release(mArray, mSize, mCapacity);
+    mArray = temp;
+    mSize = static_cast<uint32_t>(newSize);
+    mCapacity = static_cast<uint32_t>(newCapacity);
+    return mCapacity;
+}
+
+/**
+ * Retrieves the element at a specific index.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return A constant reference to the element at the specified index.
+ */
+template<typename T>
+const T &IncrementalArrayList<T>::get(const uint32_t &index) const {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    return (*this)[index];
+}
+
+/**
+ * Retrieves a reference to the element at a specific index.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return A reference to the element at the specified index, allowing modification.
+ */
+template<typename T>
+T &IncrementalArrayList<T>::get(const uint32_t &index) {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    return (*this)[index];
+}
+
+/**
+ * Accesses the element at a specific index without range checking, in whichever buffer holds it.
+ * @param index The index of the element to access.
+ * @modifies N/A
+ * @return A reference to the element at the specified index, allowing modification.
+ */
+template<typename T>
+T &IncrementalArrayList<T>::operator[](const uint32_t &index) {
+    return migrated(index) ? mArray[index] : mOld[index];
+}
+
+/**
+ * Accesses the element at a specific index without range checking, in whichever buffer holds it.
+ * @param index The index of the element to access.
+ * @modifies N/A
+ * @return A constant reference to the element at the specified index.
+ */
+template<typename T>
+const T &IncrementalArrayList<T>::operator[](const uint32_t &index) const {
+    return migrated(index) ? mArray[index] : mOld[index];
+}
+
+/**
+ * Sets the value of the element at a specific index.
+ * @param index The index of the element to set.
+ * @param value The new value to set.
+ * @modifies Sets the value of the element in whichever buffer holds it.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return N/A
+ */
+template<typename T>
+void IncrementalArrayList<T>::set(const uint32_t &index, const T &value) {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    (*this)[index] = value;
+}
+
+/**
+ * Removes and returns the element at a specific index.
+ * @param index The index of the element to remove.
+ * @modifies Finishes any migration, then shifts the following elements down. This happens in
+ *           place if T can be moved without throwing; otherwise a new buffer is built and swapped in.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return The removed element.
+ */
+template<typename T>
+T IncrementalArrayList<T>::remove(const uint32_t &index) {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    finishMigration();
+    T removed = mArray[index];
+    if constexpr (std::is_nothrow_move_assignable_v<T>) {
+        std::move(mArray + index + 1, mArray + mSize, mArray + index);
+        mArray[mSize - 1].~T();
+    } else {
+        T* temp = allocate(mCapacity);
+        uint32_t built = 0;
+        CONTAINER_TRY {
+            for (; built < mSize - 1; ++built) {
+                const T& kept = mArray[built < index ? built : built + 1];
+                ::new (static_cast<void*>(temp + built)) T(kept);
+            }
+        } CONTAINER_CATCH_ALL {
+            release(temp, built, mCapacity);
+            CONTAINER_RETHROW;
+        }
+        release(mArray, mSize, mCapacity);
+        mArray = temp;
+    }
+
+    --mSize;
+    return removed;
+}
+
+/**
+ * Migrates every pending element into the current buffer.
+ * @param N/A
+ * @modifies Moves the pending elements and releases the old buffer.
+ * @return N/A
+ */
+template<typename T>
+void IncrementalArrayList<T>::finishMigration() {migrate(mOldSize - mMigrated);}
+
+/**
+ * Checks whether a migration is in progress.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if some elements still live in the old buffer, 'false' otherwise.
+ */
+template<typename T>
+bool IncrementalArrayList<T>::isMigrating() const {return mMigrated < mOldSize;}
+
+/**
+ * Returns the maximum number of elements migrated by each append.
+ * @param N/A
+ * @modifies N/A
+ * @return The migration step.
+ */
+template<typename T>
+uint32_t IncrementalArrayList<T>::migrationStep() const {return mMigrationStep;}
+
+/**
+ * Clears the list, releasing both buffers.
+ * @param N/A
+ * @modifies Destroys the elements, returns the buffers and resets the size, capacity and
+ *           migration state.
+ * @return N/A
+ */
+template<typename T>
+void IncrementalArrayList<T>::clear() {
+    if (mOld) {
+        std::destroy_n(mArray, mMigrated);
+        releaseOld();
+        std::destroy(mArray + mOldSize, mArray + mSize);
+    } else {
+        std::destroy_n(mArray, mSize);
+    }
+    release(mArray, 0, mCapacity);
+    mArray = nullptr;
+    mSize = mCapacity = mOldSize = mMigrated = 0;
+}
+
+/**
+ * Checks if the list is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the list is empty, 'false' otherwise.
+ */
+template<typename T>
+bool IncrementalArrayList<T>::isEmpty() const {return mSize == 0;}
+
+/**
+ * Returns the current size of the list.
+ * @param N/A
+ * @modifies N/A
+ * @return The current size of the list.
+ */
+template<typename T>
+uint32_t IncrementalArrayList<T>::size() const {return mSize;}
+
+/**
+ * Returns the capacity of the current buffer.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of elements that fit without growing.
+ */
+template<typename T>
+uint32_t IncrementalArrayList<T>::capacity() const {return mCapacity;}
+
+/**
+ * Returns the memory held by the list.
+ * @param N/A
+ * @modifies N/A
+ * @return The bytes of the current buffer, plus those of the old buffer while migrating.
+ */
+template<typename T>
+size_t IncrementalArrayList<T>::memoryFootprint() const {
+    return (size_t(mCapacity) + (mOld ? mOldSize : 0)) * sizeof(T);
+}
+
+/**
+ * Returns the memory resource the buffers are allocated from.
+ * @param N/A
+ * @modifies N/A
+ * @return The memory resource.
+ */
+template<typename T>
+std::pmr::memory_resource* IncrementalArrayList<T>::resource() const {return mResource;}
+
+/**
+ * Swaps the contents of two IncrementalArrayList objects.
+ * @param src The IncrementalArrayList to swap content with.
+ * @modifies Exchanges the buffers, resources, sizes and migration state between this and 'src'.
+ * @return N/A
+ */
+template<typename T>
+void IncrementalArrayList<T>::swap(IncrementalArrayList<T> &src) noexcept {
+    std::swap(mArray, src.mArray);
+    std::swap(mOld, src.mOld);
+    std::swap(mResource, src.mResource);
+    std::swap(mSize, src.mSize);
+    std::swap(mCapacity, src.mCapacity);
+    std::swap(mOldSize, src.mOldSize);
+    std::swap(mMigrated, src.mMigrated);
+    std::swap(mMigrationStep, src.mMigrationStep);
+}
+
+/**
+ * Migrates up to a number of pending elements from the old buffer into the current one, each
+ * constructed in place. Elements are moved if T's move constructor cannot throw and copied
+ * otherwise, so a throwing copy leaves every element intact and the migration simply resumes
+ * later.
+ * @param count The maximum number of elements to migrate.
+ * @modifies Advances the migration, releasing the old buffer once every element has moved.
+ * @return N/A
+ */
+template<typename T>
+void IncrementalArrayList<T>::migrate(uint32_t count) {
+    uint32_t end = mMigrated + std::min(count, mOldSize - mMigrated);
+    for (; mMigrated < end; ++mMigrated) {
+        void* slot = static_cast<void*>(mArray + mMigrated);
+        if constexpr (std::is_nothrow_move_constructible_v<T>)
+            ::new (slot) T(std::move(mOld[mMigrated]));
+        else
+            ::new (slot) T(mOld[mMigrated]);
+    }
+
+    if (mMigrated == mOldSize && mOld) {
+        releaseOld();
+        mOldSize = mMigrated = 0;
+    }
+}
+
+/**
+ * Checks whether an element lives in the current buffer.
+ * @param index The index of the element.
+ * @modifies N/A
+ * @return 'true' if the element was migrated or added after growth started, 'false' if it is
+ *         still in the old buffer.
+ */
+template<typename T>
+bool IncrementalArrayList<T>::migrated(uint32_t index) const {
+    return index < mMigrated || index >= mOldSize;
+}
+
+/**
+ * Allocates raw storage for a number of elements from the resource.
+ * @param capacity The number of elements.
+ * @modifies N/A
+ * @throws Whatever the resource throws if the allocation fails.
+ * @return The storage, with no element constructed, or nullptr if 'capacity' is 0.
+ */
+template<typename T>
+T* IncrementalArrayList<T>::allocate(uint32_t capacity) const {
+    if (capacity == 0)
+        return nullptr;
+    return static_cast<T*>(mResource->allocate(size_t(capacity) * sizeof(T), alignof(T)));
+}
+
+/**
+ * Copies the elements of a list, wherever they live, into a buffer from this list's resource.
+ * @param src The list to copy.
+ * @modifies N/A
+ * @return A buffer of src.capacity() elements, the first src.size() constructed.
+ */
+template<typename T>
+T* IncrementalArrayList<T>::copyOf(const IncrementalArrayList<T> &src) const {
+    T* buffer = allocate(src.mCapacity);
+    uint32_t built = 0;
+    CONTAINER_TRY {
+        for (; built < src.mSize; ++built)
+            ::new (static_cast<void*>(buffer + built)) T(src[built]);
+    } CONTAINER_CATCH_ALL {
+        release(buffer, built, src.mCapacity);
+        CONTAINER_RETHROW;
+    }
+    return buffer;
+}
+
+/**
+ * Destroys the leading elements of a buffer and returns it to the resource.
+ * @param buffer The buffer, or nullptr.
+ * @param constructed The number of leading elements constructed in it.
+ * @param capacity The number of elements it was allocated for.
+ * @modifies Destroys the elements and deallocates the buffer.
+ * @return N/A
+ */
+template<typename T>
+void IncrementalArrayList<T>::release(T *buffer, uint32_t constructed, uint32_t capacity) const {
+    if (buffer == nullptr)
+        return;
+    std::destroy_n(buffer, constructed);
+    mResource->deallocate(buffer, size_t(capacity) * sizeof(T), alignof(T));
+}
+
+/**
+ * Releases the old buffer, which holds mOldSize elements and was allocated for as many.
+ * @param N/A
+ * @modifies Destroys the elements left in the old buffer and deallocates it.
+ * @return N/A
+ */
+template<typename T>
+void IncrementalArrayList<T>::releaseOld() {
+    release(mOld, mOldSize, mOldSize);
+    mOld = nullptr;
+}
@@ -0,0 +1,203 @@
+// Author: Mac-Noble Brako-Kusi
+// File: IngestPipeline.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for the ingestFile pipeline
+
+#include <algorithm>
+#include <cerrno>
+#include <deque>
+#include <exception>
+#include <fcntl.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace ingest_pipeline {
+/**
+ * A file open for sequential reading, closed on destruction.
+ */
+class File {
+public:
+    /**
+     * Constructor: Opens a file for reading.
+     * @param path The file to open.
+     * @modifies Opens the file and tells the kernel it will be read sequentially.
+     * @throws std::system_error if the file cannot be opened.
+     * @return N/A
+     */
+    explicit File(const std::string& path)
+        : mPath(path),
+          mDescriptor(::open(path.c_str(), O_RDONLY | O_CLOEXEC)) {
+        if (mDescriptor < 0)
+            raiseError(std::system_error(errno, std::generic_category(), "cannot open " + path));
+        posix_fadvise(mDescriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+
+    ~File() {::close(mDescriptor);}
+
+    File(const File&) = delete;
+    File& operator=(const File&) = delete;
+
+    /**
+     * Reads up to a number of bytes.
+     * @param out Receives the bytes.
+     * @param count The most bytes to read.
+     * @modifies Advances the file position.
+     * @throws std::system_error if the read fails.
+     * @return The number of bytes read, 0 at the end of the file.
+     */
+    size_t read(char* out, size_t count) {
+        ssize_t got;
+        do {
+            got = ::read(mDescriptor, out, count);
+        } while (got < 0 && errno == EINTR);
+        if (got < 0)
+            raiseError(std::system_error(errno, std::generic_category(), "cannot read " + mPath));
+        return static_cast<size_t>(got);
+    }
+
+private:
+    std::string mPath;
+    int mDescriptor;
+};
+
+/**
+ * The reading stage: yields the file a chunk at a time, each chunk ending after the last delimiter
+ * read. The bytes after that delimiter start the next chunk. Each chunk is read when the sequence
+ * is advanced, on whichever thread advances it.
+ * @param file The file.
+ * @param options The chunk size and delimiter.
+ * @param stats Receives the bytes and chunks read.
+ * @modifies Advances the file position and counts into 'stats'.
+ * @throws std::system_error if the file cannot be read.
+ * @return The chunks, which the consumer may move out.
+ */
+inline Generator<std::vector<char>> readChunks(File &file, IngestOptions options,
+                                               IngestStats &stats) {
+    const size_t kChunkBytes = std::max<size_t>(options.chunkBytes, 1);
+    std::vector<char> carry;
+    bool ended = false;
+    while (!ended) {
+        std::vector<char> bytes(carry.begin(), carry.end());
+
+        // The carried bytes hold no delimiter, so only newly read bytes are searched
+        size_t split = 0;
+        while (split == 0 && !ended) {
+            size_t had = bytes.size();
+            bytes.resize(had + kChunkBytes);
+            size_t got = file.read(bytes.data() + had, kChunkBytes);
+            bytes.resize(had + got);
+            stats.bytesRead += got;
+            ended = got == 0;
+            for (size_t i = bytes.size(); i > had && split == 0; --i) {
+                if (bytes[i - 1] == options.delimiter)
+                    split = i;
+            }
+        }
+        // The last record need not end with a delimiter
+        if (ended)
+            split = bytes.size();
+
+        carry.assign(bytes.begin() + split, bytes.end());
+        bytes.resize(split);
+        if (!bytes.empty()) {
+            ++stats.chunks;
+            co_yield bytes;
+        }
+    }
+}
+
+/**
+ * The parsing stage for one chunk: moves to the parsing pool and parses the chunk there.
+ * @param parsers The parsing pool.
+ * @param bytes The chunk, a whole number of records.
+ * @param parse The record parser.
+ * @modifies N/A
+ * @throws What 'parse' throws.
+ * @return The parsed elements.
+ */
+template<typename T, typename Parse>
+Task<ArrayList<T>> parseChunk(ThreadPool &parsers, std::vector<char> bytes, const Parse &parse) {
+    co_await parsers.schedule();
+    ArrayList<T> elements;
+    parse(bytes.data(), bytes.data() + bytes.size(), elements);
+    co_return std::move(elements);
+}
+
+/**
+ * The whole pipeline. The chunks are read on the reading pool; each is handed to a parsing task
+ * as soon as it is read, and the next is read while the parsers work. Once inFlightChunks parses
+ * are running, the oldest is awaited and appended before another chunk is read, so batches are
+ * appended in file order and at most inFlightChunks chunks are held at once.
+ * @param file The file.
+ * @param target The list to append to.
+ * @param parse The record parser.
+ * @param options The tuning.
+ * @param reads The pool the file is read on.
+ * @param parsers The pool the chunks are parsed on.
+ * @modifies Appends the parsed elements to 'target', in file order.
+ * @throws std::system_error if the file cannot be read, or what 'parse' throws.
+ * @return What was read and appended.
+ */
+template<typename T, typename Parse>
+Task<IngestStats> ingest(File &file, ArrayList<T> &target, const Parse &parse,
+                         IngestOptions options, ThreadPool &reads, ThreadPool &parsers) {
+    const uint32_t kSlots = std::max<uint32_t>(options.inFlightChunks, 1);
+    IngestStats stats;
+    std::deque<Task<ArrayList<T>>> inFlight;
+    std::exception_ptr error;
+    CONTAINER_TRY {
+        co_await reads.schedule();
+        Generator<std::vector<char>> chunks = readChunks(file, options, stats);
+        for (auto chunk = chunks.begin(); chunk != chunks.end(); ++chunk) {
+            if (inFlight.size() == kSlots) {
+                ArrayList<T> elements = co_await inFlight.front();
+                inFlight.pop_front();
+                target.addAll(elements);
+                stats.elements += elements.size();
+                co_await reads.schedule();
+            }
+            inFlight.push_back(parseChunk<T>(parsers, std::move(*chunk), parse));
+            inFlight.back().start();
+        }
+        while (!inFlight.empty()) {
+            ArrayList<T> elements = co_await inFlight.front();
+            inFlight.pop_front();
+            target.addAll(elements);
+            stats.elements += elements.size();
+        }
+    } CONTAINER_CATCH_ALL {
+        error = std::current_exception();
+    }
+
+    // The first failure stops the reading, but parses already running must finish before their
+    // tasks are destroyed; their results are dropped
+    for (Task<ArrayList<T>>& task : inFlight)
+        co_await task.whenReady();
+    if (error)
+        std::rethrow_exception(error);
+    co_return stats;
+}
+} // Namespace
+
+/**
+ * Appends the records of a file to an ArrayList, reading, parsing and appending concurrently.
+ * @param path The file to read.
+ * @param target The list to append to.
+ * @param parse The record parser.
+ * @param options The tuning.
+ * @modifies Appends the parsed elements to 'target', in file order.
+ * @throws std::system_error if the file cannot be opened or read or a thread cannot be started,
+ *         or what 'parse' throws.
+ * @return What was read and appended.
+ */
+template<typename T, typename Parse>
+IngestStats ingestFile(const std::string &path, ArrayList<T> &target, const Parse &parse,
+                       const IngestOptions &options) {
+    const uint32_t kSlots = std::max<uint32_t>(options.inFlightChunks, 1);
+    ingest_pipeline::File file(path);
+    ThreadPool reads(1, 1);
+    ThreadPool parsers(options.parseThreads, kSlots);
+    return syncWait(ingest_pipeline::ingest(file, target, parse, options, reads, parsers));
+}
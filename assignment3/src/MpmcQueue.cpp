@@ -0,0 +1,219 @@
+// Author: Mac-Noble Brako-Kusi
+// File: MpmcQueue.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for MpmcQueue template class
+
+#include <algorithm>
+#include <utility>
+
+/**
+ * Constructor: Creates an empty MpmcQueue.
+ * @param capacity The least number of elements the queue can hold.
+ * @modifies Allocates the ring and gives every slot to the producers of the first lap.
+ * @throws std::invalid_argument if the capacity is 0 or greater than 2^31.
+ * @return N/A
+ */
+template<typename T>
+MpmcQueue<T>::MpmcQueue(uint32_t capacity)
+    : mSlots(roundCapacity(capacity), nullptr),
+      mMask(roundCapacity(capacity) - 1),
+      mTail(0),
+      mHead(0) {
+    for (uint64_t i = 0; i <= mMask; ++i)
+        mSlots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+/**
+ * Appends an element, unless the queue is full.
+ * @param value The element to append.
+ * @modifies Publishes the element to the consumers.
+ * @return 'true' if the element was appended, 'false' if the queue was full.
+ */
+template<typename T>
+bool MpmcQueue<T>::tryPush(const T &value) {return push(value);}
+
+/**
+ * Appends an element by moving it, unless the queue is full.
+ * @param value The element to append.
+ * @modifies Publishes the element to the consumers; 'value' is moved from only on success.
+ * @return 'true' if the element was appended, 'false' if the queue was full.
+ */
+template<typename T>
+bool MpmcQueue<T>::tryPush(T &&value) {return push(std::move(value));}
+
+/**
+ * Appends a run of elements.
+ * @param values The elements to append.
+ * @param count The number of elements.
+ * @modifies Publishes the appended elements to the consumers.
+ * @return The number of elements appended.
+ */
+template<typename T>
+uint32_t MpmcQueue<T>::tryPushBatch(const T *values, uint32_t count) {
+    uint64_t position = claim(mTail, count, 0);
+    for (uint32_t i = 0; i < count; ++i) {
+        Slot& slot = mSlots[(position + i) & mMask];
+        awaitTurn(slot, position + i);
+        slot.value = values[i];
+        slot.sequence.store(position + i + 1, std::memory_order_release);
+    }
+    return count;
+}
+
+/**
+ * Removes the oldest element, unless the queue is empty.
+ * @param out Receives the element.
+ * @modifies Hands the element's slot to the producers of the next lap.
+ * @return 'true' if an element was removed, 'false' if the queue was empty.
+ */
+template<typename T>
+bool MpmcQueue<T>::tryPop(T &out) {
+    uint32_t count = 1;
+    uint64_t position = claim(mHead, count, 1);
+    if (count == 0)
+        return false;
+
+    Slot& slot = mSlots[position & mMask];
+    out = std::move(slot.value);
+    slot.sequence.store(position + mMask + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * Removes a run of the oldest elements.
+ * @param out Receives the elements.
+ * @param max The most elements to remove.
+ * @modifies Hands the elements' slots to the producers of the next lap.
+ * @return The number of elements removed.
+ */
+template<typename T>
+uint32_t MpmcQueue<T>::tryPopBatch(T *out, uint32_t max) {
+    uint64_t position = claim(mHead, max, 1);
+    for (uint32_t i = 0; i < max; ++i) {
+        Slot& slot = mSlots[(position + i) & mMask];
+        awaitTurn(slot, position + i + 1);
+        out[i] = std::move(slot.value);
+        slot.sequence.store(position + i + mMask + 1, std::memory_order_release);
+    }
+    return max;
+}
+
+/**
+ * Returns the number of elements in the queue.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of elements, approximate while any thread is running.
+ */
+template<typename T>
+uint32_t MpmcQueue<T>::size() const {
+    uint64_t head = mHead.load(std::memory_order_acquire);
+    uint64_t tail = mTail.load(std::memory_order_acquire);
+    return tail > head ? static_cast<uint32_t>(std::min<uint64_t>(tail - head, mMask + 1)) : 0;
+}
+
+/**
+ * Checks if the queue is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the queue holds no elements, 'false' otherwise.
+ */
+template<typename T>
+bool MpmcQueue<T>::isEmpty() const {return size() == 0;}
+
+/**
+ * Returns the capacity of the queue.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of elements the queue can hold.
+ */
+template<typename T>
+uint32_t MpmcQueue<T>::capacity() const {return static_cast<uint32_t>(mMask + 1);}
+
+/**
+ * Appends an element, copying or moving it, unless the queue is full.
+ * @param value The element to append.
+ * @modifies Publishes the element to the consumers.
+ * @return 'true' if the element was appended, 'false' if the queue was full.
+ */
+template<typename T>
+template<typename Value>
+bool MpmcQueue<T>::push(Value &&value) {
+    uint32_t count = 1;
+    uint64_t position = claim(mTail, count, 0);
+    if (count == 0)
+        return false;
+
+    Slot& slot = mSlots[position & mMask];
+    slot.value = std::forward<Value>(value);
+    slot.sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * Claims a run of consecutive positions by advancing the head or the tail. A run is claimed once
+ * its last slot has reached its turn. Every slot before it then belongs to a position the other
+ * side has already claimed, so its turn is at most a write or a read away.
+ * @param index The tail, for producers, or the head, for consumers.
+ * @param count The number of positions wanted; receives the number claimed, 0 if none was ready.
+ * @param turn 0 for producers, whose slots are ready at sequence p, and 1 for consumers, whose
+ *             slots are ready at p + 1.
+ * @modifies Advances 'index' past the claimed run.
+ * @return The first claimed position.
+ */
+template<typename T>
+uint64_t MpmcQueue<T>::claim(std::atomic<uint64_t> &index, uint32_t &count, uint64_t turn) {
+    uint64_t run = std::min<uint64_t>(count, mMask + 1);
+    uint64_t position = index.load(std::memory_order_relaxed);
+    while (run > 0) {
+        uint64_t last = position + run - 1;
+        uint64_t sequence = mSlots[last & mMask].sequence.load(std::memory_order_acquire);
+        int64_t lag = static_cast<int64_t>(sequence - (last + turn));
+        if (lag == 0) {
+            if (index.compare_exchange_weak(position, position + run, std::memory_order_relaxed))
+                break;
+        } else if (lag < 0) {
+            run /= 2;
+        } else {
+            position = index.load(std::memory_order_relaxed);
+        }
+    }
+    count = static_cast<uint32_t>(run);
+    return position;
+}
+
+/**
+ * Waits for a claimed slot to reach its turn, yielding the processor after a short spin in case
+ * the thread it waits for is not running.
+ * @param slot The slot.
+ * @param sequence The sequence at which the slot is ready.
+ * @modifies N/A
+ * @return N/A
+ */
+template<typename T>
+void MpmcQueue<T>::awaitTurn(const Slot &slot, uint64_t sequence) const {
+    const uint32_t kSpins = 64;
+    for (uint32_t spins = 0; slot.sequence.load(std::memory_order_acquire) != sequence; ++spins) {
+        if (spins < kSpins)
+            Futex::pause();
+        else
+            std::this_thread::yield();
+    }
+}
+
+/**
+ * Rounds a requested capacity up to a power of two.
+ * @param capacity The requested capacity.
+ * @modifies N/A
+ * @throws std::invalid_argument if the capacity is 0 or greater than 2^31.
+ * @return The capacity to allocate.
+ */
+template<typename T>
+uint32_t MpmcQueue<T>::roundCapacity(uint32_t capacity) {
+    if (capacity == 0 || capacity > (1U << 31))
+        throwInvalidArgument("queue capacity must be between 1 and 2^31");
+
+    uint32_t rounded = 1;
+    while (rounded < capacity)
+        rounded <<= 1;
+    return rounded;
+}
@@ -0,0 +1,329 @@
+// Author: Mac-Noble Brako-Kusi
+// File: ParallelBuilder.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for ParallelBuilder and SegmentedView template classes
+
+#include <algorithm>
+
+/**
+ * Constructor: Creates an empty SegmentedView.
+ * @param N/A
+ * @modifies Initializes a view of no segments.
+ * @return N/A
+ */
+template<typename T>
+SegmentedView<T>::SegmentedView()
+    : mSegments(),
+      mOffsets(1, 0) {}
+
+/**
+ * Constructor: Creates a SegmentedView owning a sequence of segments.
+ * @param segments The segments, in order.
+ * @modifies Takes the non-empty segments and computes their offsets.
+ * @return N/A
+ */
+template<typename T>
+SegmentedView<T>::SegmentedView(std::vector<ArrayList<T>> &&segments)
+    : mSegments(),
+      mOffsets(1, 0) {
+    for (ArrayList<T>& segment : segments) {
+        if (segment.isEmpty())
+            continue;
+        mOffsets.push_back(mOffsets.back() + segment.size());
+        mSegments.push_back(std::move(segment));
+    }
+}
+
+/**
+ * Retrieves the element at a specific index, counting across segments.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return A constant reference to the element at the specified index.
+ */
+template<typename T>
+const T &SegmentedView<T>::get(uint64_t index) const {
+    if (index >= size())
+        throwOutOfRange(index);
+
+    return (*this)[index];
+}
+
+/**
+ * Accesses the element at a specific index without range checking.
+ * @param index The index of the element to access.
+ * @modifies N/A
+ * @return A constant reference to the element at the specified index.
+ */
+template<typename T>
+const T &SegmentedView<T>::operator[](uint64_t index) const {
+    uint32_t segment = segmentOf(index);
+    return mSegments[segment][static_cast<uint32_t>(index - mOffsets[segment])];
+}
+
+/**
+ * Returns the number of segments.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of non-empty segments.
+ */
+template<typename T>
+uint32_t SegmentedView<T>::segments() const {return static_cast<uint32_t>(mSegments.size());}
+
+/**
+ * Returns one segment.
+ * @param segment The segment number.
+ * @modifies N/A
+ * @return A constant reference to the segment.
+ */
+template<typename T>
+const ArrayList<T> &SegmentedView<T>::segment(uint32_t segment) const {return mSegments[segment];}
+
+/**
+ * Returns the total number of elements.
+ * @param N/A
+ * @modifies N/A
+ * @return The size of the view.
+ */
+template<typename T>
+uint64_t SegmentedView<T>::size() const {return mOffsets.back();}
+
+/**
+ * Checks if the view is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the view has no elements, 'false' otherwise.
+ */
+template<typename T>
+bool SegmentedView<T>::isEmpty() const {return size() == 0;}
+
+/**
+ * Copies the elements into one contiguous ArrayList.
+ * @param threads The number of threads to use, or 0 for one per hardware thread.
+ * @modifies N/A
+ * @throws std::length_error if the view holds more elements than an ArrayList can, or whatever
+ *         copying an element throws.
+ * @return The ArrayList.
+ */
+template<typename T>
+ArrayList<T> SegmentedView<T>::flatten(uint32_t threads) const {
+    std::vector<const T*> segments;
+    segments.reserve(mSegments.size());
+    for (const ArrayList<T>& segment : mSegments)
+        segments.push_back(segment.data());
+    return concatenate(segments, mOffsets, threads, [](const T* begin, const T* end, T* out) {
+        std::copy(begin, end, out);
+    });
+}
+
+/**
+ * Finds the segment holding an element.
+ * @param index The index of the element, which must be in range.
+ * @modifies N/A
+ * @return The segment number.
+ */
+template<typename T>
+uint32_t SegmentedView<T>::segmentOf(uint64_t index) const {
+    auto next = std::upper_bound(mOffsets.begin(), mOffsets.end(), index);
+    return static_cast<uint32_t>(next - mOffsets.begin() - 1);
+}
+
+/**
+ * Concatenates segments into a new ArrayList. The destination is allocated before anything is
+ * transferred, then split into equal ranges, one per thread, and each thread transfers the parts
+ * of the segments that land in its range.
+ * @param segments The elements of each segment.
+ * @param offsets The offset of each segment, followed by the total.
+ * @param threads The number of threads to use, or 0 for one per hardware thread.
+ * @param transfer The function copying or moving [begin, end) to out.
+ * @modifies Whatever 'transfer' does to the segments.
+ * @throws std::length_error if the total exceeds what an ArrayList can hold, or whatever the
+ *         allocation or 'transfer' throws.
+ * @return The ArrayList.
+ */
+template<typename T>
+template<typename Element, typename Transfer>
+ArrayList<T> SegmentedView<T>::concatenate(const std::vector<Element*> &segments,
+                                           const std::vector<uint64_t> &offsets, uint32_t threads,
+                                           Transfer transfer) {
+    const uint64_t kMinShare = 1U << 16;
+    uint64_t total = offsets.back();
+    if (total > UINT32_MAX)
+        throwLengthError("concatenation exceeds the size of an ArrayList");
+
+    ArrayList<T> result = ArrayList<T>::forOverwrite(static_cast<uint32_t>(total));
+    T* out = result.data();
+    threads = static_cast<uint32_t>(std::min<uint64_t>(threadsFor(threads),
+                                                       std::max<uint64_t>(1, total / kMinShare)));
+    parallelFor(threads, [&](uint32_t t) {
+        uint64_t begin = total * t / threads;
+        uint64_t end = total * (t + 1) / threads;
+        auto next = std::upper_bound(offsets.begin(), offsets.end(), begin);
+        for (size_t s = next - offsets.begin() - 1; s < segments.size() && offsets[s] < end; ++s) {
+            uint64_t from = std::max(begin, offsets[s]);
+            uint64_t to = std::min(end, offsets[s + 1]);
+            Element* data = segments[s];
+            transfer(data + (from - offsets[s]), data + (to - offsets[s]), out + from);
+        }
+    });
+    return result;
+}
+
+/**
+ * Constructor: Creates a ParallelBuilder with a number of numbered chunks.
+ * @param workers The number of chunks reachable through chunk().
+ * @modifies Creates 'workers' empty chunks.
+ * @return N/A
+ */
+template<typename T>
+ParallelBuilder<T>::ParallelBuilder(uint32_t workers)
+    : mId(nextId()),
+      mWorkerChunks(workers) {}
+
+/**
+ * Returns the chunk of a numbered worker.
+ * @param worker The worker number.
+ * @modifies N/A
+ * @throws std::out_of_range if there is no such worker.
+ * @return A reference to the chunk.
+ */
+template<typename T>
+ArrayList<T> &ParallelBuilder<T>::chunk(uint32_t worker) {
+    if (worker >= mWorkerChunks.size())
+        throwOutOfRange(worker);
+
+    return mWorkerChunks[worker];
+}
+
+/**
+ * Returns the calling thread's chunk. The last builder and chunk each thread used are cached, so
+ * only a thread's first call, or a call after using another builder, takes the lock.
+ * @param N/A
+ * @modifies Creates the thread's chunk on its first call.
+ * @return A reference to the chunk.
+ */
+template<typename T>
+ArrayList<T> &ParallelBuilder<T>::local() {
+    thread_local uint64_t cachedId = 0;
+    thread_local ArrayList<T>* cachedChunk = nullptr;
+    if (cachedId == mId)
+        return *cachedChunk;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::thread::id self = std::this_thread::get_id();
+    auto owner = std::find(mLocalOwners.begin(), mLocalOwners.end(), self);
+    if (owner == mLocalOwners.end()) {
+        mLocalChunks.push_back(std::make_unique<ArrayList<T>>());
+        mLocalOwners.push_back(self);
+        owner = mLocalOwners.end() - 1;
+    }
+    cachedId = mId;
+    cachedChunk = mLocalChunks[owner - mLocalOwners.begin()].get();
+    return *cachedChunk;
+}
+
+/**
+ * Returns the total number of elements in the chunks.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of elements.
+ */
+template<typename T>
+uint64_t ParallelBuilder<T>::size() const {
+    uint64_t total = 0;
+    for (const ArrayList<T>& chunk : mWorkerChunks)
+        total += chunk.size();
+    for (const std::unique_ptr<ArrayList<T>>& chunk : mLocalChunks)
+        total += chunk->size();
+    return total;
+}
+
+/**
+ * Concatenates the chunks into one ArrayList, transferring straight out of the chunks into a
+ * destination allocated first, and empties the chunks only once every element is in place.
+ * @param threads The number of threads to use, or 0 for one per hardware thread.
+ * @modifies Empties every chunk, unless the concatenation throws.
+ * @throws std::length_error if the chunks hold more elements than an ArrayList can, or whatever
+ *         the allocation or copying an element throws.
+ * @return The concatenation.
+ */
+template<typename T>
+ArrayList<T> ParallelBuilder<T>::build(uint32_t threads) {
+    std::vector<ArrayList<T>*> chunks = chunkList();
+    std::vector<T*> segments;
+    std::vector<uint64_t> offsets(1, 0);
+    for (ArrayList<T>* chunk : chunks) {
+        if (chunk->isEmpty())
+            continue;
+        segments.push_back(chunk->data());
+        offsets.push_back(offsets.back() + chunk->size());
+    }
+
+    ArrayList<T> result = SegmentedView<T>::concatenate(segments, offsets, threads,
+                                                        [](T* begin, T* end, T* out) {
+        if constexpr (std::is_nothrow_move_assignable_v<T>)
+            std::move(begin, end, out);
+        else
+            std::copy(begin, end, out);
+    });
+    for (ArrayList<T>* chunk : chunks)
+        chunk->clear();
+    return result;
+}
+
+/**
+ * Hands the chunks over as a SegmentedView.
+ * @param N/A
+ * @modifies Empties every chunk.
+ * @return The view.
+ */
+template<typename T>
+SegmentedView<T> ParallelBuilder<T>::view() {return SegmentedView<T>(takeChunks());}
+
+/**
+ * Moves the chunks out of the builder, in concatenation order.
+ * @param N/A
+ * @modifies Leaves every chunk empty; the chunks of local() stay assigned to their threads.
+ * @return The chunks.
+ */
+template<typename T>
+std::vector<ArrayList<T>> ParallelBuilder<T>::takeChunks() {
+    std::vector<ArrayList<T>> chunks;
+    chunks.reserve(mWorkerChunks.size() + mLocalChunks.size());
+    for (ArrayList<T>& chunk : mWorkerChunks)
+        chunks.push_back(std::move(chunk));
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (std::unique_ptr<ArrayList<T>>& chunk : mLocalChunks)
+        chunks.push_back(std::move(*chunk));
+    return chunks;
+}
+
+/**
+ * Lists the chunks in concatenation order, without moving them.
+ * @param N/A
+ * @modifies N/A
+ * @return Pointers to the chunks; the chunks of local() never move once created.
+ */
+template<typename T>
+std::vector<ArrayList<T>*> ParallelBuilder<T>::chunkList() {
+    std::vector<ArrayList<T>*> chunks;
+    chunks.reserve(mWorkerChunks.size() + mLocalChunks.size());
+    for (ArrayList<T>& chunk : mWorkerChunks)
+        chunks.push_back(&chunk);
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (std::unique_ptr<ArrayList<T>>& chunk : mLocalChunks)
+        chunks.push_back(chunk.get());
+    return chunks;
+}
+
+/**
+ * Returns a number no other builder has used.
+ * @param N/A
+ * @modifies Advances the shared counter.
+ * @return The identifier, never 0.
+ */
+template<typename T>
+uint64_t ParallelBuilder<T>::nextId() {
+    static std::atomic<uint64_t> next(0);
+    return next.fetch_add(1, std::memory_order_relaxed) + 1;
+}
@@ -0,0 +1,657 @@
+// Author: Mac-Noble Brako-Kusi
+// File: PersistentArrayList.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for PersistentArrayList template class
+
+/**
+ * Constructor: Creates an empty PersistentArrayList.
+ * @param N/A
+ * @modifies Initializes an empty trie and an empty tail.
+ * @return N/A
+ */
+template<typename T>
+PersistentArrayList<T>::PersistentArrayList()
+    : mTree(emptyTree()) {}
+
+/**
+ * Constructor: Creates a PersistentArrayList holding a copy of an ArrayList.
+ * @param src The ArrayList to be copied.
+ * @modifies Builds the trie in place through a transient, one leaf at a time.
+ * @return N/A
+ */
+template<typename T>
+PersistentArrayList<T>::PersistentArrayList(const ArrayList<T> &src)
+    : mTree(emptyTree()) {
+    Transient builder(mTree);
+    for (uint32_t i = 0; i < src.size(); ++i)
+        builder.add(src[i]);
+    mTree = builder.persistent().mTree;
+}
+
+/**
+ * Constructor: Wraps an already built version.
+ * @param tree The state of the version.
+ * @modifies Initializes this version with 'tree'.
+ * @return N/A
+ */
+template<typename T>
+PersistentArrayList<T>::PersistentArrayList(const Tree &tree)
+    : mTree(tree) {}
+
+/**
+ * Retrieves the element at a specific index.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return A constant reference to the element at the specified index.
+ */
+template<typename T>
+const T& PersistentArrayList<T>::get(const uint32_t &index) const {
+    if (index >= mTree.size)
+        throwOutOfRange(index);
+
+    return (*this)[index];
+}
+
+/**
+ * Accesses the element at a specific index without range checking.
+ * @param index The index of the element to access.
+ * @modifies N/A
+ * @return A constant reference to the element at the specified index.
+ */
+template<typename T>
+const T& PersistentArrayList<T>::operator[](const uint32_t &index) const {
+    return leafFor(mTree, index).mValues[index & kMask];
+}
+
+/**
+ * Returns a new version with an element appended.
+ * @param value The value to be added.
+ * @modifies N/A
+ * @return The new version.
+ */
+template<typename T>
+PersistentArrayList<T> PersistentArrayList<T>::add(const T &value) const {
+    Tree tree = mTree;
+    push(tree, value, 0);
+    return PersistentArrayList<T>(tree);
+}
+
+/**
+ * Returns a new version with an element inserted at a specific index.
+ * @param index The index at which to insert the element.
+ * @param value The value to be inserted.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is greater than the size.
+ * @return The new version.
+ */
+template<typename T>
+PersistentArrayList<T> PersistentArrayList<T>::add(const uint32_t &index, const T &value) const {
+    if (index > mTree.size)
+        throwOutOfRange(index);
+
+    // Pop the suffix off a transient, then push the new value followed by the suffix back on.
+    ArrayList<T> suffix(mTree.size - index);
+    for (uint32_t i = index; i < mTree.size; ++i)
+        suffix[i - index] = (*this)[i];
+
+    Transient edit = transient();
+    while (edit.size() > index)
+        edit.removeLast();
+    edit.add(value);
+    for (uint32_t i = 0; i < suffix.size(); ++i)
+        edit.add(suffix[i]);
+    return edit.persistent();
+}
+
+/**
+ * Returns a new version with the element at a specific index replaced.
+ * @param index The index of the element to set.
+ * @param value The new value to set.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return The new version.
+ */
+template<typename T>
+PersistentArrayList<T> PersistentArrayList<T>::set(const uint32_t &index, const T &value) const {
+    if (index >= mTree.size)
+        throwOutOfRange(index);
+
+    Tree tree = mTree;
+    assign(tree, index, value, 0);
+    return PersistentArrayList<T>(tree);
+}
+
+/**
+ * Returns a new version with the element at a specific index removed.
+ * @param index The index of the element to remove.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return The new version.
+ */
+template<typename T>
+PersistentArrayList<T> PersistentArrayList<T>::remove(const uint32_t &index) const {
+    if (index >= mTree.size)
+        throwOutOfRange(index);
+
+    if (index == mTree.size - 1)
+        return removeLast();
+
+    Transient edit = transient();
+    while (edit.size() > index)
+        edit.removeLast();
+    for (uint32_t i = index + 1; i < mTree.size; ++i)
+        edit.add((*this)[i]);
+    return edit.persistent();
+}
+
+/**
+ * Returns a new version without the last element.
+ * @param N/A
+ * @modifies N/A
+ * @throws std::out_of_range if the list is empty.
+ * @return The new version.
+ */
+template<typename T>
+PersistentArrayList<T> PersistentArrayList<T>::removeLast() const {
+    if (mTree.size == 0)
+        throwOutOfRange("0");
+
+    Tree tree = mTree;
+    pop(tree, 0);
+    return PersistentArrayList<T>(tree);
+}
+
+/**
+ * Checks if the list is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the list is empty, 'false' otherwise.
+ */
+template<typename T>
+bool PersistentArrayList<T>::isEmpty() const {return mTree.size == 0;}
+
+/**
+ * Returns the size of the list.
+ * @param N/A
+ * @modifies N/A
+ * @return The size of the list.
+ */
+template<typename T>
+uint32_t PersistentArrayList<T>::size() const {return mTree.size;}
+
+/**
+ * Starts a batch of in-place edits on top of this version.
+ * @param N/A
+ * @modifies N/A
+ * @return A Transient over a copy of this version.
+ */
+template<typename T>
+typename PersistentArrayList<T>::Transient PersistentArrayList<T>::transient() const {
+    return Transient(mTree);
+}
+
+/**
+ * Copies the elements of this version into a new ArrayList.
+ * @param N/A
+ * @modifies N/A
+ * @return An ArrayList holding the same elements.
+ */
+template<typename T>
+ArrayList<T> PersistentArrayList<T>::toArrayList() const {
+    ArrayList<T> result(mTree.size);
+    for (uint32_t i = 0; i < mTree.size; i += kWidth) {
+        const Leaf& leaf = leafFor(mTree, i);
+        uint32_t count = std::min(kWidth, mTree.size - i);
+        std::copy(leaf.mValues, leaf.mValues + count, &result[i]);
+    }
+    return result;
+}
+
+/**
+ * Builds the state of an empty version.
+ * @param N/A
+ * @modifies N/A
+ * @return An empty trie of height one and an empty tail.
+ */
+template<typename T>
+typename PersistentArrayList<T>::Tree PersistentArrayList<T>::emptyTree() {
+    return Tree{0, kBits, std::make_shared<Branch>(0), std::make_shared<Leaf>(0)};
+}
+
+/**
+ * Hands out a fresh transient identifier. Identifiers are never reused, so nodes frozen by one
+ * transient can never be edited in place by a later one.
+ * @param N/A
+ * @modifies Advances the global identifier counter.
+ * @return A non-zero identifier.
+ */
+template<typename T>
+uint64_t PersistentArrayList<T>::nextEdit() {
+    static std::atomic<uint64_t> counter(0);
+    return ++counter;
+}
+
+/**
+ * Computes the index of the first element stored in the tail.
+ * @param tree The version to inspect.
+ * @modifies N/A
+ * @return The number of elements stored in the trie.
+ */
+template<typename T>
+uint32_t PersistentArrayList<T>::tailOffset(const Tree &tree) {
+    return tree.size < kWidth ? 0 : ((tree.size - 1) >> kBits) << kBits;
+}
+
+/**
+ * Finds the leaf that holds a specific index.
+ * @param tree The version to search.
+ * @param index The index of the element.
+ * @modifies N/A
+ * @return The leaf holding 'index'.
+ */
+template<typename T>
+const typename PersistentArrayList<T>::Leaf &PersistentArrayList<T>::leafFor(const Tree &tree,
+        uint32_t index) {
+    if (index >= tailOffset(tree))
+        return *tree.tail;
+
+    const Node* node = tree.root.get();
+    for (uint32_t level = tree.shift; level > 0; level -= kBits)
+        node = static_cast<const Branch*>(node)->mChildren[(index >> level) & kMask].get();
+    return *static_cast<const Leaf*>(node);
+}
+
+/**
+ * Returns a branch that may be modified on behalf of a specific transient.
+ * @param node The branch to be modified.
+ * @param edit The transient identifier, or zero for a persistent change.
+ * @modifies N/A
+ * @return 'node' itself if the transient already owns it, a copy otherwise.
+ */
+template<typename T>
+std::shared_ptr<typename PersistentArrayList<T>::Branch>
+PersistentArrayList<T>::editable(const std::shared_ptr<Branch> &node, uint64_t edit) {
+    if (edit != 0 && node->mEdit == edit)
+        return node;
+
+    std::shared_ptr<Branch> copy = std::make_shared<Branch>(edit);
+    std::copy(node->mChildren, node->mChildren + kWidth, copy->mChildren);
+    return copy;
+}
+
+/**
+ * Returns a leaf that may be modified on behalf of a specific transient.
+ * @param node The leaf to be modified.
+ * @param edit The transient identifier, or zero for a persistent change.
+ * @modifies N/A
+ * @return 'node' itself if the transient already owns it, a copy otherwise.
+ */
+template<typename T>
+std::shared_ptr<typename PersistentArrayList<T>::Leaf>
+PersistentArrayList<T>::editable(const std::shared_ptr<Leaf> &node, uint64_t edit) {
+    if (edit != 0 && node->mEdit == edit)
+        return node;
+
+    std::shared_ptr<Leaf> copy = std::make_shared<Leaf>(edit);
+    std::copy(node->mValues, node->mValues + kWidth, copy->mValues);
+    return copy;
+}
+
+/**
+ * Builds a chain of single-child branches down to a node.
+ * @param level The level of the top of the chain.
+ * @param node The node to hang at the bottom of the chain.
+ * @param edit The transient identifier for the new branches.
+ * @modifies N/A
+ * @return The top of the chain.
+ */
+template<typename T>
+std::shared_ptr<typename PersistentArrayList<T>::Node>
+PersistentArrayList<T>::newPath(uint32_t level, const std::shared_ptr<Node> &node, uint64_t edit) {
+    if (level == 0)
+        return node;
+
+    std::shared_ptr<Branch> branch = std::make_shared<Branch>(edit);
+    branch->mChildren[0] = newPath(level - kBits, node, edit);
+    return branch;
+}
+
+/**
+ * Inserts a full tail into the trie as its new right-most leaf.
+ * @param tree The version being extended, before its size is incremented.
+ * @param level The level of 'parent'.
+ * @param parent The branch on the right-most path.
+ * @param tail The leaf to insert.
+ * @param edit The transient identifier, or zero for a persistent change.
+ * @modifies N/A
+ * @return The replacement for 'parent'.
+ */
+template<typename T>
+std::shared_ptr<typename PersistentArrayList<T>::Branch>
+PersistentArrayList<T>::pushTail(const Tree &tree, uint32_t level,
+        const std::shared_ptr<Branch> &parent, const std::shared_ptr<Leaf> &tail, uint64_t edit) {
+    uint32_t subIndex = ((tree.size - 1) >> level) & kMask;
+    std::shared_ptr<Branch> result = editable(parent, edit);
+
+    if (level == kBits) {
+        result->mChildren[subIndex] = tail;
+    } else if (result->mChildren[subIndex]) {
+        result->mChildren[subIndex] = pushTail(tree, level - kBits,
+            std::static_pointer_cast<Branch>(result->mChildren[subIndex]), tail, edit);
+    } else {
+        result->mChildren[subIndex] = newPath(level - kBits, tail, edit);
+    }
+    return result;
+}
+
+/**
+ * Removes the right-most leaf of the trie.
+ * @param tree The version being shrunk, before its size is decremented.
+ * @param level The level of 'node'.
+ * @param node The branch on the right-most path.
+ * @param edit The transient identifier, or zero for a persistent change.
+ * @modifies N/A
+ * @return The replacement for 'node', or nullptr if it has become empty.
+ */
+template<typename T>
+std::shared_ptr<typename PersistentArrayList<T>::Branch>
+PersistentArrayList<T>::popTail(const Tree &tree, uint32_t level,
+        const std::shared_ptr<Branch> &node, uint64_t edit) {
+    uint32_t subIndex = ((tree.size - 2) >> level) & kMask;
+
+    if (level > kBits) {
+        std::shared_ptr<Branch> child = popTail(tree, level - kBits,
+            std::static_pointer_cast<Branch>(node->mChildren[subIndex]), edit);
+        if (!child && subIndex == 0)
+            return nullptr;
+
+        std::shared_ptr<Branch> result = editable(node, edit);
+        result->mChildren[subIndex] = child;
+        return result;
+    }
+
+    if (subIndex == 0)
+        return nullptr;
+
+    std::shared_ptr<Branch> result = editable(node, edit);
+    result->mChildren[subIndex].reset();
+    return result;
+}
+
+/**
+ * Replaces the element at an index within the trie.
+ * @param level The level of 'node'.
+ * @param node The node on the path to 'index'.
+ * @param index The index of the element to replace.
+ * @param value The new value.
+ * @param edit The transient identifier, or zero for a persistent change.
+ * @modifies N/A
+ * @return The replacement for 'node'.
+ */
+template<typename T>
+std::shared_ptr<typename PersistentArrayList<T>::Node>
+PersistentArrayList<T>::assoc(uint32_t level, const std::shared_ptr<Node> &node, uint32_t index,
+        const T &value, uint64_t edit) {
+    if (level == 0) {
+        std::shared_ptr<Leaf> leaf = editable(std::static_pointer_cast<Leaf>(node), edit);
+        leaf->mValues[index & kMask] = value;
+        return leaf;
+    }
+
+    std::shared_ptr<Branch> branch = editable(std::static_pointer_cast<Branch>(node), edit);
+    uint32_t subIndex = (index >> level) & kMask;
+    branch->mChildren[subIndex] = assoc(level - kBits, branch->mChildren[subIndex], index, value,
+        edit);
+    return branch;
+}
+
+/**
+ * Appends an element to a version.
+ * @param tree The version to extend.
+ * @param value The value to be added.
+ * @param edit The transient identifier, or zero for a persistent change.
+ * @modifies Replaces the nodes of 'tree' along the right-most path.
+ * @return N/A
+ */
+template<typename T>
+void PersistentArrayList<T>::push(Tree &tree, const T &value, uint64_t edit) {
+    uint32_t inTail = tree.size - tailOffset(tree);
+
+    if (inTail < kWidth) {
+        std::shared_ptr<Leaf> tail = editable(tree.tail, edit);
+        tail->mValues[inTail] = value;
+        tree.tail = tail;
+        ++tree.size;
+        return;
+    }
+
+    // The tail is full: move it into the trie, growing a new root if the trie is full too.
+    std::shared_ptr<Branch> root;
+    uint32_t shift = tree.shift;
+    if ((tree.size >> kBits) > (1u << tree.shift)) {
+        root = std::make_shared<Branch>(edit);
+        root->mChildren[0] = tree.root;
+        root->mChildren[1] = newPath(tree.shift, tree.tail, edit);
+        shift += kBits;
+    } else {
+        root = pushTail(tree, tree.shift, tree.root, tree.tail, edit);
+    }
+
+    std::shared_ptr<Leaf> tail = std::make_shared<Leaf>(edit);
+    tail->mValues[0] = value;
+
+    tree.root = root;
+    tree.tail = tail;
+    tree.shift = shift;
+    ++tree.size;
+}
+
+/**
+ * Replaces an element of a version.
+ * @param tree The version to change.
+ * @param index The index of the element to replace.
+ * @param value The new value.
+ * @param edit The transient identifier, or zero for a persistent change.
+ * @modifies Replaces the nodes of 'tree' along the path to 'index'.
+ * @return N/A
+ */
+template<typename T>
+void PersistentArrayList<T>::assign(Tree &tree, uint32_t index, const T &value, uint64_t edit) {
+    if (index >= tailOffset(tree)) {
+        std::shared_ptr<Leaf> tail = editable(tree.tail, edit);
+        tail->mValues[index & kMask] = value;
+        tree.tail = tail;
+        return;
+    }
+
+    tree.root = std::static_pointer_cast<Branch>(assoc(tree.shift, tree.root, index, value, edit));
+}
+
+/**
+ * Removes the last element of a non-empty version.
+ * @param tree The version to shrink.
+ * @param edit The transient identifier, or zero for a persistent change.
+ * @modifies Replaces the nodes of 'tree' along the right-most path.
+ * @return N/A
+ */
+template<typename T>
+void PersistentArrayList<T>::pop(Tree &tree, uint64_t edit) {
+    if (tree.size == 1) {
+        tree = emptyTree();
+        return;
+    }
+
+    uint32_t inTail = tree.size - tailOffset(tree);
+    if (inTail > 1) {
+        // Reset the slot so that the removed element is not kept alive by the shared leaf.
+        std::shared_ptr<Leaf> tail = editable(tree.tail, edit);
+        tail->mValues[inTail - 1] = T();
+        tree.tail = tail;
+        --tree.size;
+        return;
+    }
+
+    // The tail becomes empty: the right-most leaf of the trie becomes the new tail.
+    std::shared_ptr<Node> node = tree.root;
+    for (uint32_t level = tree.shift; level > 0; level -= kBits)
+        node = static_cast<const Branch*>(node.get())->mChildren[((tree.size - 2) >> level) & kMask];
+    std::shared_ptr<Leaf> tail = editable(std::static_pointer_cast<Leaf>(node), edit);
+    std::shared_ptr<Branch> root = popTail(tree, tree.shift, tree.root, edit);
+    uint32_t shift = tree.shift;
+
+    if (!root)
+        root = std::make_shared<Branch>(edit);
+    if (shift > kBits && !root->mChildren[1]) {
+        root = std::static_pointer_cast<Branch>(root->mChildren[0]);
+        shift -= kBits;
+    }
+
+    tree.root = root;
+    tree.tail = tail;
+    tree.shift = shift;
+    --tree.size;
+}
+
+/**
+ * Constructor: Creates a transient over a copy of a version.
+ * @param tree The version to edit.
+ * @modifies Claims a fresh identifier for the nodes this transient creates.
+ * @return N/A
+ */
+template<typename T>
+PersistentArrayList<T>::Transient::Transient(const Tree &tree)
+    : mTree(tree),
+      mEdit(nextEdit()) {}
+
+/**
+ * Move Constructor: Takes over the edits of another transient.
+ * @param src The transient to be moved.
+ * @modifies Leaves 'src' frozen, so only this transient can edit its nodes.
+ * @return N/A
+ */
+template<typename T>
+PersistentArrayList<T>::Transient::Transient(Transient &&src) noexcept
+    : mTree(std::move(src.mTree)),
+      mEdit(src.mEdit) {
+    src.mEdit = 0;
+}
+
+/**
+ * Move Assignment Operator: Takes over the edits of another transient.
+ * @param src The transient to be moved.
+ * @modifies Leaves 'src' frozen, so only this transient can edit its nodes.
+ * @return A reference to this transient.
+ */
+template<typename T>
+typename PersistentArrayList<T>::Transient &PersistentArrayList<T>::Transient::operator=(
+        Transient &&src) noexcept {
+    if (this != &src) {
+        mTree = std::move(src.mTree);
+        mEdit = src.mEdit;
+        src.mEdit = 0;
+    }
+    return *this;
+}
+
+/**
+ * Appends an element in place.
+ * @param value The value to be added.
+ * @modifies Edits the nodes owned by this transient.
+ * @throws std::logic_error if the transient has already been frozen.
+ * @return A reference to this transient.
+ */
+template<typename T>
+typename PersistentArrayList<T>::Transient &PersistentArrayList<T>::Transient::add(const T &value) {
+    ensureEditable();
+    push(mTree, value, mEdit);
+    return *this;
+}
+
+/**
+ * Replaces an element in place.
+ * @param index The index of the element to set.
+ * @param value The new value to set.
+ * @modifies Edits the nodes owned by this transient.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return A reference to this transient.
+ */
+template<typename T>
+typename PersistentArrayList<T>::Transient &PersistentArrayList<T>::Transient::set(
+        const uint32_t &index, const T &value) {
+    ensureEditable();
+    if (index >= mTree.size)
+        throwOutOfRange(index);
+
+    assign(mTree, index, value, mEdit);
+    return *this;
+}
+
+/**
+ * Removes the last element in place.
+ * @param N/A
+ * @modifies Edits the nodes owned by this transient.
+ * @throws std::out_of_range if the list is empty.
+ * @return A reference to this transient.
+ */
+template<typename T>
+typename PersistentArrayList<T>::Transient &PersistentArrayList<T>::Transient::removeLast() {
+    ensureEditable();
+    if (mTree.size == 0)
+        throwOutOfRange("0");
+
+    pop(mTree, mEdit);
+    return *this;
+}
+
+/**
+ * Retrieves the element at a specific index.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return A constant reference to the element at the specified index.
+ */
+template<typename T>
+const T& PersistentArrayList<T>::Transient::get(const uint32_t &index) const {
+    ensureEditable();
+    if (index >= mTree.size)
+        throwOutOfRange(index);
+
+    return leafFor(mTree, index).mValues[index & kMask];
+}
+
+/**
+ * Returns the size of the list being edited.
+ * @param N/A
+ * @modifies N/A
+ * @return The size of the list being edited.
+ */
+template<typename T>
+uint32_t PersistentArrayList<T>::Transient::size() const {return mTree.size;}
+
+/**
+ * Freezes the edits made so far.
+ * @param N/A
+ * @modifies Retires the identifier of this transient so its nodes can no longer change.
+ * @throws std::logic_error if the transient has already been frozen.
+ * @return The edited version.
+ */
+template<typename T>
+PersistentArrayList<T> PersistentArrayList<T>::Transient::persistent() {
+    ensureEditable();
+    mEdit = 0;
+    return PersistentArrayList<T>(mTree);
+}
+
+/**
+ * Checks that the transient has not been frozen yet.
+ * @param N/A
+ * @modifies N/A
+ * @throws std::logic_error if persistent() has already been called.
+ * @return N/A
+ */
+template<typename T>
+void PersistentArrayList<T>::Transient::ensureEditable() const {
+    if (mEdit == 0)
+        throwLogicError("transient used after persistent()");
+}
@@ -0,0 +1,378 @@
+// Author: Mac-Noble Brako-Kusi
+// File: PoolResource.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for PoolResource class
+
+#include "PoolResource.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+
+namespace {
+// Size classes run from kSmallestBlock = 2^6 bytes up to 2^63 bytes.
+const uint32_t kSmallestShift = 6;
+const uint32_t kClasses = 64 - kSmallestShift;
+
+// Ids of resources, so that a thread cache never mistakes a new resource for a destroyed one.
+std::atomic<uint64_t> nextId(1);
+
+// A free block holds the link to the next free block of its class.
+struct Block {
+    Block* next;
+};
+
+// A singly linked list of free blocks of one class.
+struct FreeList {
+    Block* head = nullptr;
+    uint32_t count = 0;
+
+    void push(Block* block) {
+        block->next = head;
+        head = block;
+        ++count;
+    }
+
+    Block* pop() {
+        Block* block = head;
+        head = block->next;
+        --count;
+        return block;
+    }
+};
+
+uint32_t classIndex(size_t blockSize) {
+    return static_cast<uint32_t>(__builtin_ctzll(blockSize)) - kSmallestShift;
+}
+
+void freeBlocks(Block* head) {
+    while (head != nullptr) {
+        Block* next = head->next;
+        ::operator delete(head, std::align_val_t(PoolResource::kBlockAlignment));
+        head = next;
+    }
+}
+} // Namespace
+
+/**
+ * The shared pool: one free list per class behind a single lock, plus the upstream counter.
+ */
+struct PoolResource::Central {
+    explicit Central(const PoolOptions& options) : options(options) {}
+
+    /**
+     * Adds a chain of blocks of one class, keeping at most maxRetainedBytes.
+     * @param cls The class of the blocks.
+     * @param head The first block of the chain.
+     * @modifies Takes the blocks that fit under the cap and frees the others.
+     * @return N/A
+     */
+    void put(uint32_t cls, Block* head) {
+        size_t size = kSmallestBlock << cls;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            while (head != nullptr && !closed && retainedBytes + size <= options.maxRetainedBytes) {
+                Block* next = head->next;
+                lists[cls].push(head);
+                retainedBytes += size;
+                head = next;
+            }
+        }
+        freeBlocks(head);
+    }
+
+    /**
+     * Removes up to a number of blocks of one class.
+     * @param cls The class of the blocks.
+     * @param count The maximum number of blocks.
+     * @param into The list receiving the blocks.
+     * @modifies Moves the blocks from the pool into 'into'.
+     * @return The number of blocks moved.
+     */
+    uint32_t take(uint32_t cls, uint32_t count, FreeList& into) {
+        std::lock_guard<std::mutex> guard(lock);
+        uint32_t taken = 0;
+        for (; taken < count && lists[cls].head != nullptr; ++taken)
+            into.push(lists[cls].pop());
+        retainedBytes -= taken * (kSmallestBlock << cls);
+        return taken;
+    }
+
+    /**
+     * Frees every block, and with 'close' set refuses every block put afterwards.
+     * @param close Whether the owning resource is being destroyed.
+     * @modifies Empties the pool.
+     * @return N/A
+     */
+    void clear(bool close) {
+        FreeList drained[kClasses];
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            std::swap_ranges(lists, lists + kClasses, drained);
+            retainedBytes = 0;
+            closed = closed || close;
+        }
+        for (FreeList& list : drained)
+            freeBlocks(list.head);
+    }
+
+    const PoolOptions options;
+    std::mutex lock;
+    FreeList lists[kClasses];
+    size_t retainedBytes = 0;
+    bool closed = false;
+    std::atomic<uint64_t> upstreamAllocations{0};
+};
+
+/**
+ * One thread's cache of free blocks for one resource. The shared_ptr keeps the shared pool alive
+ * until the cache has been returned to it, even if the resource is gone by then.
+ */
+struct PoolResource::ThreadCache {
+    ThreadCache(uint64_t id, std::shared_ptr<Central> central) : id(id), central(std::move(central)) {}
+
+    ~ThreadCache() {
+        flush();
+    }
+
+    /**
+     * Returns every cached block to the shared pool.
+     * @param N/A
+     * @modifies Empties the cache.
+     * @return N/A
+     */
+    void flush() {
+        for (uint32_t cls = 0; cls < kClasses; ++cls) {
+            if (lists[cls].head != nullptr)
+                central->put(cls, lists[cls].head);
+            lists[cls] = FreeList();
+        }
+        cachedBytes = 0;
+    }
+
+    const uint64_t id;
+    const std::shared_ptr<Central> central;
+    FreeList lists[kClasses];
+    size_t cachedBytes = 0;
+};
+
+/**
+ * Constructor: Creates a PoolResource with the provided settings.
+ * @param options The size and cache limits.
+ * @modifies Creates an empty shared pool.
+ * @return N/A
+ */
+PoolResource::PoolResource(const PoolOptions &options)
+    : mOptions(options),
+      mId(nextId.fetch_add(1, std::memory_order_relaxed)),
+      mCentral(std::make_shared<Central>(options)) {}
+
+/**
+ * Destructor: Frees the shared pool and the calling thread's cache.
+ * @param N/A
+ * @modifies Closes the shared pool so that caches returned later are freed instead of kept.
+ * @return N/A
+ */
+PoolResource::~PoolResource() {
+    mCentral->clear(true);
+    std::vector<std::unique_ptr<ThreadCache>>& caches = threadCaches();
+    caches.erase(std::remove_if(caches.begin(), caches.end(),
+                                [this](const std::unique_ptr<ThreadCache>& cache) {
+                                    return cache->id == mId;
+                                }), caches.end());
+}
+
+/**
+ * Returns the settings of this resource.
+ * @param N/A
+ * @modifies N/A
+ * @return The options this resource was created with.
+ */
+const PoolOptions &PoolResource::options() const {return mOptions;}
+
+/**
+ * Returns the number of bytes held by the shared pool.
+ * @param N/A
+ * @modifies N/A
+ * @return The retained bytes.
+ */
+size_t PoolResource::retainedBytes() const {
+    std::lock_guard<std::mutex> guard(mCentral->lock);
+    return mCentral->retainedBytes;
+}
+
+/**
+ * Returns the number of blocks obtained from operator new.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of upstream allocations.
+ */
+uint64_t PoolResource::upstreamAllocations() const {
+    return mCentral->upstreamAllocations.load(std::memory_order_relaxed);
+}
+
+/**
+ * Returns the calling thread's cached blocks to the shared pool.
+ * @param N/A
+ * @modifies Empties the calling thread's cache for this resource.
+ * @return N/A
+ */
+void PoolResource::flushThreadCache() {threadCache().flush();}
+
+/**
+ * Frees every block in the shared pool.
+ * @param N/A
+ * @modifies Empties the shared pool.
+ * @return N/A
+ */
+void PoolResource::release() {mCentral->clear(false);}
+
+/**
+ * Returns the size class a request falls into.
+ * @param bytes The requested size.
+ * @modifies N/A
+ * @return The smallest power of two that is at least 'bytes' and kSmallestBlock.
+ */
+size_t PoolResource::blockSize(size_t bytes) {
+    if (bytes <= kSmallestBlock)
+        return kSmallestBlock;
+    return size_t(1) << (64 - __builtin_clzll(bytes - 1));
+}
+
+/**
+ * Allocates a block: from the thread cache, refilled with a batch from the shared pool when empty,
+ * and from operator new when both are empty.
+ * @param bytes The size of the buffer.
+ * @param alignment The required alignment.
+ * @modifies Takes a block from the calling thread's cache or the shared pool.
+ * @throws std::bad_alloc if operator new fails.
+ * @return A pointer to the block.
+ */
+void *PoolResource::do_allocate(size_t bytes, size_t alignment) {
+    if (!isPooled(bytes, alignment)) {
+        mCentral->upstreamAllocations.fetch_add(1, std::memory_order_relaxed);
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    size_t size = blockSize(bytes);
+    uint32_t cls = classIndex(size);
+    ThreadCache& cache = threadCache();
+    FreeList& list = cache.lists[cls];
+    if (list.head == nullptr) {
+        // Refill with as many blocks as fit in the cache, plus the one handed out right away.
+        size_t room = (mOptions.threadCacheBytes - std::min(cache.cachedBytes,
+                                                            mOptions.threadCacheBytes)) / size;
+        uint32_t batch = static_cast<uint32_t>(std::min<size_t>(mOptions.batchSize, room + 1));
+        cache.cachedBytes += mCentral->take(cls, std::max(batch, 1U), list) * size;
+    }
+
+    if (list.head != nullptr) {
+        cache.cachedBytes -= size;
+        return list.pop();
+    }
+    return allocateUpstream(size);
+}
+
+/**
+ * Frees a block into the calling thread's cache. If the cache is full, the block goes to the
+ * shared pool together with a batch of cached blocks of the same class.
+ * @param p The block.
+ * @param bytes The size it was allocated with.
+ * @param alignment The alignment it was allocated with.
+ * @modifies Adds the block to the calling thread's cache or the shared pool.
+ * @return N/A
+ */
+void PoolResource::do_deallocate(void *p, size_t bytes, size_t alignment) {
+    if (!isPooled(bytes, alignment)) {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        return;
+    }
+
+    size_t size = blockSize(bytes);
+    uint32_t cls = classIndex(size);
+    ThreadCache& cache = threadCache();
+    FreeList& list = cache.lists[cls];
+    Block* block = static_cast<Block*>(p);
+    if (cache.cachedBytes + size <= mOptions.threadCacheBytes) {
+        list.push(block);
+        cache.cachedBytes += size;
+        return;
+    }
+
+    FreeList batch;
+    batch.push(block);
+    while (batch.count < mOptions.batchSize && list.head != nullptr) {
+        batch.push(list.pop());
+        cache.cachedBytes -= size;
+    }
+    mCentral->put(cls, batch.head);
+}
+
+/**
+ * Checks whether memory from this resource can be freed by another.
+ * @param other The other resource.
+ * @modifies N/A
+ * @return 'true' only if 'other' is this resource.
+ */
+bool PoolResource::do_is_equal(const std::pmr::memory_resource &other) const noexcept {
+    return this == &other;
+}
+
+/**
+ * Returns the calling thread's caches, one per resource it has used. They are destroyed, and so
+ * returned to their shared pools, when the thread exits.
+ * @param N/A
+ * @modifies N/A
+ * @return The calling thread's caches.
+ */
+std::vector<std::unique_ptr<PoolResource::ThreadCache>> &PoolResource::threadCaches() {
+    thread_local std::vector<std::unique_ptr<ThreadCache>> caches;
+    return caches;
+}
+
+/**
+ * Decides whether a request is served from the size classes.
+ * @param bytes The size of the buffer.
+ * @param alignment The required alignment.
+ * @modifies N/A
+ * @return 'true' if the block fits the largest pooled class and the block alignment suffices.
+ */
+bool PoolResource::isPooled(size_t bytes, size_t alignment) const {
+    return alignment <= kBlockAlignment && bytes <= mOptions.largestPooledBlock &&
+           blockSize(bytes) <= mOptions.largestPooledBlock;
+}
+
+/**
+ * Finds the calling thread's cache for this resource, creating it on first use. Caches left
+ * behind by destroyed resources are dropped at that point.
+ * @param N/A
+ * @modifies May add a cache to the calling thread's caches.
+ * @return The calling thread's cache for this resource.
+ */
+PoolResource::ThreadCache &PoolResource::threadCache() {
+    std::vector<std::unique_ptr<ThreadCache>>& caches = threadCaches();
+    for (const std::unique_ptr<ThreadCache>& cache : caches) {
+        if (cache->id == mId)
+            return *cache;
+    }
+
+    caches.erase(std::remove_if(caches.begin(), caches.end(),
+                                [](const std::unique_ptr<ThreadCache>& cache) {
+                                    std::lock_guard<std::mutex> guard(cache->central->lock);
+                                    return cache->central->closed;
+                                }), caches.end());
+    caches.push_back(std::make_unique<ThreadCache>(mId, mCentral));
+    return *caches.back();
+}
+
+/**
+ * Allocates a new block from operator new.
+ * @param size The size of the block, a size class.
+ * @modifies Counts the upstream allocation.
+ * @throws std::bad_alloc if operator new fails.
+ * @return A pointer to the block.
+ */
+void *PoolResource::allocateUpstream(size_t size) {
+    mCentral->upstreamAllocations.fetch_add(1, std::memory_order_relaxed);
+    return ::operator new(size, std::align_val_t(kBlockAlignment));
+}
@@ -0,0 +1,136 @@
+// Author: Mac-Noble Brako-Kusi
+// File: RadixSort.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for the parallel LSD radix sort of ArrayLists
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace radix_sort {
+/**
+ * Maps an integer key to an unsigned integer of the same width with the same ordering, by
+ * flipping the sign bit of signed keys.
+ * @param key The key.
+ * @modifies N/A
+ * @return The unsigned key.
+ */
+template<typename Key> std::make_unsigned_t<Key> toUnsigned(Key key) {
+    static_assert(std::is_integral_v<Key> && !std::is_same_v<Key, bool>,
+                  "radixSort needs integer keys");
+    typedef std::make_unsigned_t<Key> Unsigned;
+    Unsigned bits = static_cast<Unsigned>(key);
+    if constexpr (std::is_signed_v<Key>)
+        bits ^= Unsigned(1) << (sizeof(Unsigned) * 8 - 1);
+    return bits;
+}
+} // Namespace
+
+/**
+ * Sorts a list of integers in ascending order.
+ * @param list The list to sort.
+ * @param threads The number of threads to use, or 0 for one per hardware thread.
+ * @modifies Reorders the elements of 'list'.
+ * @return N/A
+ */
+template<typename T>
+void radixSort(ArrayList<T> &list, uint32_t threads) {
+    radixSort(list, [](const T& value) {return value;}, threads);
+}
+
+/**
+ * Sorts a list by an integer key extracted from each element.
+ * @param list The list to sort.
+ * @param keyOf The function returning the key of an element.
+ * @param threads The number of threads to use, or 0 for one per hardware thread.
+ * @modifies Reorders the elements of 'list', keeping elements with equal keys in order.
+ * @return N/A
+ */
+template<typename T, typename KeyOf, typename>
+void radixSort(ArrayList<T> &list, KeyOf keyOf, uint32_t threads) {
+    auto key = [&keyOf](const T& value) {return radix_sort::toUnsigned(keyOf(value));};
+    typedef decltype(key(std::declval<const T&>())) Key;
+    const uint32_t kBuckets = 256;
+    const uint32_t kMinChunk = 1U << 14;
+
+    uint32_t size = list.size();
+    T* data = list.data();
+    CONTAINER_TRACE_SCOPE(radix_sort, size);
+    if (size < kRadixSortThreshold) {
+        std::stable_sort(data, data + size, [&key](const T& lhs, const T& rhs) {
+            return key(lhs) < key(rhs);
+        });
+        return;
+    }
+
+    threads = threadsFor(threads);
+    if (size < kRadixSortParallelThreshold)
+        threads = 1;
+    threads = std::min(threads, std::max(1U, size / kMinChunk));
+    uint32_t chunk = (size + threads - 1) / threads;
+    auto chunkBegin = [size, chunk](uint32_t t) {return std::min(size, t * chunk);};
+
+    // The threads are started once and run every pass, with a barrier between phases. One pass
+    // over the keys finds the bytes that differ between elements; the others need no pass.
+    ScopedArray<T> buffer(size, list.resource());
+    std::vector<Key> ors(threads, 0);
+    std::vector<Key> ands(threads, static_cast<Key>(~Key(0)));
+    std::vector<uint32_t> counts(threads * kBuckets);
+    T* sorted = data;
+    ThreadBarrier barrier(threads);
+    parallelFor(threads, [&](uint32_t t) {
+        Key anyBit = 0;
+        Key allBits = static_cast<Key>(~Key(0));
+        for (uint32_t i = chunkBegin(t); i < chunkBegin(t + 1); ++i) {
+            Key k = key(data[i]);
+            anyBit |= k;
+            allBits &= k;
+        }
+        ors[t] = anyBit;
+        ands[t] = allBits;
+        barrier.wait();
+
+        for (uint32_t other = 0; other < threads; ++other) {
+            anyBit |= ors[other];
+            allBits &= ands[other];
+        }
+        Key varying = anyBit ^ allBits;
+
+        T* from = data;
+        T* to = buffer.get();
+        uint32_t* count = counts.data() + t * kBuckets;
+        for (uint32_t shift = 0; shift < sizeof(Key) * 8; shift += 8) {
+            if (((varying >> shift) & 0xFF) == 0)
+                continue;
+
+            std::fill(count, count + kBuckets, 0);
+            for (uint32_t i = chunkBegin(t); i < chunkBegin(t + 1); ++i)
+                ++count[(key(from[i]) >> shift) & 0xFF];
+            barrier.wait();
+
+            // Bucket b of thread t starts after every smaller bucket and after bucket b of the
+            // threads before t, which keeps the scatter stable.
+            if (t == 0) {
+                uint32_t offset = 0;
+                for (uint32_t b = 0; b < kBuckets; ++b) {
+                    for (uint32_t other = 0; other < threads; ++other) {
+                        uint32_t bucket = counts[other * kBuckets + b];
+                        counts[other * kBuckets + b] = offset;
+                        offset += bucket;
+                    }
+                }
+            }
+            barrier.wait();
+
+            for (uint32_t i = chunkBegin(t); i < chunkBegin(t + 1); ++i)
+                to[count[(key(from[i]) >> shift) & 0xFF]++] = std::move(from[i]);
+            barrier.wait();
+            std::swap(from, to);
+        }
+        if (t == 0)
+            sorted = from;
+    });
+
+    if (sorted != data)
+        std::move(sorted, sorted + size, data);
+}
@@ -0,0 +1,230 @@
+// Author: Mac-Noble Brako-Kusi
+// File: RcuArrayList.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for RcuArrayList template class
+
+/**
+ * Constructor: Pins the current version of a list for the calling thread.
+ * @param current The list's current version pointer.
+ * @modifies Announces the thread's epoch, then loads the version it will read.
+ * @return N/A
+ */
+template<typename T>
+RcuArrayList<T>::Snapshot::Snapshot(const std::atomic<Version*> &current)
+    : mGuard() {
+    const Version* version = current.load(std::memory_order_acquire);
+    mData = version->list.data();
+    mSize = version->list.size();
+}
+
+/**
+ * Retrieves the element at a specific index of the snapshot.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return A constant reference to the element at the specified index.
+ */
+template<typename T>
+const T &RcuArrayList<T>::Snapshot::get(uint32_t index) const {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    return mData[index];
+}
+
+/**
+ * Constructor: Creates an empty RcuArrayList.
+ * @param N/A
+ * @modifies Publishes an empty first version.
+ * @return N/A
+ */
+template<typename T>
+RcuArrayList<T>::RcuArrayList()
+    : mCurrent(new Version(ArrayList<T>())),
+      mRetired(nullptr),
+      mRetiredCount(0) {}
+
+/**
+ * Destructor: Frees the current version and every retired one.
+ * @param N/A
+ * @modifies Deallocates every version.
+ * @return N/A
+ */
+template<typename T>
+RcuArrayList<T>::~RcuArrayList() {
+    delete mCurrent.load(std::memory_order_relaxed);
+    while (mRetired) {
+        Version* next = mRetired->nextRetired;
+        delete mRetired;
+        mRetired = next;
+    }
+}
+
+/**
+ * Takes a snapshot of the current version.
+ * @param N/A
+ * @modifies N/A
+ * @return The snapshot.
+ */
+template<typename T>
+typename RcuArrayList<T>::Snapshot RcuArrayList<T>::snapshot() const {return Snapshot(mCurrent);}
+
+/**
+ * Retrieves a copy of the element at a specific index of the current version.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return A copy of the element at the specified index.
+ */
+template<typename T>
+T RcuArrayList<T>::get(uint32_t index) const {return snapshot().get(index);}
+
+/**
+ * Returns the size of the current version.
+ * @param N/A
+ * @modifies N/A
+ * @return The current size.
+ */
+template<typename T>
+uint32_t RcuArrayList<T>::size() const {return snapshot().size();}
+
+/**
+ * Adds an element to the end of the list.
+ * @param value The value to be added.
+ * @modifies Publishes a new version ending with 'value'.
+ * @return N/A
+ */
+template<typename T>
+void RcuArrayList<T>::add(const T &value) {
+    update([&value](ArrayList<T>& list) {list.add(value);});
+}
+
+/**
+ * Inserts an element at a specific index.
+ * @param index The index at which to insert the element.
+ * @param value The value to be inserted.
+ * @modifies Publishes a new version with 'value' at 'index'.
+ * @return N/A
+ */
+template<typename T>
+void RcuArrayList<T>::add(uint32_t index, const T &value) {
+    update([index, &value](ArrayList<T>& list) {list.add(index, value);});
+}
+
+/**
+ * Sets the value of the element at a specific index.
+ * @param index The index of the element to set.
+ * @param value The new value to set.
+ * @modifies Publishes a new version with the element replaced.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return N/A
+ */
+template<typename T>
+void RcuArrayList<T>::set(uint32_t index, const T &value) {
+    update([index, &value](ArrayList<T>& list) {list.set(index, value);});
+}
+
+/**
+ * Removes and returns the element at a specific index.
+ * @param index The index of the element to remove.
+ * @modifies Publishes a new version without the element.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return The removed element.
+ */
+template<typename T>
+T RcuArrayList<T>::remove(uint32_t index) {
+    T removed = T();
+    update([index, &removed](ArrayList<T>& list) {removed = list.remove(index);});
+    return removed;
+}
+
+/**
+ * Clears the list.
+ * @param N/A
+ * @modifies Publishes an empty version.
+ * @return N/A
+ */
+template<typename T>
+void RcuArrayList<T>::clear() {
+    std::lock_guard<std::mutex> lock(mWriteMutex);
+    publish(ArrayList<T>());
+}
+
+/**
+ * Applies a batch of edits to a copy of the current version and publishes the result.
+ * @param edit The function editing the copy.
+ * @modifies Publishes a new version, unless 'edit' throws.
+ * @return N/A
+ */
+template<typename T>
+template<typename Edit>
+void RcuArrayList<T>::update(Edit edit) {
+    std::lock_guard<std::mutex> lock(mWriteMutex);
+    ArrayList<T> contents(mCurrent.load(std::memory_order_relaxed)->list);
+    edit(contents);
+    publish(std::move(contents));
+}
+
+/**
+ * Frees the retired versions no snapshot can still be reading.
+ * @param N/A
+ * @modifies Deallocates the reclaimable versions.
+ * @return N/A
+ */
+template<typename T>
+void RcuArrayList<T>::reclaim() {
+    std::lock_guard<std::mutex> lock(mWriteMutex);
+    reclaimLocked();
+}
+
+/**
+ * Returns the number of retired versions not yet freed.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of retired versions.
+ */
+template<typename T>
+uint32_t RcuArrayList<T>::retiredVersions() const {
+    std::lock_guard<std::mutex> lock(mWriteMutex);
+    return mRetiredCount;
+}
+
+/**
+ * Makes new contents the current version and retires the version it replaces. The caller holds
+ * the write mutex.
+ * @param contents The contents of the new version.
+ * @modifies Publishes the version, then frees what can be freed.
+ * @return N/A
+ */
+template<typename T>
+void RcuArrayList<T>::publish(ArrayList<T> &&contents) {
+    Version* replaced = mCurrent.exchange(new Version(std::move(contents)), std::memory_order_acq_rel);
+    replaced->retiredEpoch = EpochDomain::retireEpoch();
+    replaced->nextRetired = mRetired;
+    mRetired = replaced;
+    ++mRetiredCount;
+    reclaimLocked();
+}
+
+/**
+ * Frees the retired versions no snapshot can still be reading. The caller holds the write mutex.
+ * Versions are retired in epoch order, so once one is safe every older one is too.
+ * @param N/A
+ * @modifies Deallocates the reclaimable versions.
+ * @return N/A
+ */
+template<typename T>
+void RcuArrayList<T>::reclaimLocked() {
+    Version** link = &mRetired;
+    while (*link && !EpochDomain::isSafe((*link)->retiredEpoch))
+        link = &(*link)->nextRetired;
+
+    Version* reclaimable = *link;
+    *link = nullptr;
+    while (reclaimable) {
+        Version* next = reclaimable->nextRetired;
+        delete reclaimable;
+        --mRetiredCount;
+        reclaimable = next;
+    }
+}
@@ -11,7 +11,38 @@
  */
 template<typename T>
 ScopedArray<T>::ScopedArray(T *ptr)
-: mArray(ptr) {}
+: mArray(ptr), mCount(0), mResource(nullptr) {}
+
+/**
+ * Constructor: Allocates a buffer of default-initialized elements from a memory resource.
+ * @param count Number of elements to allocate.
+ * @param resource Memory resource to allocate from. If nullptr, the buffer comes from new[].
+ * @modifies Initializes the ScopedArray with the new buffer. Trivial element types are left
+ *           uninitialized, exactly as new T[count] leaves them, so no page is touched here.
+ * @throws std::bad_alloc or whatever the resource throws if the allocation fails; if an element
+ *         constructor throws, the buffer is returned to the resource first.
+ * @return N/A
+ */
+template<typename T>
+ScopedArray<T>::ScopedArray(size_t count, std::pmr::memory_resource *resource)
+: mArray(nullptr), mCount(0), mResource(nullptr) {
+    if (resource == nullptr) {
+        mArray = new T[count];
+        mCount = count;
+        return;
+    }
+
+    void* memory = resource->allocate(count * sizeof(T), alignof(T));
+    CONTAINER_TRY {
+        std::uninitialized_default_construct_n(static_cast<T*>(memory), count);
+    } CONTAINER_CATCH_ALL {
+        resource->deallocate(memory, count * sizeof(T), alignof(T));
+        CONTAINER_RETHROW;
+    }
+    mArray = static_cast<T*>(memory);
+    mCount = count;
+    mResource = resource;
+}
 
 /**
  * Destructor: Deallocates the dynamically allocated memory held by the ScopedArray.
@@ -21,7 +52,7 @@ ScopedArray<T>::ScopedArray(T *ptr)
  */
 template<typename T>
 ScopedArray<T>::~ScopedArray() {
-    delete[] mArray;
+    destroy();
 }
 
 /**
@@ -68,6 +99,28 @@ ScopedArray<T>::operator bool() const {
     return mArray != nullptr;
 }
 
+/**
+ * Returns the memory resource the held memory was allocated from.
+ * @param N/A
+ * @modifies N/A
+ * @return The memory resource, or nullptr if the memory came from new[].
+ */
+template<typename T>
+std::pmr::memory_resource* ScopedArray<T>::resource() const {
+    return mResource;
+}
+
+/**
+ * Returns the size of the held memory.
+ * @param N/A
+ * @modifies N/A
+ * @return The bytes held, or 0 if the memory was adopted from a raw pointer of unknown length.
+ */
+template<typename T>
+size_t ScopedArray<T>::memoryFootprint() const {
+    return mCount * sizeof(T);
+}
+
 /**
  * Releases ownership of the held memory and returns the pointer without deallocating it.
  * @param N/A
@@ -78,6 +131,8 @@ template<typename T>
 T* ScopedArray<T>::release() {
     T* temp = mArray;
     mArray = nullptr;
+    mCount = 0;
+    mResource = nullptr;
     return temp;
 }
 
@@ -90,8 +145,10 @@ T* ScopedArray<T>::release() {
 template<typename T>
 void ScopedArray<T>::reset(T *rhs) {
     if (rhs != mArray) {
-        delete[] mArray;
+        destroy();
         mArray = rhs;
+        mCount = 0;
+        mResource = nullptr;
     }
 }
 
@@ -104,4 +161,27 @@ void ScopedArray<T>::reset(T *rhs) {
 template<typename T>
 void ScopedArray<T>::swap(ScopedArray<T> &rhs) {
     std::swap(mArray, rhs.mArray);
+    std::swap(mCount, rhs.mCount);
+    std::swap(mResource, rhs.mResource);
+}
+
+/**
+ * Destroys the held elements and frees their memory, through the resource they came from if any.
+ * @param N/A
+ * @modifies Leaves 'mArray' dangling; callers either reassign it or are the destructor.
+ * @return N/A
+ */
+template<typename T>
+void ScopedArray<T>::destroy() {
+    if (mArray == nullptr)
+        return;
+
+    CONTAINER_TRACE_SCOPE(scopedarray_free, mCount);
+    if (mResource == nullptr) {
+        delete[] mArray;
+        return;
+    }
+
+    std::destroy_n(mArray, mCount);
+    mResource->deallocate(mArray, mCount * sizeof(T), alignof(T));
 }
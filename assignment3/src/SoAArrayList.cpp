@@ -0,0 +1,363 @@
+// Author: Mac-Noble Brako-Kusi
+// File: SoAArrayList.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for SoAArrayList template class
+
+/**
+ * Constructor: Creates an empty SoAArrayList.
+ * @param N/A
+ * @modifies Initializes every column as empty.
+ * @return N/A
+ */
+template<typename... Fields>
+SoAArrayList<Fields...>::SoAArrayList()
+    : mColumns(),
+      mSize(0),
+      mCapacity(0) {}
+
+/**
+ * Copy Constructor: Creates a deep copy of an existing SoAArrayList.
+ * @param src The SoAArrayList to be copied.
+ * @modifies Allocates every column with the capacity of 'src' and copies its rows.
+ * @return N/A
+ */
+template<typename... Fields>
+SoAArrayList<Fields...>::SoAArrayList(const SoAArrayList<Fields...> &src)
+    : mColumns(),
+      mSize(src.mSize),
+      mCapacity(src.mCapacity) {
+    allocate(mColumns, mCapacity);
+    std::apply([&](ScopedArray<Fields>&... dst) {
+        std::apply([&](const ScopedArray<Fields>&... from) {
+            (std::copy(from.get(), from.get() + mSize, dst.get()), ...);
+        }, src.mColumns);
+    }, mColumns);
+}
+
+/**
+ * Move Constructor: Creates an SoAArrayList by taking over the columns of another.
+ * @param src The SoAArrayList to be moved.
+ * @modifies Leaves 'src' empty.
+ * @return N/A
+ */
+template<typename... Fields>
+SoAArrayList<Fields...>::SoAArrayList(SoAArrayList<Fields...> &&src) noexcept
+    : SoAArrayList() {
+    swap(src);
+}
+
+/**
+ * Copy Assignment Operator: Makes this list a deep copy of another.
+ * @param src The SoAArrayList to be copied.
+ * @modifies Replaces the contents of this list.
+ * @return A reference to this SoAArrayList.
+ */
+template<typename... Fields>
+SoAArrayList<Fields...> &SoAArrayList<Fields...>::operator=(const SoAArrayList<Fields...> &src) {
+    if (this != &src) {
+        SoAArrayList<Fields...>(src).swap(*this);
+    }
+    return *this;
+}
+
+/**
+ * Move Assignment Operator: Takes over the columns of another SoAArrayList.
+ * @param src The SoAArrayList to be moved.
+ * @modifies Replaces the contents of this list and leaves 'src' empty.
+ * @return A reference to this SoAArrayList.
+ */
+template<typename... Fields>
+SoAArrayList<Fields...> &SoAArrayList<Fields...>::operator=(SoAArrayList<Fields...> &&src) noexcept {
+    if (this != &src) {
+        this->swap(src);
+        src.clear();
+    }
+    return *this;
+}
+
+/**
+ * Adds a row to the end of the list.
+ * @param values The value of each field.
+ * @modifies Appends one element to every column.
+ * @return A reference to the capacity of the list.
+ */
+template<typename... Fields>
+const uint32_t &SoAArrayList<Fields...>::add(const Fields &... values) {
+    return add(mSize, values...);
+}
+
+/**
+ * Inserts a row at a specific index.
+ * @param index The index at which to insert the row.
+ * @param values The value of each field.
+ * @modifies Inserts one element into every column, shifting the following rows up.
+ * @throws std::length_error if the list would exceed UINT32_MAX rows.
+ * @return A reference to the capacity of the list.
+ */
+template<typename... Fields>
+const uint32_t &SoAArrayList<Fields...>::add(const uint32_t &index, const Fields &... values) {
+    if (index == mSize && mSize < mCapacity) {
+        // Copy into temporaries first so that a throwing copy leaves no half-written row.
+        Value row(values...);
+        std::apply([&](ScopedArray<Fields>&... columns) {
+            std::apply([&](Fields&... fields) {
+                ((columns[mSize] = std::move(fields)), ...);
+            }, row);
+        }, mColumns);
+        ++mSize;
+        return mCapacity;
+    }
+
+    uint64_t newSize = uint64_t(std::max(index, mSize)) + 1;
+    if (newSize > UINT32_MAX)
+        throwLengthError("SoAArrayList cannot exceed UINT32_MAX rows");
+
+    uint64_t newCapacity = std::max<uint64_t>(mCapacity, 1);
+    while (newCapacity < newSize)
+        newCapacity *= 2;
+    newCapacity = std::min<uint64_t>(newCapacity, UINT32_MAX);
+
+    uint32_t prefix = std::min(index, mSize);
+    Columns columns;
+    allocate(columns, newCapacity);
+    std::apply([&](ScopedArray<Fields>&... dst) {
+        std::apply([&](const ScopedArray<Fields>&... src) {
+            (std::copy(src.get(), src.get() + prefix, dst.get()), ...);
+            (std::fill(dst.get() + prefix, dst.get() + index, Fields()), ...);
+            ((dst[index] = values), ...);
+            if (index < mSize)
+                (std::copy(src.get() + index, src.get() + mSize, dst.get() + index + 1), ...);
+        }, mColumns);
+    }, columns);
+
+    swapColumns(mColumns, columns);
+    mSize = static_cast<uint32_t>(newSize);
+    mCapacity = static_cast<uint32_t>(newCapacity);
+    return mCapacity;
+}
+
+/**
+ * Retrieves a proxy to the row at a specific index.
+ * @param index The index of the row.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return References to the fields of the row.
+ */
+template<typename... Fields>
+typename SoAArrayList<Fields...>::Row SoAArrayList<Fields...>::get(const uint32_t &index) {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    return (*this)[index];
+}
+
+/**
+ * Retrieves a read-only proxy to the row at a specific index.
+ * @param index The index of the row.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return Constant references to the fields of the row.
+ */
+template<typename... Fields>
+typename SoAArrayList<Fields...>::ConstRow SoAArrayList<Fields...>::get(
+        const uint32_t &index) const {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    return (*this)[index];
+}
+
+/**
+ * Accesses a proxy to the row at a specific index without range checking.
+ * @param index The index of the row.
+ * @modifies N/A
+ * @return References to the fields of the row.
+ */
+template<typename... Fields>
+typename SoAArrayList<Fields...>::Row SoAArrayList<Fields...>::operator[](const uint32_t &index) {
+    return std::apply([index](ScopedArray<Fields>&... columns) {
+        return Row(columns[index]...);
+    }, mColumns);
+}
+
+/**
+ * Accesses a read-only proxy to the row at a specific index without range checking.
+ * @param index The index of the row.
+ * @modifies N/A
+ * @return Constant references to the fields of the row.
+ */
+template<typename... Fields>
+typename SoAArrayList<Fields...>::ConstRow SoAArrayList<Fields...>::operator[](
+        const uint32_t &index) const {
+    return std::apply([index](const ScopedArray<Fields>&... columns) {
+        return ConstRow(columns[index]...);
+    }, mColumns);
+}
+
+/**
+ * Replaces the row at a specific index.
+ * @param index The index of the row.
+ * @param values The new value of each field.
+ * @modifies Overwrites one element of every column.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return N/A
+ */
+template<typename... Fields>
+void SoAArrayList<Fields...>::set(const uint32_t &index, const Fields &... values) {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    Value row(values...);
+    std::apply([&](ScopedArray<Fields>&... columns) {
+        std::apply([&](Fields&... fields) {
+            ((columns[index] = std::move(fields)), ...);
+        }, row);
+    }, mColumns);
+}
+
+/**
+ * Removes and returns the row at a specific index.
+ * @param index The index of the row.
+ * @modifies Shifts the following rows down in every column. If every field can be moved without
+ *           throwing, this happens in place; otherwise the columns are rebuilt and swapped in.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return The removed row.
+ */
+template<typename... Fields>
+typename SoAArrayList<Fields...>::Value SoAArrayList<Fields...>::remove(const uint32_t &index) {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    Value removed = (*this)[index];
+    if constexpr (std::conjunction_v<std::is_nothrow_move_assignable<Fields>...>) {
+        std::apply([&](ScopedArray<Fields>&... columns) {
+            (std::move(columns.get() + index + 1, columns.get() + mSize, columns.get() + index), ...);
+            ((columns[mSize - 1] = Fields()), ...);
+        }, mColumns);
+    } else {
+        Columns columns;
+        allocate(columns, mCapacity);
+        std::apply([&](ScopedArray<Fields>&... dst) {
+            std::apply([&](const ScopedArray<Fields>&... src) {
+                (std::copy(src.get(), src.get() + index, dst.get()), ...);
+                (std::copy(src.get() + index + 1, src.get() + mSize, dst.get() + index), ...);
+            }, mColumns);
+        }, columns);
+        swapColumns(mColumns, columns);
+    }
+
+    --mSize;
+    return removed;
+}
+
+/**
+ * Returns a view of the column of one field.
+ * @param N/A
+ * @modifies N/A
+ * @return The first size() elements of the column.
+ */
+template<typename... Fields>
+template<size_t I>
+ColumnSpan<std::tuple_element_t<I, std::tuple<Fields...>>> SoAArrayList<Fields...>::column() {
+    return ColumnSpan<std::tuple_element_t<I, std::tuple<Fields...>>>(
+        std::get<I>(mColumns).get(), mSize);
+}
+
+/**
+ * Returns a read-only view of the column of one field.
+ * @param N/A
+ * @modifies N/A
+ * @return The first size() elements of the column.
+ */
+template<typename... Fields>
+template<size_t I>
+ColumnSpan<const std::tuple_element_t<I, std::tuple<Fields...>>>
+SoAArrayList<Fields...>::column() const {
+    return ColumnSpan<const std::tuple_element_t<I, std::tuple<Fields...>>>(
+        std::get<I>(mColumns).get(), mSize);
+}
+
+/**
+ * Clears the list, releasing every column.
+ * @param N/A
+ * @modifies Deallocates the columns and resets the size and capacity.
+ * @return N/A
+ */
+template<typename... Fields>
+void SoAArrayList<Fields...>::clear() {
+    std::apply([](ScopedArray<Fields>&... columns) {
+        (columns.reset(), ...);
+    }, mColumns);
+    mSize = mCapacity = 0;
+}
+
+/**
+ * Checks if the list is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the list is empty, 'false' otherwise.
+ */
+template<typename... Fields>
+bool SoAArrayList<Fields...>::isEmpty() const {return mSize == 0;}
+
+/**
+ * Returns the number of rows.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of rows.
+ */
+template<typename... Fields>
+uint32_t SoAArrayList<Fields...>::size() const {return mSize;}
+
+/**
+ * Returns the number of rows that fit without reallocating.
+ * @param N/A
+ * @modifies N/A
+ * @return The capacity of every column.
+ */
+template<typename... Fields>
+uint32_t SoAArrayList<Fields...>::capacity() const {return mCapacity;}
+
+/**
+ * Swaps the contents of two SoAArrayList objects.
+ * @param src The SoAArrayList to swap content with.
+ * @modifies Exchanges the columns, size, and capacity between this and 'src'.
+ * @return N/A
+ */
+template<typename... Fields>
+void SoAArrayList<Fields...>::swap(SoAArrayList<Fields...> &src) noexcept {
+    std::swap(mSize, src.mSize);
+    std::swap(mCapacity, src.mCapacity);
+    swapColumns(mColumns, src.mColumns);
+}
+
+/**
+ * Allocates every column of a set of empty columns. Each buffer is owned as soon as it is
+ * allocated, so a failure part way through leaks nothing.
+ * @param columns The columns to allocate.
+ * @param capacity The number of elements of each column.
+ * @modifies Gives every column a new buffer.
+ * @return N/A
+ */
+template<typename... Fields>
+void SoAArrayList<Fields...>::allocate(Columns &columns, uint32_t capacity) {
+    std::apply([capacity](ScopedArray<Fields>&... buffers) {
+        (buffers.reset(new Fields[capacity]), ...);
+    }, columns);
+}
+
+/**
+ * Swaps two sets of columns buffer by buffer.
+ * @param lhs The first set of columns.
+ * @param rhs The second set of columns.
+ * @modifies Exchanges the buffers of 'lhs' and 'rhs'.
+ * @return N/A
+ */
+template<typename... Fields>
+void SoAArrayList<Fields...>::swapColumns(Columns &lhs, Columns &rhs) noexcept {
+    std::apply([&rhs](ScopedArray<Fields>&... left) {
+        std::apply([&](ScopedArray<Fields>&... right) {
+            (left.swap(right), ...);
+        }, rhs);
+    }, lhs);
+}
@@ -0,0 +1,504 @@
+// Author: Mac-Noble Brako-Kusi
+// File: SparseArrayList.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for SparseArrayList template class
+
+/**
+ * Constructor: Creates an empty SparseArrayList.
+ * @param N/A
+ * @modifies Starts with an empty page table.
+ * @return N/A
+ */
+template<typename T>
+SparseArrayList<T>::SparseArrayList()
+    : mDirectories(),
+      mSize(0),
+      mPopulated(0),
+      mPages(0) {}
+
+/**
+ * Constructor: Creates a SparseArrayList from a dense ArrayList.
+ * @param dense The elements, in order.
+ * @modifies Populates every index of 'dense'.
+ * @return N/A
+ */
+template<typename T>
+SparseArrayList<T>::SparseArrayList(const ArrayList<T> &dense)
+    : SparseArrayList() {
+    for (uint32_t i = 0; i < dense.size(); ++i)
+        write(i, dense[i]);
+    mSize = dense.size();
+}
+
+/**
+ * Copy Constructor: Creates a deep copy of another SparseArrayList.
+ * @param src The list to copy.
+ * @modifies Copies every allocated page.
+ * @return N/A
+ */
+template<typename T>
+SparseArrayList<T>::SparseArrayList(const SparseArrayList<T> &src)
+    : mDirectories(src.mDirectories.size()),
+      mSize(src.mSize),
+      mPopulated(src.mPopulated),
+      mPages(src.mPages) {
+    for (size_t d = 0; d < src.mDirectories.size(); ++d) {
+        const Directory* directory = src.mDirectories[d].get();
+        if (!directory)
+            continue;
+        mDirectories[d] = std::make_unique<Directory>();
+        mDirectories[d]->count = directory->count;
+        for (uint32_t p = 0; p < kDirectorySize; ++p) {
+            if (directory->pages[p])
+                mDirectories[d]->pages[p] = std::make_unique<Page>(*directory->pages[p]);
+        }
+    }
+}
+
+/**
+ * Move Constructor: Takes the pages of another SparseArrayList.
+ * @param src The list to move from.
+ * @modifies Leaves 'src' empty.
+ * @return N/A
+ */
+template<typename T>
+SparseArrayList<T>::SparseArrayList(SparseArrayList<T> &&src) noexcept
+    : mDirectories(std::move(src.mDirectories)),
+      mSize(std::exchange(src.mSize, 0)),
+      mPopulated(std::exchange(src.mPopulated, 0)),
+      mPages(std::exchange(src.mPages, 0)) {
+    src.mDirectories.clear();
+}
+
+/**
+ * Copy Assignment Operator: Replaces the contents with a deep copy of another SparseArrayList.
+ * @param src The list to copy.
+ * @modifies Replaces every page; unchanged if the copy throws.
+ * @return A reference to this list.
+ */
+template<typename T>
+SparseArrayList<T> &SparseArrayList<T>::operator=(const SparseArrayList<T> &src) {
+    if (this != &src)
+        *this = SparseArrayList<T>(src);
+    return *this;
+}
+
+/**
+ * Move Assignment Operator: Takes the pages of another SparseArrayList.
+ * @param src The list to move from.
+ * @modifies Frees this list's pages and leaves 'src' empty.
+ * @return A reference to this list.
+ */
+template<typename T>
+SparseArrayList<T> &SparseArrayList<T>::operator=(SparseArrayList<T> &&src) noexcept {
+    if (this != &src) {
+        mDirectories = std::move(src.mDirectories);
+        src.mDirectories.clear();
+        mSize = std::exchange(src.mSize, 0);
+        mPopulated = std::exchange(src.mPopulated, 0);
+        mPages = std::exchange(src.mPages, 0);
+    }
+    return *this;
+}
+
+/**
+ * Adds an element to the end of the list.
+ * @param value The value to be added.
+ * @modifies Populates index size(), allocating its page if needed.
+ * @throws std::length_error if the list is full.
+ * @return N/A
+ */
+template<typename T>
+void SparseArrayList<T>::add(const T &value) {add(mSize, value);}
+
+/**
+ * Inserts an element at a specific index.
+ * @param index The index at which to insert the element.
+ * @param value The value to be inserted.
+ * @modifies Moves each populated index from 'index' on up by one, highest first, or extends the
+ *           list to 'index'. 'value' is copied first, since it may be an element of this list.
+ * @throws std::length_error if the list would exceed UINT32_MAX elements.
+ * @return N/A
+ */
+template<typename T>
+void SparseArrayList<T>::add(uint32_t index, const T &value) {
+    if (index == UINT32_MAX || mSize == UINT32_MAX)
+        throwLengthError("SparseArrayList is full");
+
+    if (index >= mSize) {
+        write(index, value);
+        mSize = index + 1;
+        return;
+    }
+
+    T copy(value);
+    std::vector<uint32_t> moving = populatedFrom(index);
+    for (size_t i = moving.size(); i-- > 0;) {
+        T moved((*this)[moving[i]]);
+        unpopulate(moving[i]);
+        write(moving[i] + 1, moved);
+    }
+    write(index, copy);
+    ++mSize;
+}
+
+/**
+ * Retrieves the element at a specific index.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return A constant reference to the element, or to T() if the index is not populated.
+ */
+template<typename T>
+const T &SparseArrayList<T>::get(uint32_t index) const {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    return (*this)[index];
+}
+
+/**
+ * Retrieves the element at a specific index without range checking.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @return A constant reference to the element, or to T() if the index is not populated.
+ */
+template<typename T>
+const T &SparseArrayList<T>::operator[](uint32_t index) const {
+    const Page* page = findPage(index);
+    uint32_t slot = index % kPageSize;
+    if (!page || ((page->present[slot / 64] >> (slot % 64)) & 1) == 0)
+        return defaultValue();
+
+    return page->values[rankOf(*page, slot)];
+}
+
+/**
+ * Sets the value of the element at a specific index.
+ * @param index The index of the element to set.
+ * @param value The new value to set.
+ * @modifies Populates 'index', allocating its page if needed.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return N/A
+ */
+template<typename T>
+void SparseArrayList<T>::set(uint32_t index, const T &value) {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    write(index, value);
+}
+
+/**
+ * Removes and returns the element at a specific index.
+ * @param index The index of the element to remove.
+ * @modifies Moves each populated index after 'index' down by one, lowest first.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return The removed element.
+ */
+template<typename T>
+T SparseArrayList<T>::remove(uint32_t index) {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    T removed((*this)[index]);
+    std::vector<uint32_t> moving = populatedFrom(index + 1);
+    unpopulate(index);
+    for (uint32_t from : moving) {
+        T moved((*this)[from]);
+        unpopulate(from);
+        write(from - 1, moved);
+    }
+    --mSize;
+    return removed;
+}
+
+/**
+ * Unpopulates an index.
+ * @param index The index to reset.
+ * @modifies Returns the element to T(), freeing its page if no index of it remains populated.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return N/A
+ */
+template<typename T>
+void SparseArrayList<T>::reset(uint32_t index) {
+    if (index >= mSize)
+        throwOutOfRange(index);
+
+    unpopulate(index);
+}
+
+/**
+ * Checks whether an index is populated.
+ * @param index The index to check.
+ * @modifies N/A
+ * @return 'true' if the index was written and not reset since, 'false' otherwise.
+ */
+template<typename T>
+bool SparseArrayList<T>::contains(uint32_t index) const {
+    const Page* page = findPage(index);
+    uint32_t slot = index % kPageSize;
+    return page && ((page->present[slot / 64] >> (slot % 64)) & 1);
+}
+
+/**
+ * Converts the list to a dense ArrayList.
+ * @param N/A
+ * @modifies N/A
+ * @return The elements, with T() at every unpopulated index.
+ */
+template<typename T>
+ArrayList<T> SparseArrayList<T>::toArrayList() const {
+    ArrayList<T> dense(mSize);
+    auto copy = [&dense](uint32_t index, const T& value) {dense[index] = value;};
+    forEachFrom(0, copy);
+    return dense;
+}
+
+/**
+ * Returns the number of elements.
+ * @param N/A
+ * @modifies N/A
+ * @return The size of the list.
+ */
+template<typename T>
+uint32_t SparseArrayList<T>::size() const {return mSize;}
+
+/**
+ * Checks if the list is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the list is empty, 'false' otherwise.
+ */
+template<typename T>
+bool SparseArrayList<T>::isEmpty() const {return mSize == 0;}
+
+/**
+ * Returns the number of populated indexes.
+ * @param N/A
+ * @modifies N/A
+ * @return The populated count.
+ */
+template<typename T>
+uint32_t SparseArrayList<T>::populated() const {return mPopulated;}
+
+/**
+ * Returns the fraction of indexes populated.
+ * @param N/A
+ * @modifies N/A
+ * @return The density, between 0 and 1.
+ */
+template<typename T>
+double SparseArrayList<T>::density() const {return mSize == 0 ? 0.0 : double(mPopulated) / mSize;}
+
+/**
+ * Clears the list.
+ * @param N/A
+ * @modifies Frees every page and the page table.
+ * @return N/A
+ */
+template<typename T>
+void SparseArrayList<T>::clear() {
+    std::vector<std::unique_ptr<Directory>>().swap(mDirectories);
+    mSize = 0;
+    mPopulated = 0;
+    mPages = 0;
+}
+
+/**
+ * Returns the bytes allocated by the list.
+ * @param N/A
+ * @modifies N/A
+ * @return The memory footprint in bytes.
+ */
+template<typename T>
+size_t SparseArrayList<T>::memoryFootprint() const {
+    size_t directories = 0;
+    for (const std::unique_ptr<Directory>& directory : mDirectories)
+        directories += directory ? 1 : 0;
+    size_t bytes = mDirectories.capacity() * sizeof(std::unique_ptr<Directory>) +
+                   directories * sizeof(Directory) + size_t(mPages) * sizeof(Page);
+    for (const std::unique_ptr<Directory>& directory : mDirectories) {
+        for (uint32_t p = 0; directory && p < kDirectorySize; ++p) {
+            if (directory->pages[p])
+                bytes += directory->pages[p]->values.memoryFootprint();
+        }
+    }
+    return bytes;
+}
+
+/**
+ * Finds the page holding an index.
+ * @param index The index.
+ * @modifies N/A
+ * @return The page, or nullptr if it is not allocated.
+ */
+template<typename T>
+const typename SparseArrayList<T>::Page *SparseArrayList<T>::findPage(uint32_t index) const {
+    uint32_t top = index >> (kPageBits + kDirectoryBits);
+    if (top >= mDirectories.size() || !mDirectories[top])
+        return nullptr;
+
+    return mDirectories[top]->pages[(index >> kPageBits) % kDirectorySize].get();
+}
+
+/**
+ * Counts the populated slots of a page before a slot.
+ * @param page The page.
+ * @param slot The slot.
+ * @modifies N/A
+ * @return The index of the slot's element in the page's values, if the slot is populated.
+ */
+template<typename T>
+uint32_t SparseArrayList<T>::rankOf(const Page &page, uint32_t slot) {
+    uint64_t below = page.present[slot / 64] & ((uint64_t(1) << (slot % 64)) - 1);
+    return page.rank[slot / 64] + static_cast<uint32_t>(__builtin_popcountll(below));
+}
+
+/**
+ * Finds the page holding an index, allocating it and its directory if needed.
+ * @param index The index.
+ * @modifies May grow the page table and allocate an empty page.
+ * @return The page.
+ */
+template<typename T>
+typename SparseArrayList<T>::Page &SparseArrayList<T>::pageFor(uint32_t index) {
+    uint32_t top = index >> (kPageBits + kDirectoryBits);
+    if (top >= mDirectories.size())
+        mDirectories.resize(top + 1);
+    if (!mDirectories[top])
+        mDirectories[top] = std::make_unique<Directory>();
+
+    Directory& directory = *mDirectories[top];
+    std::unique_ptr<Page>& page = directory.pages[(index >> kPageBits) % kDirectorySize];
+    if (!page) {
+        page = std::make_unique<Page>();
+        ++directory.count;
+        ++mPages;
+    }
+    return *page;
+}
+
+/**
+ * Writes an element and marks its index populated. The size is the caller's to update.
+ * @param index The index to write.
+ * @param value The value to write.
+ * @modifies Populates 'index', allocating its page if needed.
+ * @return N/A
+ */
+template<typename T>
+void SparseArrayList<T>::write(uint32_t index, const T &value) {
+    Page& page = pageFor(index);
+    uint32_t slot = index % kPageSize;
+    uint32_t rank = rankOf(page, slot);
+    uint64_t bit = uint64_t(1) << (slot % 64);
+    if (page.present[slot / 64] & bit) {
+        page.values[rank] = value;
+        return;
+    }
+
+    page.values.add(rank, value);
+    page.present[slot / 64] |= bit;
+    for (uint32_t w = slot / 64 + 1; w < kWordsPerPage; ++w)
+        ++page.rank[w];
+    ++mPopulated;
+}
+
+/**
+ * Marks an index unpopulated, dropping its element.
+ * @param index The index.
+ * @modifies Frees the page once it has no populated index, and its directory once it has no page.
+ * @return N/A
+ */
+template<typename T>
+void SparseArrayList<T>::unpopulate(uint32_t index) {
+    if (!contains(index))
+        return;
+
+    uint32_t top = index >> (kPageBits + kDirectoryBits);
+    Directory& directory = *mDirectories[top];
+    std::unique_ptr<Page>& page = directory.pages[(index >> kPageBits) % kDirectorySize];
+    uint32_t slot = index % kPageSize;
+    --mPopulated;
+    if (page->values.size() > 1) {
+        page->values.remove(rankOf(*page, slot));
+        page->present[slot / 64] &= ~(uint64_t(1) << (slot % 64));
+        for (uint32_t w = slot / 64 + 1; w < kWordsPerPage; ++w)
+            --page->rank[w];
+        return;
+    }
+
+    page.reset();
+    --mPages;
+    if (--directory.count == 0)
+        mDirectories[top].reset();
+}
+
+/**
+ * Lists the populated indexes from an index on.
+ * @param first The first index to consider.
+ * @modifies N/A
+ * @return The populated indexes, in ascending order.
+ */
+template<typename T>
+std::vector<uint32_t> SparseArrayList<T>::populatedFrom(uint32_t first) const {
+    std::vector<uint32_t> indexes;
+    auto collect = [&indexes](uint32_t index, const T&) {indexes.push_back(index);};
+    forEachFrom(first, collect);
+    return indexes;
+}
+
+/**
+ * Visits the populated indexes from an index on, skipping unallocated directories and pages whole
+ * and finding populated slots a bitmap word at a time.
+ * @param first The first index to visit.
+ * @param visit The function called with each populated index and its element.
+ * @modifies Whatever 'visit' does.
+ * @return N/A
+ */
+template<typename T>
+template<typename Visit>
+void SparseArrayList<T>::forEachFrom(uint32_t first, Visit &visit) const {
+    const uint32_t kDirectorySpan = kPageSize * kDirectorySize;
+    for (size_t top = first / kDirectorySpan; top < mDirectories.size(); ++top) {
+        const Directory* directory = mDirectories[top].get();
+        if (!directory)
+            continue;
+        uint32_t directoryBase = static_cast<uint32_t>(top) * kDirectorySpan;
+        uint32_t firstPage = first > directoryBase ? (first - directoryBase) / kPageSize : 0;
+        for (uint32_t p = firstPage; p < kDirectorySize; ++p) {
+            const Page* page = directory->pages[p].get();
+            if (!page)
+                continue;
+            uint32_t pageBase = directoryBase + p * kPageSize;
+            for (uint32_t w = 0; w < kWordsPerPage; ++w) {
+                uint64_t bits = page->present[w];
+                uint32_t wordBase = pageBase + w * 64;
+                // Bits below 'first' in the word that holds it are skipped
+                if (wordBase + 63 < first)
+                    continue;
+                if (wordBase < first)
+                    bits &= ~uint64_t(0) << (first - wordBase);
+                uint64_t skipped = page->present[w] & ~bits;
+                uint32_t rank = page->rank[w] + static_cast<uint32_t>(__builtin_popcountll(skipped));
+                while (bits != 0) {
+                    uint32_t bit = static_cast<uint32_t>(__builtin_ctzll(bits));
+                    bits &= bits - 1;
+                    visit(wordBase + bit, page->values[rank++]);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Returns the element unpopulated indexes read as.
+ * @param N/A
+ * @modifies N/A
+ * @return A reference to a shared T().
+ */
+template<typename T>
+const T &SparseArrayList<T>::defaultValue() {
+    static const T kDefault = T();
+    return kDefault;
+}
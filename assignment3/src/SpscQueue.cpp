@@ -0,0 +1,175 @@
+// Author: Mac-Noble Brako-Kusi
+// File: SpscQueue.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for SpscQueue template class
+
+#include <algorithm>
+#include <utility>
+
+/**
+ * Constructor: Creates an empty SpscQueue.
+ * @param capacity The least number of elements the queue can hold.
+ * @modifies Allocates the ring.
+ * @throws std::invalid_argument if the capacity is 0 or greater than 2^31.
+ * @return N/A
+ */
+template<typename T>
+SpscQueue<T>::SpscQueue(uint32_t capacity)
+    : mSlots(roundCapacity(capacity), nullptr),
+      mMask(roundCapacity(capacity) - 1),
+      mTail(0),
+      mCachedHead(0),
+      mHead(0),
+      mCachedTail(0) {}
+
+/**
+ * Appends an element, unless the queue is full.
+ * @param value The element to append.
+ * @modifies Publishes the element to the consumer.
+ * @return 'true' if the element was appended, 'false' if the queue was full.
+ */
+template<typename T>
+bool SpscQueue<T>::tryPush(const T &value) {return push(value);}
+
+/**
+ * Appends an element by moving it, unless the queue is full.
+ * @param value The element to append.
+ * @modifies Publishes the element to the consumer; 'value' is moved from only on success.
+ * @return 'true' if the element was appended, 'false' if the queue was full.
+ */
+template<typename T>
+bool SpscQueue<T>::tryPush(T &&value) {return push(std::move(value));}
+
+/**
+ * Appends as many elements as fit.
+ * @param values The elements to append.
+ * @param count The number of elements.
+ * @modifies Publishes the appended elements to the consumer with one store.
+ * @return The number of elements appended.
+ */
+template<typename T>
+uint32_t SpscQueue<T>::tryPushBatch(const T *values, uint32_t count) {
+    uint64_t tail = mTail.load(std::memory_order_relaxed);
+    uint64_t room = mMask + 1 - (tail - mCachedHead);
+    if (room < count) {
+        mCachedHead = mHead.load(std::memory_order_acquire);
+        room = mMask + 1 - (tail - mCachedHead);
+    }
+
+    uint32_t pushed = static_cast<uint32_t>(std::min<uint64_t>(room, count));
+    for (uint32_t i = 0; i < pushed; ++i)
+        mSlots[(tail + i) & mMask] = values[i];
+    mTail.store(tail + pushed, std::memory_order_release);
+    return pushed;
+}
+
+/**
+ * Removes the oldest element, unless the queue is empty.
+ * @param out Receives the element.
+ * @modifies Frees the element's slot for the producer.
+ * @return 'true' if an element was removed, 'false' if the queue was empty.
+ */
+template<typename T>
+bool SpscQueue<T>::tryPop(T &out) {
+    uint64_t head = mHead.load(std::memory_order_relaxed);
+    if (head == mCachedTail) {
+        mCachedTail = mTail.load(std::memory_order_acquire);
+        if (head == mCachedTail)
+            return false;
+    }
+
+    out = std::move(mSlots[head & mMask]);
+    mHead.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * Removes up to a number of the oldest elements.
+ * @param out Receives the elements.
+ * @param max The most elements to remove.
+ * @modifies Frees the elements' slots for the producer with one store.
+ * @return The number of elements removed.
+ */
+template<typename T>
+uint32_t SpscQueue<T>::tryPopBatch(T *out, uint32_t max) {
+    uint64_t head = mHead.load(std::memory_order_relaxed);
+    if (mCachedTail - head < max)
+        mCachedTail = mTail.load(std::memory_order_acquire);
+
+    uint32_t popped = static_cast<uint32_t>(std::min<uint64_t>(mCachedTail - head, max));
+    for (uint32_t i = 0; i < popped; ++i)
+        out[i] = std::move(mSlots[(head + i) & mMask]);
+    mHead.store(head + popped, std::memory_order_release);
+    return popped;
+}
+
+/**
+ * Returns the number of elements in the queue.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of elements, approximate while either side is running.
+ */
+template<typename T>
+uint32_t SpscQueue<T>::size() const {
+    uint64_t head = mHead.load(std::memory_order_acquire);
+    uint64_t tail = mTail.load(std::memory_order_acquire);
+    return tail > head ? static_cast<uint32_t>(tail - head) : 0;
+}
+
+/**
+ * Checks if the queue is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the queue holds no elements, 'false' otherwise.
+ */
+template<typename T>
+bool SpscQueue<T>::isEmpty() const {return size() == 0;}
+
+/**
+ * Returns the capacity of the queue.
+ * @param N/A
+ * @modifies N/A
+ * @return The number of elements the queue can hold.
+ */
+template<typename T>
+uint32_t SpscQueue<T>::capacity() const {return static_cast<uint32_t>(mMask + 1);}
+
+/**
+ * Appends an element, copying or moving it, unless the queue is full. The shared head is read
+ * only when the cached one says the ring is full.
+ * @param value The element to append.
+ * @modifies Publishes the element to the consumer.
+ * @return 'true' if the element was appended, 'false' if the queue was full.
+ */
+template<typename T>
+template<typename Value>
+bool SpscQueue<T>::push(Value &&value) {
+    uint64_t tail = mTail.load(std::memory_order_relaxed);
+    if (tail - mCachedHead > mMask) {
+        mCachedHead = mHead.load(std::memory_order_acquire);
+        if (tail - mCachedHead > mMask)
+            return false;
+    }
+
+    mSlots[tail & mMask] = std::forward<Value>(value);
+    mTail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * Rounds a requested capacity up to a power of two.
+ * @param capacity The requested capacity.
+ * @modifies N/A
+ * @throws std::invalid_argument if the capacity is 0 or greater than 2^31.
+ * @return The capacity to allocate.
+ */
+template<typename T>
+uint32_t SpscQueue<T>::roundCapacity(uint32_t capacity) {
+    if (capacity == 0 || capacity > (1U << 31))
+        throwInvalidArgument("queue capacity must be between 1 and 2^31");
+
+    uint32_t rounded = 1;
+    while (rounded < capacity)
+        rounded <<= 1;
+    return rounded;
+}
@@ -0,0 +1,383 @@
+// Author: Mac-Noble Brako-Kusi
+// File: StaticArrayList.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for StaticArrayList template class. The standard algorithms used
+//          elsewhere are not constexpr in C++17, so the loops here are written out.
+
+/**
+ * Constructor: Creates an empty StaticArrayList.
+ * @param N/A
+ * @modifies Value-initializes the inline storage.
+ * @return N/A
+ */
+template<typename T, uint32_t N>
+constexpr StaticArrayList<T, N>::StaticArrayList()
+    : mData(),
+      mSize(0) {}
+
+/**
+ * Constructor: Creates a StaticArrayList with a specified size filled with a given value.
+ * @param size The initial size of the list.
+ * @param value The value used to initialize the elements.
+ * @modifies Initializes the first 'size' elements to 'value'.
+ * @throws std::length_error if 'size' is greater than N.
+ * @return N/A
+ */
+template<typename T, uint32_t N>
+constexpr StaticArrayList<T, N>::StaticArrayList(const uint32_t &size, const T &value)
+    : mData(),
+      mSize(0) {
+    if (size > N)
+        throwLengthError("StaticArrayList capacity exceeded");
+
+    for (; mSize < size; ++mSize)
+        mData[mSize] = value;
+}
+
+/**
+ * Adds an element to the end of the list.
+ * @param value The value to be added.
+ * @modifies Appends 'value'.
+ * @throws std::length_error if the list is full.
+ * @return A reference to the capacity of the list.
+ */
+template<typename T, uint32_t N>
+constexpr const uint32_t &StaticArrayList<T, N>::add(const T &value) {return add(mSize, value);}
+
+/**
+ * Inserts an element at a specific index.
+ * @param index The index at which to insert the element.
+ * @param value The value to be inserted.
+ * @modifies Shifts the following elements up by one, or fills the gap up to 'index' with
+ *           default values. 'value' is copied first, since it may be an element of this list.
+ * @throws std::length_error if the list would need more than N elements.
+ * @return A reference to the capacity of the list.
+ */
+template<typename T, uint32_t N>
+constexpr const uint32_t &StaticArrayList<T, N>::add(const uint32_t &index, const T &value) {
+    uint32_t newSize = (index > mSize ? index : mSize) + 1;
+    if (index >= N || newSize > N)
+        throwLengthError("StaticArrayList capacity exceeded");
+
+    T copy(value);
+    for (uint32_t i = mSize; i < index; ++i)
+        mData[i] = T();
+    for (uint32_t i = mSize; i > index; --i)
+        mData[i] = std::move(mData[i - 1]);
+    mData[index] = std::move(copy);
+    mSize = newSize;
+    return kCapacity;
+}
+
+/**
+ * Adds an element to the end of the list if there is room.
+ * @param value The value to be added.
+ * @modifies Appends 'value' unless the list is full.
+ * @return 'true' if the element was added, 'false' if the list is full.
+ */
+template<typename T, uint32_t N>
+constexpr bool StaticArrayList<T, N>::tryAdd(const T &value) {
+    if (mSize == N)
+        return false;
+
+    mData[mSize] = value;
+    ++mSize;
+    return true;
+}
+
+/**
+ * Clears the list. Elements that own resources are reset to T() so those resources are released
+ * now rather than when their slots are next overwritten; trivially destructible elements are left
+ * in place.
+ * @param N/A
+ * @modifies Resets the size and, for non-trivially destructible T, the vacated elements.
+ * @return N/A
+ */
+template<typename T, uint32_t N>
+constexpr void StaticArrayList<T, N>::clear() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (uint32_t i = 0; i < mSize; ++i)
+            mData[i] = T();
+    }
+    mSize = 0;
+}
+
+/**
+ * Retrieves the element at a specific index.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return A constant reference to the element at the specified index.
+ */
+template<typename T, uint32_t N>
+constexpr const T &StaticArrayList<T, N>::get(const uint32_t &index) const {
+    checkIndex(index);
+    return mData[index];
+}
+
+/**
+ * Retrieves a reference to the element at a specific index.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return A reference to the element at the specified index, allowing modification.
+ */
+template<typename T, uint32_t N>
+constexpr T &StaticArrayList<T, N>::get(const uint32_t &index) {
+    checkIndex(index);
+    return mData[index];
+}
+
+/**
+ * Retrieves a pointer to the element at a specific index, if there is one.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @return A pointer to the element, or nullptr if the index is out of bounds.
+ */
+template<typename T, uint32_t N>
+constexpr T *StaticArrayList<T, N>::tryGet(const uint32_t &index) noexcept {
+    return index < mSize ? mData + index : nullptr;
+}
+
+/**
+ * Retrieves a constant pointer to the element at a specific index, if there is one.
+ * @param index The index of the element to retrieve.
+ * @modifies N/A
+ * @return A constant pointer to the element, or nullptr if the index is out of bounds.
+ */
+template<typename T, uint32_t N>
+constexpr const T *StaticArrayList<T, N>::tryGet(const uint32_t &index) const noexcept {
+    return index < mSize ? mData + index : nullptr;
+}
+
+/**
+ * Accesses the element at a specific index without range checking.
+ * @param index The index of the element to access.
+ * @modifies N/A
+ * @return A reference to the element at the specified index, allowing modification.
+ */
+template<typename T, uint32_t N>
+constexpr T &StaticArrayList<T, N>::operator[](const uint32_t &index) {return mData[index];}
+
+/**
+ * Accesses the element at a specific index without range checking.
+ * @param index The index of the element to access.
+ * @modifies N/A
+ * @return A constant reference to the element at the specified index.
+ */
+template<typename T, uint32_t N>
+constexpr const T &StaticArrayList<T, N>::operator[](const uint32_t &index) const {
+    return mData[index];
+}
+
+/**
+ * Returns a pointer to the inline storage.
+ * @param N/A
+ * @modifies N/A
+ * @return A pointer to the first element.
+ */
+template<typename T, uint32_t N>
+constexpr T *StaticArrayList<T, N>::data() {return mData;}
+
+/**
+ * Returns a pointer to the inline storage.
+ * @param N/A
+ * @modifies N/A
+ * @return A constant pointer to the first element.
+ */
+template<typename T, uint32_t N>
+constexpr const T *StaticArrayList<T, N>::data() const {return mData;}
+
+/**
+ * Returns an iterator to the first element.
+ * @param N/A
+ * @modifies N/A
+ * @return A pointer to the first element.
+ */
+template<typename T, uint32_t N>
+constexpr typename StaticArrayList<T, N>::iterator StaticArrayList<T, N>::begin() {return mData;}
+
+/**
+ * Returns a const iterator to the first element.
+ * @param N/A
+ * @modifies N/A
+ * @return A constant pointer to the first element.
+ */
+template<typename T, uint32_t N>
+constexpr typename StaticArrayList<T, N>::const_iterator StaticArrayList<T, N>::begin() const {
+    return mData;
+}
+
+/**
+ * Returns the past-the-end iterator.
+ * @param N/A
+ * @modifies N/A
+ * @return A pointer one past the last element.
+ */
+template<typename T, uint32_t N>
+constexpr typename StaticArrayList<T, N>::iterator StaticArrayList<T, N>::end() {
+    return mData + mSize;
+}
+
+/**
+ * Returns the past-the-end const iterator.
+ * @param N/A
+ * @modifies N/A
+ * @return A constant pointer one past the last element.
+ */
+template<typename T, uint32_t N>
+constexpr typename StaticArrayList<T, N>::const_iterator StaticArrayList<T, N>::end() const {
+    return mData + mSize;
+}
+
+/**
+ * Checks if the list is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the list is empty, 'false' otherwise.
+ */
+template<typename T, uint32_t N>
+constexpr bool StaticArrayList<T, N>::isEmpty() const {return mSize == 0;}
+
+/**
+ * Checks if the list is full.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the list holds N elements, 'false' otherwise.
+ */
+template<typename T, uint32_t N>
+constexpr bool StaticArrayList<T, N>::isFull() const {return mSize == N;}
+
+/**
+ * Removes and returns the element at a specific index.
+ * @param index The index of the element to remove.
+ * @modifies Shifts the following elements down by one.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return The removed element.
+ */
+template<typename T, uint32_t N>
+constexpr T StaticArrayList<T, N>::remove(const uint32_t &index) {
+    checkIndex(index);
+    T removed = std::move(mData[index]);
+    erase(index);
+    return removed;
+}
+
+/**
+ * Removes the element at a specific index, if there is one.
+ * @param index The index of the element to remove.
+ * @modifies Shifts the following elements down by one.
+ * @return 'true' if an element was removed, 'false' if the index is out of bounds.
+ */
+template<typename T, uint32_t N>
+constexpr bool StaticArrayList<T, N>::tryRemove(const uint32_t &index) {
+    if (index >= mSize)
+        return false;
+
+    erase(index);
+    return true;
+}
+
+/**
+ * Sets the value of the element at a specific index.
+ * @param index The index of the element to set.
+ * @param value The new value to set.
+ * @modifies Sets the value of the element at the specified index.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return N/A
+ */
+template<typename T, uint32_t N>
+constexpr void StaticArrayList<T, N>::set(const uint32_t &index, const T &value) {
+    checkIndex(index);
+    mData[index] = value;
+}
+
+/**
+ * Sets the value of the element at a specific index, if there is one.
+ * @param index The index of the element to set.
+ * @param value The new value to set.
+ * @modifies Sets the value of the element at the specified index.
+ * @return 'true' if the element was set, 'false' if the index is out of bounds.
+ */
+template<typename T, uint32_t N>
+constexpr bool StaticArrayList<T, N>::trySet(const uint32_t &index, const T &value) {
+    if (index >= mSize)
+        return false;
+
+    mData[index] = value;
+    return true;
+}
+
+/**
+ * Returns the current size of the list.
+ * @param N/A
+ * @modifies N/A
+ * @return The current size of the list.
+ */
+template<typename T, uint32_t N>
+constexpr uint32_t StaticArrayList<T, N>::size() const {return mSize;}
+
+/**
+ * Returns the fixed capacity.
+ * @param N/A
+ * @modifies N/A
+ * @return N.
+ */
+template<typename T, uint32_t N>
+constexpr uint32_t StaticArrayList<T, N>::capacity() {return N;}
+
+/**
+ * Swaps the contents of two StaticArrayList objects. The storage is inline, so every element up
+ * to the larger of the two sizes is exchanged.
+ * @param src The StaticArrayList to swap content with.
+ * @modifies Exchanges the elements and sizes between this and 'src'.
+ * @return N/A
+ */
+template<typename T, uint32_t N>
+constexpr void StaticArrayList<T, N>::swap(StaticArrayList<T, N> &src) {
+    uint32_t count = mSize > src.mSize ? mSize : src.mSize;
+    for (uint32_t i = 0; i < count; ++i) {
+        T temp = std::move(mData[i]);
+        mData[i] = std::move(src.mData[i]);
+        src.mData[i] = std::move(temp);
+    }
+
+    uint32_t size = mSize;
+    mSize = src.mSize;
+    src.mSize = size;
+}
+
+/**
+ * Applies the bounds checking policy selected by ARRAYLIST_BOUNDS_CHECK to an index.
+ * @param index The index to be checked.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds and the policy is ARRAYLIST_CHECKED.
+ * @return N/A
+ */
+template<typename T, uint32_t N>
+constexpr void StaticArrayList<T, N>::checkIndex(uint32_t index) const {
+#if ARRAYLIST_BOUNDS_CHECK == ARRAYLIST_CHECKED
+    if (index >= mSize)
+        throwOutOfRange(index);
+#elif ARRAYLIST_BOUNDS_CHECK == ARRAYLIST_ASSERTED
+    assert(index < mSize && "StaticArrayList index out of range");
+#else
+    (void) index;
+#endif
+}
+
+/**
+ * Shifts the elements following an index down by one, then resets the vacated last slot to T()
+ * when T owns resources, so a moved-from element does not keep them alive.
+ * @param index The index of the element to remove, which must be in range.
+ * @modifies Removes the element at the specified index.
+ * @return N/A
+ */
+template<typename T, uint32_t N>
+constexpr void StaticArrayList<T, N>::erase(uint32_t index) {
+    for (uint32_t i = index + 1; i < mSize; ++i)
+        mData[i - 1] = std::move(mData[i]);
+    --mSize;
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        mData[mSize] = T();
+}
@@ -0,0 +1,455 @@
+// Author: Mac-Noble Brako-Kusi
+// File: StringList.cpp
+// Date: October 19, 2026
+// Purpose: Implementation file for StringList class
+
+#include "StringList.h"
+#include "ContainerError.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace {
+/**
+ * Spans hold 32-bit offsets and lengths, so the arena ends at 4 GiB.
+ */
+const uint64_t kMaxBytes = UINT32_MAX;
+const uint64_t kMinCapacity = 64;
+} // Namespace
+
+/**
+ * Constructor: Creates an empty StringList.
+ * @param N/A
+ * @modifies Starts with no spans and no arena.
+ * @return N/A
+ */
+StringList::StringList()
+    : mSpans(),
+      mBytes(),
+      mCapacity(0),
+      mUsed(0),
+      mDead(0) {}
+
+/**
+ * Constructor: Creates a StringList from an ArrayList of strings.
+ * @param values The strings, in order.
+ * @modifies Copies every string of 'values' into one arena.
+ * @return N/A
+ */
+StringList::StringList(const ArrayList<std::string> &values)
+    : StringList() {
+    addAll(values);
+}
+
+/**
+ * Copy Constructor: Creates a compacted copy of another StringList.
+ * @param src The list to copy.
+ * @modifies Copies the spans, and the live bytes into an arena of their exact size.
+ * @return N/A
+ */
+StringList::StringList(const StringList &src)
+    : mSpans(src.mSpans),
+      mBytes(),
+      mCapacity(0),
+      mUsed(0),
+      mDead(0) {
+    uint64_t live = src.mUsed - src.mDead;
+    if (live == 0)
+        return;
+
+    ScopedArray<char> bytes(new char[live]);
+    mUsed = pack(src.mBytes.get(), bytes.get(), src.mUsed, src.mDead);
+    mCapacity = live;
+    mBytes.swap(bytes);
+}
+
+/**
+ * Move Constructor: Takes the contents of another StringList.
+ * @param src The list to move from.
+ * @modifies Leaves 'src' empty.
+ * @return N/A
+ */
+StringList::StringList(StringList &&src) noexcept
+    : mSpans(std::move(src.mSpans)),
+      mBytes(),
+      mCapacity(src.mCapacity),
+      mUsed(src.mUsed),
+      mDead(src.mDead) {
+    mBytes.swap(src.mBytes);
+    src.mCapacity = 0;
+    src.mUsed = 0;
+    src.mDead = 0;
+}
+
+/**
+ * Copy Assignment Operator: Replaces the contents with a compacted copy of another StringList.
+ * @param src The list to copy.
+ * @modifies Replaces the spans and the arena; unchanged if the copy throws.
+ * @return A reference to this list.
+ */
+StringList &StringList::operator=(const StringList &src) {
+    if (this != &src)
+        *this = StringList(src);
+    return *this;
+}
+
+/**
+ * Move Assignment Operator: Takes the contents of another StringList.
+ * @param src The list to move from.
+ * @modifies Frees this list's arena and leaves 'src' empty.
+ * @return A reference to this list.
+ */
+StringList &StringList::operator=(StringList &&src) noexcept {
+    if (this != &src) {
+        mSpans = std::move(src.mSpans);
+        mBytes.swap(src.mBytes);
+        src.mBytes.reset();
+        mCapacity = std::exchange(src.mCapacity, 0);
+        mUsed = std::exchange(src.mUsed, 0);
+        mDead = std::exchange(src.mDead, 0);
+    }
+    return *this;
+}
+
+/**
+ * Adds a string to the end of the list.
+ * @param value The string to add.
+ * @modifies Copies 'value' to the end of the arena, growing it if needed.
+ * @throws std::length_error if the list or the arena is full.
+ * @return N/A
+ */
+void StringList::add(std::string_view value) {
+    if (mSpans.size() == UINT32_MAX)
+        throwLengthError("StringList is full");
+    // A view of this list's own arena would dangle if the arena grew
+    if (value.data() >= mBytes.get() && value.data() < mBytes.get() + mCapacity) {
+        add(std::string(value));
+        return;
+    }
+
+    char* out = append(value.size());
+    if (!value.empty())
+        std::memcpy(out, value.data(), value.size());
+    uint32_t offset = static_cast<uint32_t>(out - mBytes.get());
+    CONTAINER_TRY {
+        mSpans.add(Span{offset, static_cast<uint32_t>(value.size())});
+    } CONTAINER_CATCH_ALL {
+        mUsed -= value.size();
+        CONTAINER_RETHROW;
+    }
+}
+
+/**
+ * Adds every string of another StringList.
+ * @param values The strings to add.
+ * @modifies Copies the bytes of 'values' to the end of the arena, growing it at most once.
+ * @throws std::length_error if the list or the arena would be full.
+ * @return N/A
+ */
+void StringList::addAll(const StringList &values) {
+    if (&values == this) {
+        addAll(StringList(values));
+        return;
+    }
+    if (uint64_t(mSpans.size()) + values.size() > UINT32_MAX)
+        throwLengthError("StringList is full");
+
+    uint64_t live = values.mUsed - values.mDead;
+    char* out = append(live);
+    uint64_t start = mUsed - live;
+    uint32_t before = mSpans.size();
+    CONTAINER_TRY {
+        // An arena with no dead bytes is copied as it is, so its spans keep their layout;
+        // otherwise the live bytes are copied end to end
+        uint64_t offset = start;
+        for (uint32_t i = 0; i < values.size(); ++i) {
+            const Span& span = values.mSpans[i];
+            uint64_t at = values.mDead == 0 ? start + span.offset : offset;
+            mSpans.add(Span{static_cast<uint32_t>(at), span.length});
+            offset += span.length;
+        }
+    } CONTAINER_CATCH_ALL {
+        while (mSpans.size() > before)
+            mSpans.remove(mSpans.size() - 1);
+        mUsed = start;
+        CONTAINER_RETHROW;
+    }
+
+    if (values.mDead == 0) {
+        if (live > 0)
+            std::memcpy(out, values.mBytes.get(), live);
+        return;
+    }
+    for (uint32_t i = 0; i < values.size(); ++i) {
+        const Span& span = values.mSpans[i];
+        if (span.length > 0) {
+            std::memcpy(mBytes.get() + mSpans[before + i].offset,
+                        values.mBytes.get() + span.offset, span.length);
+        }
+    }
+}
+
+/**
+ * Adds every string of an ArrayList.
+ * @param values The strings to add.
+ * @modifies Copies the strings to the end of the arena, growing it at most once.
+ * @throws std::length_error if the list or the arena would be full.
+ * @return N/A
+ */
+void StringList::addAll(const ArrayList<std::string> &values) {
+    if (uint64_t(mSpans.size()) + values.size() > UINT32_MAX)
+        throwLengthError("StringList is full");
+
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < values.size(); ++i)
+        total += values[i].size();
+    char* out = append(total);
+    uint64_t start = mUsed - total;
+    uint32_t before = mSpans.size();
+    CONTAINER_TRY {
+        for (uint32_t i = 0; i < values.size(); ++i) {
+            const std::string& value = values[i];
+            mSpans.add(Span{static_cast<uint32_t>(out - mBytes.get()),
+                            static_cast<uint32_t>(value.size())});
+            if (!value.empty())
+                std::memcpy(out, value.data(), value.size());
+            out += value.size();
+        }
+    } CONTAINER_CATCH_ALL {
+        while (mSpans.size() > before)
+            mSpans.remove(mSpans.size() - 1);
+        mUsed = start;
+        CONTAINER_RETHROW;
+    }
+}
+
+/**
+ * Retrieves the string at a specific index.
+ * @param index The index of the string to retrieve.
+ * @modifies N/A
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return A view of the string.
+ */
+std::string_view StringList::get(uint32_t index) const {
+    if (index >= mSpans.size())
+        throwOutOfRange(index);
+
+    return (*this)[index];
+}
+
+/**
+ * Retrieves the string at a specific index without range checking.
+ * @param index The index of the string to retrieve.
+ * @modifies N/A
+ * @return A view of the string.
+ */
+std::string_view StringList::operator[](uint32_t index) const {
+    const Span& span = mSpans[index];
+    return std::string_view(mBytes.get() + span.offset, span.length);
+}
+
+/**
+ * Replaces the string at a specific index. A string no longer than the old one overwrites it in
+ * place; a longer one is appended to the arena.
+ * @param index The index of the string to replace.
+ * @param value The new string.
+ * @modifies Rewrites the element's span; the bytes it no longer covers become dead bytes.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @throws std::length_error if the arena is full.
+ * @return N/A
+ */
+void StringList::set(uint32_t index, std::string_view value) {
+    if (index >= mSpans.size())
+        throwOutOfRange(index);
+    if (value.data() >= mBytes.get() && value.data() < mBytes.get() + mCapacity) {
+        set(index, std::string(value));
+        return;
+    }
+
+    uint32_t length = static_cast<uint32_t>(value.size());
+    if (length <= mSpans[index].length) {
+        Span& span = mSpans[index];
+        if (length > 0)
+            std::memcpy(mBytes.get() + span.offset, value.data(), length);
+        mDead += span.length - length;
+        span.length = length;
+        return;
+    }
+
+    // Growing the arena may move every span, this one included
+    char* out = append(length);
+    std::memcpy(out, value.data(), length);
+    Span& span = mSpans[index];
+    mDead += span.length;
+    span = Span{static_cast<uint32_t>(out - mBytes.get()), length};
+}
+
+/**
+ * Removes the string at a specific index.
+ * @param index The index of the string to remove.
+ * @modifies Shifts later spans down; the element's bytes become dead bytes.
+ * @throws std::out_of_range if the index is out of bounds.
+ * @return N/A
+ */
+void StringList::remove(uint32_t index) {
+    if (index >= mSpans.size())
+        throwOutOfRange(index);
+
+    mDead += mSpans[index].length;
+    mSpans.remove(index);
+}
+
+/**
+ * Makes room in the arena.
+ * @param bytes The number of bytes the arena should hold without growing.
+ * @modifies Grows the arena, dropping its dead bytes, if it holds fewer than 'bytes'.
+ * @throws std::length_error if 'bytes' exceeds the largest arena.
+ * @return N/A
+ */
+void StringList::reserve(uint64_t bytes) {
+    if (bytes > kMaxBytes)
+        throwLengthError("StringList arena cannot exceed 4 GiB");
+    if (bytes > mCapacity)
+        reallocate(bytes);
+}
+
+/**
+ * Rewrites the arena to hold only the live bytes.
+ * @param N/A
+ * @modifies Moves every element's bytes and frees the dead and unused ones.
+ * @return N/A
+ */
+void StringList::compact() {
+    if (mUsed - mDead < mCapacity)
+        reallocate(mUsed - mDead);
+}
+
+/**
+ * Copies the strings into an ArrayList.
+ * @param N/A
+ * @modifies N/A
+ * @return The strings, in order.
+ */
+ArrayList<std::string> StringList::toArrayList() const {
+    ArrayList<std::string> values(size());
+    for (uint32_t i = 0; i < values.size(); ++i)
+        values[i].assign((*this)[i]);
+    return values;
+}
+
+/**
+ * Returns the number of elements.
+ * @param N/A
+ * @modifies N/A
+ * @return The size of the list.
+ */
+uint32_t StringList::size() const {return mSpans.size();}
+
+/**
+ * Checks if the list is empty.
+ * @param N/A
+ * @modifies N/A
+ * @return 'true' if the list is empty, 'false' otherwise.
+ */
+bool StringList::isEmpty() const {return mSpans.size() == 0;}
+
+/**
+ * Returns the number of bytes of the elements.
+ * @param N/A
+ * @modifies N/A
+ * @return The live bytes.
+ */
+uint64_t StringList::byteSize() const {return mUsed - mDead;}
+
+/**
+ * Returns the number of used arena bytes no element covers.
+ * @param N/A
+ * @modifies N/A
+ * @return The dead bytes.
+ */
+uint64_t StringList::deadBytes() const {return mDead;}
+
+/**
+ * Clears the list.
+ * @param N/A
+ * @modifies Frees the spans and the arena.
+ * @return N/A
+ */
+void StringList::clear() {
+    mSpans.clear();
+    mBytes.reset();
+    mCapacity = 0;
+    mUsed = 0;
+    mDead = 0;
+}
+
+/**
+ * Returns the bytes allocated by the list.
+ * @param N/A
+ * @modifies N/A
+ * @return The memory footprint in bytes.
+ */
+size_t StringList::memoryFootprint() const {return mSpans.memoryFootprint() + mCapacity;}
+
+/**
+ * Claims bytes at the end of the arena, growing it if they do not fit. Growth doubles the live
+ * bytes and drops the dead ones on the way.
+ * @param bytes The number of bytes to claim.
+ * @modifies Advances the end of the used bytes; may move the arena and every span.
+ * @throws std::length_error if the live bytes and 'bytes' exceed the largest arena.
+ * @return A pointer to the first claimed byte.
+ */
+char *StringList::append(uint64_t bytes) {
+    if (mUsed + bytes > mCapacity) {
+        uint64_t needed = mUsed - mDead + bytes;
+        if (needed > kMaxBytes)
+            throwLengthError("StringList arena cannot exceed 4 GiB");
+        reallocate(std::max(needed, std::min(kMaxBytes, std::max(kMinCapacity, 2 * needed))));
+    }
+
+    char* out = mBytes.get() + mUsed;
+    mUsed += bytes;
+    return out;
+}
+
+/**
+ * Moves the live bytes into a new arena.
+ * @param capacity The size of the new arena, at least the live bytes.
+ * @modifies Replaces the arena and rewrites the spans; no dead bytes remain.
+ * @return N/A
+ */
+void StringList::reallocate(uint64_t capacity) {
+    ScopedArray<char> bytes(capacity > 0 ? new char[capacity] : nullptr);
+    mUsed = pack(mBytes.get(), bytes.get(), mUsed, mDead);
+    mDead = 0;
+    mCapacity = capacity;
+    mBytes.swap(bytes);
+}
+
+/**
+ * Copies the live bytes of an arena described by mSpans into another. An arena with no dead bytes
+ * is copied in one piece; otherwise each span is copied in element order and pointed at its copy.
+ * @param from The arena the spans describe.
+ * @param to The arena to copy into, with room for the live bytes.
+ * @param used The bytes used in 'from'.
+ * @param dead The dead bytes among them.
+ * @modifies Writes 'to'; rewrites the span offsets if 'dead' is not 0.
+ * @return The bytes used in 'to'.
+ */
+uint64_t StringList::pack(const char *from, char *to, uint64_t used, uint64_t dead) {
+    if (dead == 0) {
+        if (used > 0)
+            std::memcpy(to, from, used);
+        return used;
+    }
+
+    uint64_t offset = 0;
+    for (uint32_t i = 0; i < mSpans.size(); ++i) {
+        Span& span = mSpans[i];
+        if (span.length > 0)
+            std::memcpy(to + offset, from + span.offset, span.length);
+        span.offset = static_cast<uint32_t>(offset);
+        offset += span.length;
+    }
+    return offset;
+}
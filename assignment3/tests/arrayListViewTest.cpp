@@ -0,0 +1,136 @@
+// Author: Mac-Noble Brako-Kusi
+// File: arrayListViewTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the lazy views over ArrayList
+
+#include "ArrayListView.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+// The fixture for testing the views.
+class ArrayListViewTest : public ::testing::Test {
+protected:
+    // A list holding 0, 1, ..., size - 1
+    static ArrayList<int> iota(int size) {
+        ArrayList<int> list;
+        for (int i = 0; i < size; ++i)
+            list.add(i);
+        return list;
+    }
+
+    // The elements of a collected list, for comparison
+    template<typename T> static std::vector<T> contents(const ArrayList<T>& list) {
+        return std::vector<T>(list.data(), list.data() + list.size());
+    }
+};
+
+// Slices share the list's elements, and writes through them reach the list
+TEST_F(ArrayListViewTest, SlicesWithoutCopying)
+{
+    ArrayList<int> list = iota(10);
+    SliceView<int> middle = slice(list, 2, 8);
+    EXPECT_EQ(middle.size(), 6U);
+    EXPECT_EQ(middle.data(), list.data() + 2);
+    EXPECT_EQ(middle.slice(1, 3)[0], 3);
+
+    middle.forEach([](int& value) {value *= 10;});
+    EXPECT_EQ(list[1], 1);
+    EXPECT_EQ(list[2], 20);
+    EXPECT_EQ(list[7], 70);
+    EXPECT_EQ(list[8], 8);
+
+    const ArrayList<int>& constant = list;
+    EXPECT_EQ(slice(constant).size(), 10U);
+    EXPECT_TRUE(slice(list, 4, 4).isEmpty());
+    EXPECT_THROW(slice(list, 5, 4), std::out_of_range);
+    EXPECT_THROW(slice(list, 0, 11), std::out_of_range);
+}
+
+// A chain of stages runs as one pass, calling each function once per element it reaches
+TEST_F(ArrayListViewTest, FusesStages)
+{
+    ArrayList<int> list = iota(100);
+    int mapped = 0;
+    int tested = 0;
+    ArrayList<int> out = slice(list)
+                             .map([&mapped](int value) {++mapped; return value * 3;})
+                             .filter([&tested](int value) {++tested; return value % 2 == 0;})
+                             .map([](int value) {return value + 1;})
+                             .collect();
+    EXPECT_EQ(mapped, 100);
+    EXPECT_EQ(tested, 100);
+    ASSERT_EQ(out.size(), 50U);
+    EXPECT_EQ(out.capacity(), 50U);
+    EXPECT_EQ(out[0], 1);
+    EXPECT_EQ(out[49], 295);
+}
+
+// take() over a filter stops the source as soon as enough elements have passed
+TEST_F(ArrayListViewTest, TakesAndDrops)
+{
+    ArrayList<int> list = iota(1000);
+    int tested = 0;
+    auto odd = slice(list).filter([&tested](int value) {++tested; return value % 2 == 1;});
+    EXPECT_EQ(contents(odd.take(3).collect()), (std::vector<int>{1, 3, 5}));
+    EXPECT_EQ(tested, 6);
+    EXPECT_EQ(contents(odd.drop(497).collect()), (std::vector<int>{995, 997, 999}));
+    EXPECT_TRUE(odd.take(0).collect().isEmpty());
+
+    auto tail = slice(list).drop(990).take(5);
+    EXPECT_EQ(tail.size(), 5U);
+    EXPECT_EQ(tail[4], 994);
+    EXPECT_EQ(slice(list).drop(2000).size(), 0U);
+    EXPECT_EQ(slice(list).take(2000).size(), 1000U);
+}
+
+// zip() and enumerate() pair elements, as long as the shorter view
+TEST_F(ArrayListViewTest, ZipsAndEnumerates)
+{
+    ArrayList<int> quantities = iota(5);
+    ArrayList<std::string> names;
+    for (const char* name : {"a", "b", "c"})
+        names.add(name);
+
+    ArrayList<std::pair<int, std::string>> zipped = slice(quantities).zip(slice(names)).collect();
+    ASSERT_EQ(zipped.size(), 3U);
+    EXPECT_EQ(zipped[2], std::make_pair(2, std::string("c")));
+
+    slice(quantities).zip(slice(names)).forEach([](std::pair<int&, std::string&> item) {
+        item.first += 10;
+        item.second += "!";
+    });
+    EXPECT_EQ(quantities[0], 10);
+    EXPECT_EQ(names[2], "c!");
+
+    auto indexed = slice(names).enumerate().collect();
+    EXPECT_EQ(indexed[1], std::make_pair(1U, std::string("b!")));
+    auto small = slice(quantities).filter([](int value) {return value < 10;}).enumerate();
+    std::vector<std::pair<uint32_t, int>> expected = {{0, 3}, {1, 4}};
+    EXPECT_EQ(contents(small.collect()), expected);
+}
+
+// chunk() splits a view into subviews and stride() picks every step-th element
+TEST_F(ArrayListViewTest, ChunksAndStrides)
+{
+    ArrayList<int> list = iota(10);
+    auto chunks = slice(list).chunk(4);
+    ASSERT_EQ(chunks.size(), 3U);
+    EXPECT_EQ(chunks[2].size(), 2U);
+    EXPECT_EQ(chunks[1][0], 4);
+
+    ArrayList<ArrayList<int>> collected = chunks.collect();
+    ASSERT_EQ(collected.size(), 3U);
+    EXPECT_EQ(contents(collected[2]), (std::vector<int>{8, 9}));
+
+    EXPECT_EQ(contents(slice(list).stride(3).collect()), (std::vector<int>{0, 3, 6, 9}));
+    EXPECT_EQ(slice(list).stride(3).size(), 4U);
+    auto evens = slice(list).filter([](int value) {return value % 2 == 0;});
+    EXPECT_EQ(contents(evens.stride(2).collect()), (std::vector<int>{0, 4, 8}));
+
+    EXPECT_THROW(slice(list).chunk(0), std::invalid_argument);
+    EXPECT_THROW(slice(list).stride(0), std::invalid_argument);
+}
+} // Namespace
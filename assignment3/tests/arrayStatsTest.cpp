@@ -0,0 +1,118 @@
+// Author: Mac-Noble Brako-Kusi
+// File: arrayStatsTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the ArrayList operation counters, built with ARRAYLIST_STATS=1
+
+#include "ArrayList.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+static_assert(ARRAYLIST_STATS, "this test must be built with ARRAYLIST_STATS=1");
+
+namespace {
+// The fixture for testing ArrayListStats.
+class ArrayListStatsTest : public ::testing::Test {
+protected:
+    void SetUp() override {ArrayListStats::resetTotals();}
+};
+
+// Every operation type is counted, along with the elements each one transfers
+TEST_F(ArrayListStatsTest, CountsOperations)
+{
+    ArrayList<uint64_t> a;
+    for (uint64_t i = 0; i < 5; ++i)
+        a.add(i);
+    ArrayListStats stats = a.stats();
+    EXPECT_EQ(stats.appends, 5U);
+    EXPECT_EQ(stats.reallocations, 4U); // Capacity 1, 2, 4, 8
+    EXPECT_EQ(stats.elementsMoved, 1U + 2U + 4U);
+    EXPECT_EQ(stats.bytesTransferred, 7 * sizeof(uint64_t));
+    EXPECT_EQ(stats.peakCapacity, 8U);
+    EXPECT_EQ(stats.wastedCapacity(), 3U);
+
+    a.add(0, 9);
+    a.get(1);
+    a.set(1, 4);
+    a.tryGet(10);
+    EXPECT_THROW(a.get(10), std::out_of_range);
+    a.remove(0);
+    a.tryRemove(10);
+    stats = a.stats();
+    EXPECT_EQ(stats.inserts, 1U);
+    EXPECT_EQ(stats.elementsCopied, 5U);
+    EXPECT_EQ(stats.elementsMoved, 7U + 5U);
+    EXPECT_EQ(stats.gets, 3U);
+    EXPECT_EQ(stats.sets, 1U);
+    EXPECT_EQ(stats.removes, 2U);
+    EXPECT_EQ(stats.outOfRange, 1U);
+
+    uint32_t indices[] = {0, 1, 2};
+    uint64_t values[3];
+    a.gather(indices, 3, values);
+    a.scatter(indices, 3, values);
+    EXPECT_EQ(a.stats().gets, 6U);
+    EXPECT_EQ(a.stats().sets, 4U);
+
+    // A copy starts with its own counters, and clear() keeps the peak
+    ArrayList<uint64_t> b(a);
+    EXPECT_EQ(b.stats().copies, 1U);
+    EXPECT_EQ(b.stats().appends, 0U);
+    a.clear();
+    EXPECT_EQ(a.stats().clears, 1U);
+    EXPECT_EQ(a.stats().peakCapacity, 8U);
+    EXPECT_EQ(a.stats().capacity, 0U);
+}
+
+// Assignment counts on the assigned list, and creates no list of its own
+TEST_F(ArrayListStatsTest, Assignment)
+{
+    {
+        ArrayList<uint64_t> a;
+        for (uint64_t i = 0; i < 6; ++i)
+            a.add(i);
+        ArrayList<uint64_t> b;
+        b = a;
+        ArrayListStats stats = b.stats();
+        EXPECT_EQ(stats.copies, 1U);
+        EXPECT_EQ(stats.reallocations, 1U);
+        EXPECT_EQ(stats.elementsCopied, 6U);
+        EXPECT_EQ(stats.bytesTransferred, 6 * sizeof(uint64_t));
+        EXPECT_EQ(stats.peakCapacity, 8U);
+        EXPECT_EQ(a.stats().copies, 0U);
+
+        // Moving between lists of the same resource transfers no element
+        ArrayList<uint64_t> c;
+        c = std::move(b);
+        EXPECT_EQ(c.stats().reallocations, 0U);
+        EXPECT_EQ(c.size(), 6U);
+    }
+    ArrayListStats totals = ArrayListStats::totals();
+    EXPECT_EQ(totals.lists, 3U);
+    EXPECT_EQ(totals.copies, 1U);
+}
+
+// Destroyed lists of every element type are summed into the totals
+TEST_F(ArrayListStatsTest, Totals)
+{
+    {
+        ArrayList<int> a;
+        a.add(1);
+        a.add(2);
+        a.add(3);
+        ArrayList<std::string> b;
+        b.add("x");
+        EXPECT_EQ(ArrayListStats::totals().lists, 0U);
+    }
+    ArrayListStats totals = ArrayListStats::totals();
+    EXPECT_EQ(totals.lists, 2U);
+    EXPECT_EQ(totals.appends, 4U);
+    EXPECT_EQ(totals.peakCapacity, 4U);
+    EXPECT_EQ(totals.wastedCapacity(), 1U);
+
+    std::ostringstream out;
+    totals.dump(out);
+    EXPECT_NE(out.str().find("appends 4\n"), std::string::npos);
+    EXPECT_NE(out.str().find("wastedCapacity 1\n"), std::string::npos);
+}
+} // Namespace
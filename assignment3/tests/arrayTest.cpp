@@ -2,6 +2,7 @@
 
 #include "ArrayList.h"
 #include <gtest/gtest.h>
+#include <string>
 
 namespace {
 // The fixture for testing ArrayList and ArrayListIterator.
@@ -160,6 +161,43 @@ TEST_F(ArrayListTest, AddViaIndex)
     }
 }
 
+// An index that would take the list past UINT32_MAX elements is refused, leaving it unchanged
+TEST_F(ArrayListTest, AddPastMaximumSize)
+{
+    ArrayList<uint32_t> a;
+    a.add(7);
+    EXPECT_THROW(a.add(UINT32_MAX, 1), std::length_error);
+    EXPECT_EQ(a.size(), 1UL);
+    EXPECT_EQ(a.capacity(), 1UL);
+    EXPECT_EQ(a[0], 7UL);
+}
+
+// Appending a whole list reuses spare capacity or reallocates once, even when appending itself
+TEST_F(ArrayListTest, AddAll)
+{
+    ArrayList<std::string> a;
+    ArrayList<std::string> b;
+    for (uint32_t i = 0; i < 5; ++i)
+        b.add(std::to_string(i));
+
+    a.addAll(ArrayList<std::string>());
+    EXPECT_TRUE(a.isEmpty());
+    EXPECT_EQ(a.addAll(b), 5UL);
+    a.add("5");
+    EXPECT_EQ(a.capacity(), 10UL);
+    EXPECT_EQ(a.addAll(b), 20UL);
+    ASSERT_EQ(a.size(), 11UL);
+    EXPECT_EQ(a[5], "5");
+    EXPECT_EQ(a[10], "4");
+
+    EXPECT_EQ(b.capacity(), 8UL);
+    EXPECT_EQ(b.addAll(b), 16UL);
+    EXPECT_EQ(b.addAll(b), 32UL);
+    ASSERT_EQ(b.size(), 20UL);
+    for (uint32_t i = 0; i < 20; ++i)
+        EXPECT_EQ(b[i], std::to_string(i % 5));
+}
+
 // Make sure that we can get elements
 TEST_F(ArrayListTest, GetWorks)
 {
@@ -284,4 +322,211 @@ TEST_F(ArrayListTest, Clear)
     EXPECT_DEATH({ a[0] = 100L; }, "");
 }
 
+// Non-throwing accessors report out-of-range indices through their return value
+TEST_F(ArrayListTest, TryAccessors)
+{
+    ArrayList<long> a(4, 7L);
+    a.add(8L);
+    EXPECT_EQ(a.size(), 5UL);
+    EXPECT_NE(a.tryGet(4), nullptr);
+    EXPECT_EQ(*a.tryGet(4), 8L);
+    EXPECT_EQ(a.tryGet(5), nullptr); // Within capacity, but past the end
+    EXPECT_THROW(a.get(5), std::out_of_range);
+    EXPECT_THROW(a.get(5), ArrayList<long>::out_of_range);
+
+    EXPECT_TRUE(a.trySet(0, 1L));
+    EXPECT_FALSE(a.trySet(5, 1L));
+    EXPECT_EQ(a[0], 1L);
+
+    long removed = 0;
+    EXPECT_TRUE(a.tryRemove(0, removed));
+    EXPECT_EQ(removed, 1L);
+    EXPECT_FALSE(a.tryRemove(4, removed));
+    EXPECT_EQ(removed, 1L);
+    EXPECT_TRUE(a.tryRemove(3));
+    EXPECT_EQ(a.size(), 3UL);
+
+    const ArrayList<long>& c = a;
+    EXPECT_EQ(c.tryGet(3), nullptr);
+    EXPECT_EQ(*c.tryGet(2), 7L);
+
+    ASSERT_EQ(a.size(), 3UL);
+    try {
+        a.get(3);
+        FAIL() << "get(3) did not throw";
+    } catch (const ArrayList<long>::out_of_range& ex) {
+        EXPECT_EQ(ex.getIndex(), 3U);
+    }
+}
+
+// Batched access matches element-by-element access, for every prefetch distance
+TEST_F(ArrayListTest, GatherScatter)
+{
+    ArrayList<long> a;
+    for (long i = 0; i < 100; ++i)
+        a.add(i * i);
+    uint32_t indices[37];
+    for (uint32_t i = 0; i < 37; ++i)
+        indices[i] = (i * 13) % 100;
+
+    for (uint32_t distance : {0U, 1U, 16U, 64U}) {
+        long out[37] = {};
+        a.gather(indices, 37, out, distance);
+        for (uint32_t i = 0; i < 37; ++i)
+            EXPECT_EQ(out[i], a[indices[i]]);
+
+        ArrayList<long> b(100, -1L);
+        b.scatter(indices, 37, out, distance);
+        for (uint32_t i = 0; i < 37; ++i)
+            EXPECT_EQ(b[indices[i]], a[indices[i]]);
+        EXPECT_EQ(b[1], -1L);
+    }
+
+    // The last value written to a repeated index wins
+    uint32_t repeated[] = {4, 4, 4};
+    long values[] = {1, 2, 3};
+    a.scatter(repeated, 3, values);
+    EXPECT_EQ(a[4], 3L);
+
+    // A bad index is reported before anything is written
+    uint32_t bad[] = {0, 1, 100};
+    EXPECT_THROW(a.scatter(bad, 3, values), std::out_of_range);
+    EXPECT_EQ(a[0], 0L);
+    EXPECT_THROW(a.gather(bad, 3, values), std::out_of_range);
+}
+
+// The footprint follows the capacity, and shrinking releases the spare part
+TEST_F(ArrayListTest, ShrinkToFit)
+{
+    ArrayList<long> a;
+    EXPECT_EQ(a.memoryFootprint(), 0U);
+    for (long i = 0; i < 5; ++i)
+        a.add(i);
+    EXPECT_EQ(a.capacity(), 8U);
+    EXPECT_EQ(a.memoryFootprint(), 8 * sizeof(long));
+
+    a.shrinkToFit();
+    EXPECT_EQ(a.capacity(), 5U);
+    EXPECT_EQ(a.memoryFootprint(), 5 * sizeof(long));
+    for (long i = 0; i < 5; ++i)
+        EXPECT_EQ(a[i], i);
+
+    a.add(5);
+    EXPECT_EQ(a.capacity(), 10U);
+    while (!a.isEmpty())
+        a.remove(0);
+    a.shrinkToFit();
+    EXPECT_EQ(a.capacity(), 0U);
+    EXPECT_EQ(a.data(), nullptr);
+
+    ArrayList<std::string> b(3, "abc");
+    EXPECT_EQ(b.memoryFootprint(), 3 * sizeof(std::string));
+}
+
+// An element whose copies throw once copiesLeft runs out
+struct Fragile {
+    static int copiesLeft;
+
+    Fragile() = default;
+    explicit Fragile(int value) : value(value) {}
+    Fragile(const Fragile& other) : value(other.value) {spend();}
+
+    Fragile& operator=(const Fragile& other) {
+        spend();
+        value = other.value;
+        return *this;
+    }
+
+    static void spend() {
+        if (copiesLeft-- <= 0)
+            throw std::runtime_error("copy failed");
+    }
+
+    int value = 0;
+};
+
+int Fragile::copiesLeft = 1 << 30;
+
+// A batch applies inserts, sets and removals by their indexes before the batch, in one pass
+TEST_F(ArrayListTest, BatchEdits)
+{
+    ArrayList<int> a;
+    for (int i = 0; i < 6; ++i)
+        a.add(i);
+    ArrayList<int>::Batch batch;
+    batch.remove(0);
+    batch.insert(3, 30);
+    batch.set(3, 33);
+    batch.insert(3, 31);
+    batch.remove(4);
+    batch.remove(4);
+    batch.set(5, 50);
+    batch.set(5, 55);
+    batch.insert(6, 60);
+    EXPECT_EQ(batch.size(), 9U);
+
+    a.apply(batch);
+    int expected[] = {1, 2, 30, 31, 33, 55, 60};
+    ASSERT_EQ(a.size(), 7U);
+    for (uint32_t i = 0; i < a.size(); ++i)
+        EXPECT_EQ(a[i], expected[i]);
+
+    ArrayList<int>::Batch sets;
+    sets.set(0, -1);
+    sets.set(6, -6);
+    int* before = a.data();
+    a.apply(sets);
+    EXPECT_EQ(a.data(), before);
+    EXPECT_EQ(a[0], -1);
+    EXPECT_EQ(a[6], -6);
+
+    batch.clear();
+    EXPECT_TRUE(batch.isEmpty());
+    a.apply(batch);
+    EXPECT_EQ(a.size(), 7U);
+
+    // However often one index is removed, it removes one element
+    for (int i = 0; i < 50000; ++i)
+        batch.remove(i % 2 == 0 ? 1 : 5);
+    a.apply(batch);
+    ASSERT_EQ(a.size(), 5U);
+    EXPECT_EQ(a[1], 30);
+    EXPECT_EQ(a[4], -6);
+}
+
+// An invalid index or a failing copy leaves the list as it was
+TEST_F(ArrayListTest, BatchStrongGuarantee)
+{
+    ArrayList<std::string> a(3, "abc");
+    ArrayList<std::string>::Batch batch;
+    batch.set(0, "x");
+    batch.insert(3, "end");
+    batch.remove(3);
+    EXPECT_THROW(a.apply(batch), std::out_of_range);
+
+    ArrayList<std::string>::Batch tooFar;
+    tooFar.insert(4, "far");
+    EXPECT_THROW(a.apply(tooFar), std::out_of_range);
+    ASSERT_EQ(a.size(), 3U);
+    EXPECT_EQ(a[0], "abc");
+
+    ArrayList<Fragile> b;
+    for (int i = 0; i < 5; ++i)
+        b.add(Fragile(i));
+    ArrayList<Fragile>::Batch edits;
+    edits.remove(0);
+    edits.insert(2, Fragile(9));
+    Fragile::copiesLeft = 3;
+    EXPECT_THROW(b.apply(edits), std::runtime_error);
+    Fragile::copiesLeft = 1 << 30;
+    ASSERT_EQ(b.size(), 5U);
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(b[i].value, i);
+
+    b.apply(edits);
+    ASSERT_EQ(b.size(), 5U);
+    EXPECT_EQ(b[0].value, 1);
+    EXPECT_EQ(b[1].value, 9);
+}
+
 } // Namespace
@@ -0,0 +1,155 @@
+// Author: Mac-Noble Brako-Kusi
+// File: bitArrayTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the BitArrayList class
+
+#include "BitArrayList.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+namespace {
+// The fixture for testing BitArrayList.
+class BitArrayListTest : public ::testing::Test {
+};
+
+// Bits are packed and grow a word at a time
+TEST_F(BitArrayListTest, AddAndGet)
+{
+    BitArrayList a;
+    EXPECT_TRUE(a.isEmpty());
+    EXPECT_EQ(a.add(true), 64U);
+    for (uint32_t i = 1; i < 1000; ++i)
+        a.add(i % 3 == 0);
+
+    EXPECT_EQ(a.size(), 1000U);
+    EXPECT_EQ(a.wordCount(), 16U);
+    for (uint32_t i = 0; i < 1000; ++i)
+        EXPECT_EQ(a.get(i), i % 3 == 0);
+    EXPECT_THROW(a.get(1000), std::out_of_range);
+
+    a.set(1, true);
+    EXPECT_TRUE(a[1]);
+    a[1] = false;
+    EXPECT_FALSE(a.get(1));
+    a[2] = a[0];
+    EXPECT_TRUE(a[2]);
+    EXPECT_THROW(a.set(1000, true), std::out_of_range);
+}
+
+// Whole words can be appended at unaligned positions
+TEST_F(BitArrayListTest, AddWord)
+{
+    BitArrayList a;
+    a.add(true);
+    a.addWord(0xF0F0F0F0F0F0F0F0ULL);
+    a.addWord(0x5ULL, 3);
+    EXPECT_EQ(a.size(), 68U);
+    EXPECT_TRUE(a[0]);
+    for (uint32_t i = 0; i < 64; ++i)
+        EXPECT_EQ(a[i + 1], ((0xF0F0F0F0F0F0F0F0ULL >> i) & 1) == 1) << i;
+    EXPECT_TRUE(a[65]);
+    EXPECT_FALSE(a[66]);
+    EXPECT_TRUE(a[67]);
+    EXPECT_THROW(a.addWord(0, 65), std::invalid_argument);
+}
+
+// Bulk logical operations, population count, and set-bit search
+TEST_F(BitArrayListTest, BulkOperations)
+{
+    BitArrayList evens(200);
+    BitArrayList threes(200);
+    for (uint32_t i = 0; i < 200; ++i) {
+        evens[i] = i % 2 == 0;
+        threes[i] = i % 3 == 0;
+    }
+
+    BitArrayList sixes = evens & threes;
+    EXPECT_EQ(sixes.count(), 34U);
+    EXPECT_EQ((evens | threes).count(), 133U);
+    EXPECT_EQ((evens ^ threes).count(), 99U);
+    EXPECT_EQ((~evens).count(), 100U);
+
+    uint32_t seen = 0;
+    for (uint32_t i = sixes.findFirst(); i != BitArrayList::npos; i = sixes.findNext(i)) {
+        EXPECT_EQ(i % 6, 0U);
+        ++seen;
+    }
+    EXPECT_EQ(seen, 34U);
+
+    BitArrayList none(130);
+    EXPECT_EQ(none.findFirst(), BitArrayList::npos);
+    none.flip();
+    EXPECT_EQ(none.count(), 130U);
+    none.fill(false);
+    EXPECT_EQ(none.count(), 0U);
+    BitArrayList ones(70, true);
+    EXPECT_EQ(ones.count(), 70U);
+    EXPECT_EQ(ones.findNext(69), BitArrayList::npos);
+
+    EXPECT_THROW(evens &= none, std::invalid_argument);
+}
+
+// Iterators yield proxies and copies are deep
+TEST_F(BitArrayListTest, IteratorsAndCopies)
+{
+    BitArrayList a(100);
+    for (BitArrayList::reference bit : a)
+        bit = true;
+    EXPECT_EQ(a.count(), 100U);
+    EXPECT_EQ(a.end() - a.begin(), 100);
+    (*(a.begin() + 10)).flip();
+    EXPECT_FALSE(a[10]);
+
+    BitArrayList b(a);
+    b[0] = false;
+    EXPECT_TRUE(a[0]);
+    BitArrayList c(std::move(b));
+    EXPECT_TRUE(b.isEmpty());
+    EXPECT_EQ(c.count(), 98U);
+    a = c;
+    EXPECT_EQ(a.count(), 98U);
+    a.clear();
+    EXPECT_TRUE(a.isEmpty());
+}
+
+// The iterators are random access iterators the standard algorithms accept, with 64-bit distances
+TEST_F(BitArrayListTest, IteratorAlgorithms)
+{
+    using Traits = std::iterator_traits<BitArrayList::iterator>;
+    static_assert(std::is_same_v<Traits::iterator_category, std::random_access_iterator_tag>);
+    static_assert(std::is_same_v<Traits::difference_type, int64_t>);
+    static_assert(std::is_same_v<std::iterator_traits<BitArrayList::const_iterator>::value_type,
+                                 bool>);
+
+    BitArrayList b(200);
+    for (uint32_t i = 0; i < b.size(); i += 3)
+        b[i] = true;
+    EXPECT_EQ(std::count(b.begin(), b.end(), true), 67);
+    std::fill(b.begin() + 100, b.end(), true);
+    EXPECT_EQ(b.count(), 134U);
+
+    const BitArrayList& constant = b;
+    BitArrayList::const_iterator first = std::find(constant.begin(), constant.end(), false);
+    EXPECT_EQ(first - constant.begin(), 1);
+    EXPECT_EQ(std::count(constant.cbegin(), constant.cend(), false), 66);
+    BitArrayList::const_iterator converted = b.begin();
+    EXPECT_TRUE(converted == constant.begin());
+
+    BitArrayList::iterator it = b.begin();
+    it += 99;
+    EXPECT_TRUE(it[0]);
+    EXPECT_FALSE(it[-1]);
+    it[-1] = true;
+    EXPECT_TRUE(b[98]);
+    it -= 9;
+    EXPECT_TRUE(b.begin() < it && it <= b.begin() + 90 && b.end() > it);
+    EXPECT_EQ(*(10 + it), *(it + 10));
+
+    const int64_t far = 3000000000LL;
+    EXPECT_EQ((b.begin() + far) - b.begin(), far);
+    EXPECT_TRUE(b.begin() + far - far == b.begin());
+}
+
+} // Namespace
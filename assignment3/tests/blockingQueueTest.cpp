@@ -0,0 +1,93 @@
+// Author: Mac-Noble Brako-Kusi
+// File: blockingQueueTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the BlockingQueue template class
+
+#include "BlockingQueue.h"
+#include "MpmcQueue.h"
+#include "SpscQueue.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+// The fixture for testing BlockingQueue.
+class BlockingQueueTest : public ::testing::Test {
+};
+
+// A consumer sleeping on an empty queue wakes for a push, and for close()
+TEST_F(BlockingQueueTest, WaitsAndCloses)
+{
+    BlockingQueue<SpscQueue<int>> q(4);
+    std::atomic<int> got(0);
+    std::thread consumer([&]() {
+        int value;
+        while (q.pop(value))
+            got += value;
+        got += 100;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_TRUE(q.push(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(got.load(), 1);
+    q.close();
+    consumer.join();
+    EXPECT_EQ(got.load(), 101);
+    EXPECT_TRUE(q.isClosed());
+    EXPECT_FALSE(q.push(2));
+}
+
+// A producer waits for room, and closing keeps what was already pushed
+TEST_F(BlockingQueueTest, FullQueueAndDrain)
+{
+    BlockingQueue<MpmcQueue<int>> q(2);
+    int values[5] = {0, 1, 2, 3, 4};
+    std::thread producer([&]() {
+        EXPECT_EQ(q.pushBatch(values, 5), 5U);
+        q.close();
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(q.queue().size(), 2U);
+    int out[5] = {};
+    uint32_t popped = 0;
+    while (uint32_t n = q.popBatch(out + popped, 5 - popped))
+        popped += n;
+    producer.join();
+    ASSERT_EQ(popped, 5U);
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(out[i], i);
+    EXPECT_EQ(q.popBatch(out, 5), 0U);
+}
+
+// Many producers and consumers, with a queue small enough that both sides sleep
+TEST_F(BlockingQueueTest, ManyThreads)
+{
+    const uint32_t kThreads = 4;
+    const uint64_t kPerProducer = 50000;
+    BlockingQueue<MpmcQueue<uint64_t>> q(8);
+    std::atomic<uint64_t> sum(0);
+    std::vector<std::thread> producers;
+    std::vector<std::thread> consumers;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        producers.emplace_back([&q]() {
+            for (uint64_t i = 0; i < kPerProducer; ++i)
+                q.push(i);
+        });
+        consumers.emplace_back([&q, &sum]() {
+            uint64_t value;
+            while (q.pop(value))
+                sum += value;
+        });
+    }
+    for (std::thread& producer : producers)
+        producer.join();
+    q.close();
+    for (std::thread& consumer : consumers)
+        consumer.join();
+    EXPECT_EQ(sum.load(), kThreads * (kPerProducer * (kPerProducer - 1) / 2));
+}
+} // Namespace
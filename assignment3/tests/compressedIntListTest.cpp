@@ -0,0 +1,103 @@
+// Author: Mac-Noble Brako-Kusi
+// File: compressedIntListTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the CompressedIntList class
+
+#include "CompressedIntList.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace {
+// The fixture for testing CompressedIntList.
+class CompressedIntListTest : public ::testing::Test {
+protected:
+    // Checks every way of reading the list against the values it was built from
+    static void expectContents(const CompressedIntList& list, const std::vector<uint64_t>& values) {
+        ASSERT_EQ(list.size(), values.size());
+        for (uint32_t i = 0; i < values.size(); ++i) {
+            if (list.get(i) != values[i]) {
+                ADD_FAILURE() << "get(" << i << ") is " << list.get(i) << ", not " << values[i];
+                break;
+            }
+        }
+        std::vector<uint64_t> visited;
+        list.forEach([&visited](uint64_t value) {visited.push_back(value);});
+        EXPECT_EQ(visited, values);
+
+        ArrayList<uint64_t> array = list.toArrayList();
+        ASSERT_EQ(array.size(), values.size());
+        EXPECT_TRUE(std::equal(values.begin(), values.end(), array.data()));
+    }
+};
+
+// Sorted timestamps, clustered IDs, constants, full-width noise and a partial last block
+TEST_F(CompressedIntListTest, RoundTrips)
+{
+    std::mt19937_64 random(7);
+    std::vector<std::vector<uint64_t>> cases(5);
+    uint64_t time = 1700000000000000000ULL;
+    for (uint32_t i = 0; i < 3000; ++i) {
+        time += random() % 1000;
+        cases[0].push_back(time);
+        cases[1].push_back(500000 + random() % 4096);
+        cases[2].push_back(42);
+        cases[3].push_back(random());
+        cases[4].push_back(i % 7 == 0 ? UINT64_MAX : i);
+    }
+    for (const std::vector<uint64_t>& values : cases) {
+        CompressedIntList list;
+        for (uint64_t value : values)
+            list.add(value);
+        expectContents(list, values);
+    }
+    EXPECT_THROW(CompressedIntList().get(0), std::out_of_range);
+}
+
+// Every width from 0 to 64 bits, in both encodings
+TEST_F(CompressedIntListTest, EveryWidth)
+{
+    for (uint32_t width = 0; width <= 64; ++width) {
+        uint64_t top = width == 0 ? 0 : uint64_t(1) << (width - 1);
+        std::vector<uint64_t> reference;
+        std::vector<uint64_t> delta;
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < CompressedIntList::kBlockSize; ++i) {
+            reference.push_back(i % 2 == 0 ? 0 : top | (i % 3));
+            sum += i % 5 == 0 ? top : i % 2;
+            delta.push_back(sum);
+        }
+        expectContents(CompressedIntList(ArrayList<uint64_t>(0, 0)), {});
+        CompressedIntList list;
+        for (uint64_t value : reference)
+            list.add(value);
+        for (uint64_t value : delta)
+            list.add(value);
+        reference.insert(reference.end(), delta.begin(), delta.end());
+        expectContents(list, reference);
+    }
+}
+
+// Compressible data takes a fraction of its ArrayList size, and ranges decode across blocks
+TEST_F(CompressedIntListTest, FootprintAndDecode)
+{
+    ArrayList<uint64_t> ids;
+    for (uint64_t i = 0; i < 100000; ++i)
+        ids.add(1000000 + i * 3);
+    CompressedIntList list(ids);
+    EXPECT_LT(list.memoryFootprint() * 8, ids.size() * sizeof(uint64_t));
+
+    uint64_t out[600];
+    list.decode(99500, 500, out);
+    for (uint32_t i = 0; i < 500; ++i)
+        EXPECT_EQ(out[i], ids[99500 + i]);
+    list.decode(100, 600, out);
+    EXPECT_EQ(out[599], ids[699]);
+    EXPECT_THROW(list.decode(99999, 2, out), std::out_of_range);
+
+    list.clear();
+    EXPECT_TRUE(list.isEmpty());
+    list.add(5);
+    EXPECT_EQ(list[0], 5U);
+}
+} // Namespace
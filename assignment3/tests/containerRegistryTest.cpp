@@ -0,0 +1,109 @@
+// Author: Mac-Noble Brako-Kusi
+// File: containerRegistryTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for ContainerRegistry, built with ARRAYLIST_REGISTRY=1
+
+#include "ArrayList.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static_assert(ARRAYLIST_REGISTRY, "this test must be built with ARRAYLIST_REGISTRY=1");
+
+namespace {
+// The fixture for testing ContainerRegistry.
+class ContainerRegistryTest : public ::testing::Test {
+protected:
+    void TearDown() override {ContainerRegistry::setRssBudget(0);}
+
+    static const ContainerReport* find(const std::vector<ContainerReport>& reports,
+                                       const std::string& type, const std::string& site) {
+        for (const ContainerReport& report : reports) {
+            if (report.typeName == type && report.site == site)
+                return &report;
+        }
+        return nullptr;
+    }
+};
+
+// Live lists are reported by element type and site, and leave when destroyed
+TEST_F(ContainerRegistryTest, ReportsByTypeAndSite)
+{
+    size_t before = ContainerRegistry::size();
+    {
+        ContainerSite site("ingest");
+        ArrayList<int> a;
+        for (int i = 0; i < 5; ++i)
+            a.add(i);
+        ArrayList<int> b(a);
+        ArrayList<int> moved(std::move(b));
+        ArrayList<double> c(3, 1.0);
+        {
+            ContainerSite inner;
+            ArrayList<int> d(2);
+            std::string innerSite = std::string(__FILE__) + ":" + std::to_string(__LINE__ - 2);
+            EXPECT_EQ(ContainerRegistry::size(), before + 5);
+
+            std::vector<ContainerReport> reports = ContainerRegistry::report();
+            const ContainerReport* ints = find(reports, "ArrayList<int>", "ingest");
+            ASSERT_NE(ints, nullptr);
+            EXPECT_EQ(ints->containers, 3U); // a, b emptied by the move, and moved
+            EXPECT_EQ(ints->allocatedBytes, 2 * 8 * sizeof(int)); // A copy keeps the capacity
+            EXPECT_EQ(ints->unusedBytes(), 2 * 3 * sizeof(int));
+            ASSERT_NE(find(reports, "ArrayList<double>", "ingest"), nullptr);
+            ASSERT_NE(find(reports, "ArrayList<int>", innerSite), nullptr);
+        }
+
+        std::ostringstream out;
+        ContainerRegistry::dump(out);
+        EXPECT_NE(out.str().find("ArrayList<int> @ ingest: 3 containers, 64 bytes allocated, "
+                                 "24 unused\n"), std::string::npos);
+    }
+    EXPECT_EQ(ContainerRegistry::size(), before);
+
+    ArrayList<char> untagged;
+    EXPECT_NE(find(ContainerRegistry::report(), "ArrayList<char>", "untagged"), nullptr);
+}
+
+// Trimming releases the spare capacity of every list, and pressure triggers it
+TEST_F(ContainerRegistryTest, TrimUnderPressure)
+{
+    ArrayList<uint64_t> a;
+    for (uint64_t i = 0; i < 9; ++i)
+        a.add(i);
+    ArrayList<uint64_t> b(4);
+
+    ContainerRegistry::setRssBudget(0);
+    EXPECT_EQ(ContainerRegistry::checkPressure(), 0U);
+    size_t resident = ContainerRegistry::residentBytes();
+    EXPECT_GT(resident, 0U);
+    ContainerRegistry::setRssBudget(resident * 100);
+    EXPECT_EQ(ContainerRegistry::checkPressure(), 0U);
+    EXPECT_EQ(a.capacity(), 16U);
+
+    ContainerRegistry::setRssBudget(resident / 2);
+    EXPECT_GE(ContainerRegistry::checkPressure(), 7 * sizeof(uint64_t));
+    EXPECT_EQ(a.capacity(), 9U);
+    EXPECT_EQ(b.capacity(), 4U);
+    EXPECT_EQ(a[8], 8U);
+    EXPECT_EQ(ContainerRegistry::trim(), 0U);
+}
+
+// Trimming a list of lists creates and destroys the inner lists, which register themselves
+TEST_F(ContainerRegistryTest, TrimNestedLists)
+{
+    ArrayList<ArrayList<int>> outer;
+    for (int i = 0; i < 3; ++i)
+        outer.add(ArrayList<int>(3, i));
+    ASSERT_EQ(outer.capacity(), 4U);
+    size_t before = ContainerRegistry::size();
+
+    EXPECT_GE(ContainerRegistry::trim(), sizeof(ArrayList<int>));
+    EXPECT_EQ(outer.capacity(), 3U);
+    EXPECT_EQ(ContainerRegistry::size(), before - 1);
+    EXPECT_EQ(outer[2][2], 2);
+    EXPECT_NE(find(ContainerRegistry::report(), "ArrayList<ArrayList<int> >", "untagged"),
+              nullptr);
+}
+} // Namespace
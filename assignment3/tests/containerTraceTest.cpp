@@ -0,0 +1,94 @@
+// Author: Mac-Noble Brako-Kusi
+// File: containerTraceTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the container trace points, built with CONTAINER_TRACE=CONTAINER_TRACE_RING
+
+#include "ArrayList.h"
+#include "RadixSort.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static_assert(CONTAINER_TRACE == CONTAINER_TRACE_RING, "this test must be built with tracing on");
+
+namespace {
+// The fixture for testing the trace ring.
+class ContainerTraceTest : public ::testing::Test {
+protected:
+    void SetUp() override {TraceRing::clear();}
+
+    static uint32_t countOf(const std::vector<TraceEvent>& events, const std::string& name) {
+        uint32_t count = 0;
+        for (const TraceEvent& event : events)
+            count += name == event.name;
+        return count;
+    }
+};
+
+// The hot paths each record an event with their element count
+TEST_F(ContainerTraceTest, RecordsHotPaths)
+{
+    {
+        ArrayList<int> a;
+        for (int i = 0; i < 5; ++i)
+            a.add(i);                   // Resizes at sizes 0, 1, 2 and 4, freeing 3 buffers
+        a.add(0, 9);                    // Inserts, freeing 1 buffer
+        ArrayList<int> b(a);
+        ArrayList<int> c(std::move(b));
+        radixSort(c);
+        uint32_t indices[] = {0, 1};
+        int values[2];
+        c.gather(indices, 2, values);
+        c.scatter(indices, 2, values);
+    }                                   // Frees the buffers of a and c
+
+    std::vector<TraceEvent> events = TraceRing::events();
+    EXPECT_EQ(countOf(events, "arraylist_resize"), 4U);
+    EXPECT_EQ(countOf(events, "arraylist_insert"), 1U);
+    EXPECT_EQ(countOf(events, "arraylist_copy"), 1U);
+    EXPECT_EQ(countOf(events, "arraylist_move"), 1U);
+    EXPECT_EQ(countOf(events, "radix_sort"), 1U);
+    EXPECT_EQ(countOf(events, "arraylist_gather"), 1U);
+    EXPECT_EQ(countOf(events, "arraylist_scatter"), 1U);
+    EXPECT_EQ(countOf(events, "scopedarray_free"), 6U);
+
+    for (const TraceEvent& event : events) {
+        if (std::string(event.name) == "arraylist_copy") {
+            EXPECT_EQ(event.count, 6U);
+        }
+    }
+    for (size_t i = 1; i < events.size(); ++i)
+        EXPECT_LE(events[i - 1].startNanos + events[i - 1].durationNanos, TraceRing::nowNanos());
+}
+
+// The ring keeps the newest events, and the dump is Chrome trace-event JSON
+TEST_F(ContainerTraceTest, RingAndChromeDump)
+{
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]() {
+            for (uint32_t i = 0; i < CONTAINER_TRACE_RING_SIZE; ++i)
+                TraceRing::record("event", TraceRing::nowNanos(), 1500, i);
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    // A writer lapped by another while filling its slot loses its event
+    size_t kept = TraceRing::events().size();
+    EXPECT_LE(kept, size_t(CONTAINER_TRACE_RING_SIZE));
+    EXPECT_GE(kept, size_t(CONTAINER_TRACE_RING_SIZE) - threads.size());
+
+    TraceRing::clear();
+    TraceRing::record("arraylist_resize", 2000500, 1500, 42);
+    std::ostringstream out;
+    TraceRing::dumpChromeTrace(out);
+    std::string json = out.str();
+    EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0U);
+    EXPECT_NE(json.find("\"name\":\"arraylist_resize\",\"cat\":\"container\",\"ph\":\"X\","
+                        "\"ts\":2000.500,\"dur\":1.500,"), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"count\":42}}\n],\"displayTimeUnit\":\"ns\"}"),
+              std::string::npos);
+}
+} // Namespace
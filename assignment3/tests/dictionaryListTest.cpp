@@ -0,0 +1,160 @@
+// Author: Mac-Noble Brako-Kusi
+// File: dictionaryListTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the DictionaryList class
+
+#include "DictionaryList.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+// The fixture for testing DictionaryList.
+class DictionaryListTest : public ::testing::Test {
+protected:
+    // A column cycling through the provided number of distinct strings
+    static std::vector<std::string> column(uint32_t size, uint32_t distinct) {
+        std::vector<std::string> values;
+        for (uint32_t i = 0; i < size; ++i)
+            values.push_back("value-" + std::to_string((i * 7919U) % distinct));
+        return values;
+    }
+
+    // Checks every way of reading the list against the strings it was built from
+    static void expectContents(const DictionaryList& list, const std::vector<std::string>& values) {
+        ASSERT_EQ(list.size(), values.size());
+        for (uint32_t i = 0; i < values.size(); ++i) {
+            if (list.get(i) != values[i]) {
+                ADD_FAILURE() << "get(" << i << ") is " << list.get(i) << ", not " << values[i];
+                break;
+            }
+        }
+        ArrayList<std::string> array = list.toArrayList();
+        ASSERT_EQ(array.size(), values.size());
+        EXPECT_TRUE(std::equal(values.begin(), values.end(), array.data()));
+    }
+};
+
+// Repeated strings share one dictionary entry and one code
+TEST_F(DictionaryListTest, Deduplicates)
+{
+    DictionaryList list;
+    EXPECT_TRUE(list.isEmpty());
+    for (const char* value : {"red", "green", "red", "blue", "green", "red"})
+        list.add(value);
+
+    expectContents(list, {"red", "green", "red", "blue", "green", "red"});
+    EXPECT_EQ(list.dictionarySize(), 3U);
+    EXPECT_EQ(list.code(0), list.code(2));
+    EXPECT_EQ(list.codeOf("green"), list.code(4));
+    EXPECT_EQ(list.decode(list.codeOf("blue")), "blue");
+    EXPECT_EQ(list.codeOf("purple"), DictionaryList::npos);
+    EXPECT_EQ(list.codeBytes(), 1U);
+}
+
+// Codes widen to 16 and then 32 bits as the dictionary outgrows them
+TEST_F(DictionaryListTest, WidensCodes)
+{
+    std::vector<std::string> values = column(70000, 70000);
+    DictionaryList list;
+    for (uint32_t i = 0; i < values.size(); ++i) {
+        list.add(values[i]);
+        if (i == 255) {
+            EXPECT_EQ(list.codeBytes(), 1U);
+        }
+        if (i == 256 || i == 65535) {
+            EXPECT_EQ(list.codeBytes(), 2U);
+        }
+    }
+    EXPECT_EQ(list.codeBytes(), 4U);
+    EXPECT_EQ(list.dictionarySize(), 70000U);
+    expectContents(list, values);
+}
+
+// Equality filters find exactly the matching elements, and nothing for unknown strings
+TEST_F(DictionaryListTest, FiltersOnCodes)
+{
+    for (uint32_t distinct : {5U, 1000U}) {
+        std::vector<std::string> values = column(1000, distinct);
+        ArrayList<std::string> source;
+        for (const std::string& value : values)
+            source.add(value);
+        DictionaryList list(source);
+
+        BitArrayList matches = list.equals(values[3]);
+        ASSERT_EQ(matches.size(), values.size());
+        uint32_t expected = 0;
+        for (uint32_t i = 0; i < values.size(); ++i) {
+            EXPECT_EQ(matches.get(i), values[i] == values[3]);
+            expected += values[i] == values[3];
+        }
+        EXPECT_EQ(list.count(values[3]), expected);
+        EXPECT_EQ(matches.count(), expected);
+
+        EXPECT_EQ(list.count("missing"), 0U);
+        EXPECT_EQ(list.equals("missing").count(), 0U);
+        EXPECT_EQ(list.equals("missing").size(), values.size());
+    }
+}
+
+// set() replaces an element and keeps views of the old string valid
+TEST_F(DictionaryListTest, SetKeepsViewsValid)
+{
+    DictionaryList list;
+    list.add("alpha");
+    std::string_view alpha = list.get(0);
+    list.set(0, "beta");
+    for (uint32_t i = 0; i < 1000; ++i)
+        list.add("gamma-" + std::to_string(i));
+
+    EXPECT_EQ(list.get(0), "beta");
+    EXPECT_EQ(alpha, "alpha");
+    EXPECT_THROW(list.set(1001, "delta"), std::out_of_range);
+    EXPECT_THROW(list.get(1001), std::out_of_range);
+}
+
+// Copies are independent; a move leaves the source empty and usable
+TEST_F(DictionaryListTest, CopiesAndMoves)
+{
+    std::vector<std::string> values = column(500, 300);
+    DictionaryList list;
+    for (const std::string& value : values)
+        list.add(value);
+
+    DictionaryList copy(list);
+    copy.set(0, "changed");
+    expectContents(list, values);
+    EXPECT_EQ(copy.get(0), "changed");
+    EXPECT_EQ(copy.count(values[1]), list.count(values[1]));
+
+    DictionaryList assigned;
+    assigned = copy;
+    EXPECT_EQ(assigned.get(0), "changed");
+
+    DictionaryList moved(std::move(list));
+    expectContents(moved, values);
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.codeOf(values[0]), DictionaryList::npos);
+    list.add("again");
+    expectContents(list, {"again"});
+}
+
+// clear() drops the dictionary and goes back to 8-bit codes
+TEST_F(DictionaryListTest, Clears)
+{
+    std::vector<std::string> values = column(1000, 1000);
+    DictionaryList list;
+    for (const std::string& value : values)
+        list.add(value);
+    size_t full = list.memoryFootprint();
+    list.clear();
+
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.dictionarySize(), 0U);
+    EXPECT_EQ(list.codeBytes(), 1U);
+    EXPECT_LT(list.memoryFootprint(), full);
+    list.add("after");
+    expectContents(list, {"after"});
+}
+} // Namespace
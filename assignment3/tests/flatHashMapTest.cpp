@@ -0,0 +1,288 @@
+// Author: Mac-Noble Brako-Kusi
+// File: flatHashMapTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the FlatHashMap template class
+
+#include "FlatHashMap.h"
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace {
+// The fixture for testing FlatHashMap.
+class FlatHashMapTest : public ::testing::Test {
+};
+
+// Hashes and compares std::string and std::string_view keys without conversion
+struct StringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view key) const {
+        return std::hash<std::string_view>()(key);
+    }
+};
+
+struct StringEqual {
+    using is_transparent = void;
+    bool operator()(std::string_view lhs, std::string_view rhs) const {
+        return lhs == rhs;
+    }
+};
+
+// Insert, find and grow past many rehashes
+TEST_F(FlatHashMapTest, InsertAndFind)
+{
+    FlatHashMap<uint32_t, uint32_t> map;
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_EQ(map.find(1U), nullptr);
+
+    for (uint32_t i = 0; i < 100000; ++i)
+        EXPECT_TRUE(map.insert(i * 16, i));
+    EXPECT_FALSE(map.insert(16U, 0U));
+    EXPECT_EQ(map.size(), 100000U);
+    EXPECT_LE(map.size() * 8, map.capacity() * 7);
+
+    for (uint32_t i = 0; i < 100000; ++i) {
+        ASSERT_NE(map.find(i * 16), nullptr);
+        EXPECT_EQ(*map.find(i * 16), i);
+        EXPECT_FALSE(map.contains(i * 16 + 1));
+    }
+
+    EXPECT_FALSE(map.insertOrAssign(32U, 7U));
+    EXPECT_EQ(*map.find(32U), 7U);
+    map[5U] += 3;
+    EXPECT_EQ(map[5U], 3U);
+    EXPECT_EQ(map.size(), 100001U);
+}
+
+// Erasing shifts entries back and leaves no tombstones behind
+TEST_F(FlatHashMapTest, Erase)
+{
+    FlatHashMap<std::string, int> map;
+    for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < 1000; ++i)
+            map.insert(std::to_string(i), i);
+        for (int i = 0; i < 1000; i += 2)
+            EXPECT_TRUE(map.erase(std::to_string(i)));
+        EXPECT_EQ(map.size(), 500U);
+        for (int i = 0; i < 1000; ++i)
+            EXPECT_EQ(map.contains(std::to_string(i)), i % 2 == 1);
+        for (int i = 1; i < 1000; i += 2)
+            map.erase(std::to_string(i));
+        EXPECT_TRUE(map.isEmpty());
+    }
+    EXPECT_FALSE(map.erase("missing"));
+}
+
+// Reserving up front avoids rehashing
+TEST_F(FlatHashMapTest, Reserve)
+{
+    FlatHashMap<int, int> map(1000);
+    uint32_t capacity = map.capacity();
+    EXPECT_GE(capacity * 7, 1000U * 8);
+    for (int i = 0; i < 1000; ++i)
+        map.insert(i, -i);
+    EXPECT_EQ(map.capacity(), capacity);
+
+    long sum = 0;
+    map.forEach([&sum](const int& key, int& value) {
+        sum += key;
+        value = key;
+    });
+    EXPECT_EQ(sum, 999L * 1000 / 2);
+    EXPECT_EQ(*map.find(10), 10);
+
+    map.clear();
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_EQ(map.find(10), nullptr);
+}
+
+// Heterogeneous lookup with transparent functors
+TEST_F(FlatHashMapTest, HeterogeneousLookup)
+{
+    FlatHashMap<std::string, int, StringHash, StringEqual> map;
+    map.insert("status", 1);
+    map.insert("country", 2);
+
+    std::string_view key = "country";
+    ASSERT_NE(map.find(key), nullptr);
+    EXPECT_EQ(*map.find(key), 2);
+    EXPECT_EQ(map.find(std::string_view("nope")), nullptr);
+
+    const FlatHashMap<std::string, int, StringHash, StringEqual>& constMap = map;
+    EXPECT_EQ(*constMap.find(std::string_view("status")), 1);
+}
+
+// Copies and moves of a Counted throw once a shared budget runs out; a move empties its source
+struct Counted {
+    static int copiesLeft;
+
+    Counted() = default;
+    explicit Counted(int value) : value(value) {}
+    Counted(const Counted& other) : value(other.value) {spend();}
+    Counted(Counted&& other) : value(other.value) {
+        spend();
+        other.value = -1;
+    }
+
+    Counted& operator=(const Counted& other) {
+        spend();
+        value = other.value;
+        return *this;
+    }
+
+    Counted& operator=(Counted&& other) {
+        spend();
+        value = other.value;
+        other.value = -1;
+        return *this;
+    }
+
+    bool operator==(const Counted& other) const {return value == other.value;}
+
+    static void spend() {
+        if (copiesLeft-- <= 0)
+            throw std::runtime_error("copy failed");
+    }
+
+    int value = 0;
+};
+
+int Counted::copiesLeft = 1 << 30;
+
+struct CountedHash {
+    size_t operator()(const Counted& key) const {return static_cast<size_t>(key.value);}
+};
+
+// Sends runs of 128 consecutive keys to the same home slot
+struct ClusteredHash {
+    size_t operator()(int key) const {return static_cast<size_t>(key / 128);}
+};
+
+// A rehash that fails part way leaves every entry in place
+TEST_F(FlatHashMapTest, RehashStrongGuarantee)
+{
+    FlatHashMap<Counted, int, CountedHash> map;
+    for (int i = 0; i < 14; ++i)
+        map.insert(Counted(i), i * 10);
+    ASSERT_EQ(map.capacity(), 16U);
+
+    bool inserted = false;
+    for (int budget = 0; !inserted && budget < 100; ++budget) {
+        Counted::copiesLeft = budget;
+        try {
+            inserted = map.insert(Counted(14), 140);
+        } catch (const std::runtime_error&) {
+            Counted::copiesLeft = 1 << 30;
+            ASSERT_EQ(map.size(), 14U);
+            for (int i = 0; i < 14; ++i) {
+                ASSERT_NE(map.find(Counted(i)), nullptr);
+                EXPECT_EQ(*map.find(Counted(i)), i * 10);
+            }
+        }
+    }
+    Counted::copiesLeft = 1 << 30;
+    ASSERT_TRUE(inserted);
+    EXPECT_EQ(map.capacity(), 32U);
+    for (int i = 0; i < 15; ++i)
+        EXPECT_EQ(*map.find(Counted(i)), i * 10);
+}
+
+// Probe runs too long for the distance byte grow the table instead
+TEST_F(FlatHashMapTest, LongProbeRuns)
+{
+    FlatHashMap<int, int, ClusteredHash> map;
+    for (int i = 0; i < 8192; ++i)
+        map.insert(i, -i);
+    EXPECT_EQ(map.size(), 8192U);
+    for (int i = 0; i < 8192; ++i) {
+        ASSERT_NE(map.find(i), nullptr);
+        EXPECT_EQ(*map.find(i), -i);
+    }
+    for (int i = 0; i < 8192; i += 2)
+        EXPECT_TRUE(map.erase(i));
+    for (int i = 1; i < 8192; i += 2)
+        EXPECT_EQ(*map.find(i), -i);
+}
+
+// Counts the bytes held from the heap
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t held = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        held += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* memory, size_t bytes, size_t alignment) override {
+        held -= bytes;
+        std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Laid out like the map's slots
+struct Entry {
+    std::string key;
+    int value;
+};
+
+// Both arrays come from the map's resource, and assignment keeps the resource assigned to
+TEST_F(FlatHashMapTest, MemoryResource)
+{
+    CountingResource resource;
+    {
+        FlatHashMap<std::string, int> map(resource);
+        EXPECT_EQ(map.resource(), &resource);
+        for (int i = 0; i < 1000; ++i)
+            map.insert(std::to_string(i), i);
+        EXPECT_EQ(resource.held, map.capacity() * (sizeof(Entry) + 1));
+
+        FlatHashMap<std::string, int> copy(map);
+        EXPECT_EQ(copy.resource(), &resource);
+        EXPECT_EQ(resource.held, 2 * map.capacity() * (sizeof(Entry) + 1));
+
+        FlatHashMap<std::string, int> heap;
+        for (int i = 0; i < 100; ++i)
+            heap.insert(std::to_string(i), -i);
+
+        FlatHashMap<std::string, int> assigned(resource);
+        assigned = heap;
+        EXPECT_EQ(assigned.resource(), &resource);
+        EXPECT_EQ(heap.resource(), nullptr);
+        EXPECT_EQ(assigned.size(), 100U);
+        EXPECT_EQ(*assigned.find("99"), -99);
+
+        FlatHashMap<std::string, int> moved(resource);
+        moved = std::move(heap);
+        EXPECT_EQ(moved.resource(), &resource);
+        EXPECT_EQ(*moved.find("42"), -42);
+        EXPECT_TRUE(heap.isEmpty());
+        EXPECT_EQ(heap.resource(), nullptr);
+
+        // Between maps of the same resource, moving hands the arrays over
+        const int* value = copy.find("7");
+        assigned = std::move(copy);
+        EXPECT_EQ(assigned.find("7"), value);
+        EXPECT_EQ(assigned.resource(), &resource);
+        EXPECT_EQ(assigned.size(), 1000U);
+        EXPECT_TRUE(copy.isEmpty());
+        EXPECT_EQ(copy.resource(), &resource);
+
+        heap = assigned;
+        EXPECT_EQ(heap.resource(), nullptr);
+        EXPECT_EQ(*heap.find("7"), 7);
+        EXPECT_TRUE(heap.insert("1000", 1000));
+        EXPECT_EQ(heap.size(), 1001U);
+    }
+    EXPECT_EQ(resource.held, 0U);
+}
+
+} // Namespace
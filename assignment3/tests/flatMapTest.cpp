@@ -0,0 +1,153 @@
+// Author: Mac-Noble Brako-Kusi
+// File: flatMapTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the FlatMap template class
+
+#include "FlatMap.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+
+namespace {
+// The fixture for testing FlatMap.
+class FlatMapTest : public ::testing::Test {
+};
+
+// Building from unsorted entries keeps the last value of each key
+TEST_F(FlatMapTest, BuildFromUnsorted)
+{
+    ArrayList<std::string> keys;
+    ArrayList<int> values;
+    keys.add("us");
+    values.add(1);
+    keys.add("de");
+    values.add(2);
+    keys.add("us");
+    values.add(3);
+    keys.add("br");
+    values.add(4);
+
+    FlatMap<std::string, int> map(keys, values);
+    EXPECT_EQ(map.size(), 3U);
+    EXPECT_EQ(map.keyAt(0), "br");
+    EXPECT_EQ(map.at("us"), 3);
+    EXPECT_EQ(map.at("de"), 2);
+    EXPECT_EQ(map.find("fr"), nullptr);
+    EXPECT_THROW(map.at("fr"), std::out_of_range);
+
+    values.add(5);
+    EXPECT_THROW((FlatMap<std::string, int>(keys, values)), std::invalid_argument);
+}
+
+// Single insertions, assignments and erasures
+TEST_F(FlatMapTest, InsertAndErase)
+{
+    FlatMap<uint32_t, std::string> map;
+    EXPECT_TRUE(map.insert(5U, "five"));
+    EXPECT_TRUE(map.insert(1U, "one"));
+    EXPECT_FALSE(map.insert(5U, "FIVE"));
+    EXPECT_EQ(map.at(5U), "five");
+    EXPECT_FALSE(map.insertOrAssign(5U, "FIVE"));
+    EXPECT_EQ(map.at(5U), "FIVE");
+    EXPECT_TRUE(map.insertOrAssign(3U, "three"));
+    EXPECT_EQ(map.valueAt(1), "three");
+
+    *map.find(1U) = "uno";
+    EXPECT_EQ(map.at(1U), "uno");
+
+    EXPECT_TRUE(map.erase(3U));
+    EXPECT_FALSE(map.contains(3U));
+    EXPECT_EQ(map.size(), 2U);
+    EXPECT_EQ(map.valueAt(1), "FIVE");
+
+    map.clear();
+    EXPECT_TRUE(map.isEmpty());
+}
+
+// Batched insertion merges and lets the batch win on repeated keys
+TEST_F(FlatMapTest, BatchInsertAndRange)
+{
+    ArrayList<uint32_t> keys;
+    ArrayList<uint32_t> values;
+    for (uint32_t i = 0; i < 100; i += 2) {
+        keys.add(i);
+        values.add(i);
+    }
+    FlatMap<uint32_t, uint32_t> map(keys, values);
+
+    ArrayList<uint32_t> batchKeys;
+    ArrayList<uint32_t> batchValues;
+    for (uint32_t i = 150; i > 0; i -= 5) {
+        batchKeys.add(i);
+        batchValues.add(i * 10);
+    }
+    map.insert(batchKeys, batchValues);
+
+    for (uint32_t i = 0; i <= 150; ++i) {
+        if (i % 5 == 0 && i > 0)
+            EXPECT_EQ(map.at(i), i * 10);
+        else if (i % 2 == 0 && i < 100)
+            EXPECT_EQ(map.at(i), i);
+        else
+            EXPECT_FALSE(map.contains(i));
+    }
+
+    IndexRange range = map.range(100, 111);
+    EXPECT_EQ(range.size(), 3U);
+    EXPECT_EQ(map.keyAt(range.first), 100U);
+    EXPECT_EQ(map.valueAt(range.last - 1), 1100U);
+}
+
+// Copies of a Counted throw once a budget shared by every Counted runs out; it has no move
+struct Counted {
+    static int copiesLeft;
+
+    Counted() = default;
+    explicit Counted(int value) : value(value) {}
+    Counted(const Counted& other) : value(other.value) {spend();}
+
+    Counted& operator=(const Counted& other) {
+        spend();
+        value = other.value;
+        return *this;
+    }
+
+    bool operator<(const Counted& other) const {return value < other.value;}
+
+    static void spend() {
+        if (copiesLeft-- <= 0)
+            throw std::runtime_error("copy failed");
+    }
+
+    int value = 0;
+};
+
+int Counted::copiesLeft = 1 << 30;
+
+// A failed insertion leaves keys and values aligned, even when taking the value back out copies
+TEST_F(FlatMapTest, InsertStrongGuarantee)
+{
+    FlatMap<Counted, Counted> map;
+    for (int i = 0; i < 8; i += 2)
+        map.insert(Counted(i), Counted(i * 10));
+
+    bool inserted = false;
+    for (int budget = 0; !inserted && budget < 100; ++budget) {
+        Counted::copiesLeft = budget;
+        try {
+            inserted = map.insert(Counted(3), Counted(30));
+        } catch (const std::runtime_error&) {
+            Counted::copiesLeft = 1 << 30;
+            ASSERT_EQ(map.size(), 4U);
+            for (uint32_t i = 0; i < map.size(); ++i)
+                EXPECT_EQ(map.valueAt(i).value, map.keyAt(i).value * 10);
+        }
+    }
+    Counted::copiesLeft = 1 << 30;
+    ASSERT_TRUE(inserted);
+    EXPECT_EQ(map.size(), 5U);
+    EXPECT_EQ(map.at(Counted(3)).value, 30);
+    EXPECT_EQ(map.keyAt(2).value, 3);
+}
+
+} // Namespace
@@ -0,0 +1,100 @@
+// Author: Mac-Noble Brako-Kusi
+// File: flatSetTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the FlatSet template class
+
+#include "FlatSet.h"
+#include <gtest/gtest.h>
+#include <string>
+
+namespace {
+// The fixture for testing FlatSet.
+class FlatSetTest : public ::testing::Test {
+};
+
+// Building from unsorted keys sorts and deduplicates them once
+TEST_F(FlatSetTest, BuildFromUnsorted)
+{
+    ArrayList<uint32_t> keys;
+    for (uint32_t i = 0; i < 1000; ++i)
+        keys.add((i * 7919U) % 500U);
+
+    FlatSet<uint32_t> set(keys);
+    EXPECT_EQ(set.size(), 500U);
+    for (uint32_t i = 0; i < 500; ++i) {
+        EXPECT_EQ(set[i], i);
+        EXPECT_TRUE(set.contains(i));
+        EXPECT_EQ(set.find(i), i);
+    }
+    EXPECT_FALSE(set.contains(500U));
+    EXPECT_EQ(set.find(500U), set.size());
+}
+
+// Single insertions and erasures keep the keys sorted and unique
+TEST_F(FlatSetTest, InsertAndErase)
+{
+    FlatSet<std::string> set;
+    EXPECT_TRUE(set.isEmpty());
+    EXPECT_TRUE(set.insert("pear"));
+    EXPECT_TRUE(set.insert("apple"));
+    EXPECT_TRUE(set.insert("fig"));
+    EXPECT_FALSE(set.insert("apple"));
+    EXPECT_EQ(set.size(), 3U);
+    EXPECT_EQ(set[0], "apple");
+    EXPECT_EQ(set[1], "fig");
+    EXPECT_EQ(set[2], "pear");
+
+    EXPECT_TRUE(set.erase("fig"));
+    EXPECT_FALSE(set.erase("fig"));
+    EXPECT_EQ(set.size(), 2U);
+    EXPECT_EQ(set[1], "pear");
+
+    set.clear();
+    EXPECT_TRUE(set.isEmpty());
+}
+
+// Batched insertion merges instead of inserting one by one
+TEST_F(FlatSetTest, BatchInsert)
+{
+    ArrayList<int> evens;
+    for (int i = 0; i < 200; i += 2)
+        evens.add(i);
+    FlatSet<int> set(evens);
+
+    ArrayList<int> batch;
+    for (int i = 299; i >= 0; i -= 3)
+        batch.add(i);
+    batch.add(299);
+    set.insert(batch);
+
+    int previous = -1;
+    for (uint32_t i = 0; i < set.size(); ++i) {
+        EXPECT_LT(previous, set[i]);
+        previous = set[i];
+    }
+    for (int i = 0; i < 300; ++i)
+        EXPECT_EQ(set.contains(i), (i < 200 && i % 2 == 0) || i % 3 == 2) << i;
+}
+
+// Range queries return the positions of the keys in [low, high)
+TEST_F(FlatSetTest, Range)
+{
+    ArrayList<int> keys;
+    for (int i = 0; i < 100; i += 10)
+        keys.add(i);
+    FlatSet<int, std::greater<int>> descending(keys);
+    EXPECT_EQ(descending[0], 90);
+
+    FlatSet<int> set(keys);
+    IndexRange range = set.range(15, 55);
+    EXPECT_EQ(range.size(), 4U);
+    EXPECT_EQ(set[range.first], 20);
+    EXPECT_EQ(set[range.last - 1], 50);
+    EXPECT_EQ(set.range(55, 15).size(), 0U);
+    EXPECT_EQ(set.range(-5, 0).size(), 0U);
+    EXPECT_EQ(set.range(0, 1000).size(), 10U);
+    EXPECT_EQ(set.lowerBound(30), 3U);
+    EXPECT_EQ(set.upperBound(30), 4U);
+}
+
+} // Namespace
@@ -0,0 +1,84 @@
+// Author: Mac-Noble Brako-Kusi
+// File: generatorTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the Generator coroutine type, built as C++20
+
+#include "Generator.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+// The fixture for testing Generator.
+class GeneratorTest : public ::testing::Test {
+};
+
+Generator<int> upTo(int n, int& resumed) {
+    for (int i = 0; i < n; ++i) {
+        ++resumed;
+        co_yield i;
+    }
+}
+
+// The body runs only as far as the values asked for
+TEST_F(GeneratorTest, Lazy)
+{
+    int resumed = 0;
+    Generator<int> numbers = upTo(5, resumed);
+    EXPECT_EQ(resumed, 0);
+
+    std::vector<int> seen;
+    for (int value : numbers) {
+        seen.push_back(value);
+        if (value == 2)
+            break;
+    }
+    EXPECT_EQ(seen, std::vector<int>({0, 1, 2}));
+    EXPECT_EQ(resumed, 3);
+
+    int none = 0;
+    Generator<int> empty = upTo(0, none);
+    EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+Generator<std::string> refill(int count) {
+    std::string buffer;
+    for (int i = 0; i < count; ++i) {
+        buffer = "chunk " + std::to_string(i);
+        co_yield buffer;
+    }
+}
+
+// A yielded lvalue is the body's own object, which the consumer may move out of
+TEST_F(GeneratorTest, MoveOutYielded)
+{
+    Generator<std::string> chunks = refill(3);
+    Generator<std::string> moved(std::move(chunks));
+    std::vector<std::string> taken;
+    for (auto chunk = moved.begin(); chunk != moved.end(); ++chunk)
+        taken.push_back(std::move(*chunk));
+    EXPECT_EQ(taken, std::vector<std::string>({"chunk 0", "chunk 1", "chunk 2"}));
+}
+
+Generator<int> failAfter(int count) {
+    for (int i = 0; i < count; ++i)
+        co_yield i;
+    throw std::runtime_error("read failed");
+}
+
+// What the body throws leaves through the advance that resumed it, and ends the sequence
+TEST_F(GeneratorTest, Throws)
+{
+    Generator<int> numbers = failAfter(2);
+    auto it = numbers.begin();
+    EXPECT_EQ(*it, 0);
+    ++it;
+    EXPECT_EQ(*it, 1);
+    EXPECT_THROW(++it, std::runtime_error);
+    EXPECT_TRUE(it == numbers.end());
+
+    Generator<int> immediately = failAfter(0);
+    EXPECT_THROW(immediately.begin(), std::runtime_error);
+}
+} // Namespace
@@ -0,0 +1,78 @@
+// Author: Mac-Noble Brako-Kusi
+// File: hugePageResourceTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the HugePageResource class and resource-backed ArrayLists
+
+#include "ArrayList.h"
+#include "HugePageResource.h"
+#include <gtest/gtest.h>
+#include <string>
+
+namespace {
+// The fixture for testing HugePageResource.
+class HugePageResourceTest : public ::testing::Test {
+};
+
+// Buffers below the threshold come from the heap, larger ones are mapped on huge page boundaries
+TEST_F(HugePageResourceTest, Threshold)
+{
+    HugePageResource resource;
+    void* small = resource.allocate(1024, 8);
+    EXPECT_EQ(resource.mappedBytes(), 0U);
+
+    void* large = resource.allocate(3 << 20, 8);
+    EXPECT_EQ(resource.mappedBytes(), 4U << 20);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(large) % HugePageResource::kHugePageSize, 0U);
+    static_cast<char*>(large)[(3 << 20) - 1] = 'x';
+
+    resource.deallocate(large, 3 << 20, 8);
+    resource.deallocate(small, 1024, 8);
+    EXPECT_EQ(resource.mappedBytes(), 0U);
+
+    HugePageResource regular(HugePageOptions{HugePages::None, 4096, NumaPolicy::FirstTouch, 1});
+    void* pages = regular.allocate(5000, 8);
+    EXPECT_EQ(regular.mappedBytes(), 8192U);
+    regular.deallocate(pages, 5000, 8);
+}
+
+// An ArrayList given the resource allocates every buffer from it, and so do its copies
+TEST_F(HugePageResourceTest, ArrayListBuffers)
+{
+    HugePageResource resource(HugePageOptions{HugePages::Explicit, 1 << 16, NumaPolicy::Bind, 1});
+    {
+        ArrayList<uint64_t> a(resource);
+        EXPECT_EQ(a.resource(), &resource);
+        for (uint64_t i = 0; i < 1000000; ++i)
+            a.add(i);
+        EXPECT_GE(resource.mappedBytes(), 8000000U);
+
+        ArrayList<uint64_t> copy(a);
+        EXPECT_EQ(copy.resource(), &resource);
+        EXPECT_EQ(copy.remove(0), 0U);
+        EXPECT_EQ(copy[999998], 999999U);
+        for (uint64_t i = 0; i < 1000000; ++i)
+            ASSERT_EQ(a[i], i);
+
+        ArrayList<uint64_t> moved(std::move(a));
+        EXPECT_EQ(moved.resource(), &resource);
+        EXPECT_EQ(moved.size(), 1000000U);
+    }
+    EXPECT_EQ(resource.mappedBytes(), 0U);
+    EXPECT_EQ(ArrayList<int>().resource(), nullptr);
+}
+
+// Elements with non-trivial constructors and destructors are built and destroyed in place
+TEST_F(HugePageResourceTest, NonTrivialElements)
+{
+    HugePageResource resource(HugePageOptions{HugePages::Transparent, 0, NumaPolicy::Interleave, 1});
+    ArrayList<std::string> a(resource);
+    for (uint32_t i = 0; i < 100; ++i)
+        a.add(std::string(40, static_cast<char>('a' + i % 26)));
+    a.add(3, "three");
+    EXPECT_EQ(a[3], "three");
+    EXPECT_EQ(a[4], std::string(40, 'd'));
+    EXPECT_EQ(a.remove(0), std::string(40, 'a'));
+    a.clear();
+    EXPECT_EQ(resource.mappedBytes(), 0U);
+}
+} // Namespace
@@ -0,0 +1,193 @@
+// Author: Mac-Noble Brako-Kusi
+// File: incrementalArrayTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the IncrementalArrayList template class
+
+#include "IncrementalArrayList.h"
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <string>
+
+namespace {
+// The fixture for testing IncrementalArrayList.
+class IncrementalArrayListTest : public ::testing::Test {
+};
+
+// Reads are routed to the right buffer at every point of a migration
+TEST_F(IncrementalArrayListTest, ReadsDuringMigration)
+{
+    IncrementalArrayList<uint32_t> a(4);
+    for (uint32_t i = 0; i < 64; ++i)
+        a.add(i);
+    EXPECT_EQ(a.capacity(), 64U);
+    EXPECT_FALSE(a.isMigrating());
+
+    // Growing migrates only the first 4 elements; the other 60 are still in the old buffer
+    EXPECT_EQ(a.add(64), 128U);
+    EXPECT_TRUE(a.isMigrating());
+    for (uint32_t extra = 65; a.isMigrating(); ++extra) {
+        for (uint32_t i = 0; i < a.size(); ++i)
+            ASSERT_EQ(a[i], i);
+        a.add(extra);
+    }
+
+    EXPECT_EQ(a.size(), 80U);
+    for (uint32_t i = 0; i < a.size(); ++i)
+        EXPECT_EQ(a.get(i), i);
+    EXPECT_THROW(a.get(80), std::out_of_range);
+}
+
+// The migration ends before the new buffer fills, even with the smallest step
+TEST_F(IncrementalArrayListTest, MigrationFinishesBeforeFull)
+{
+    IncrementalArrayList<std::string> a(1);
+    for (uint32_t i = 0; i < 1000; ++i) {
+        if (a.size() == a.capacity()) {
+            EXPECT_FALSE(a.isMigrating());
+        }
+        a.add(std::to_string(i));
+    }
+    for (uint32_t i = 0; i < 1000; ++i)
+        EXPECT_EQ(a[i], std::to_string(i));
+
+    EXPECT_THROW(IncrementalArrayList<int>(0), std::invalid_argument);
+}
+
+// Writes, self-references and shifting operations work while elements are pending
+TEST_F(IncrementalArrayListTest, WritesDuringMigration)
+{
+    IncrementalArrayList<std::string> a(2);
+    for (uint32_t i = 0; i < 17; ++i)
+        a.add(std::to_string(i));
+    EXPECT_TRUE(a.isMigrating());
+
+    a.set(10, "ten");
+    a.get(11) = "eleven";
+    a.add(a[12]);
+    EXPECT_EQ(a[10], "ten");
+    EXPECT_EQ(a[11], "eleven");
+    EXPECT_EQ(a[17], "12");
+    EXPECT_THROW(a.set(18, "x"), std::out_of_range);
+
+    EXPECT_EQ(a.remove(0), "0");
+    EXPECT_FALSE(a.isMigrating());
+    EXPECT_EQ(a.size(), 17U);
+    EXPECT_EQ(a[9], "ten");
+
+    IncrementalArrayList<std::string> b(2);
+    for (uint32_t i = 0; i < 9; ++i)
+        b.add(std::to_string(i));
+    EXPECT_TRUE(b.isMigrating());
+    b.add(1, b[8]);
+    EXPECT_FALSE(b.isMigrating());
+    EXPECT_EQ(b.size(), 10U);
+    EXPECT_EQ(b[1], "8");
+    EXPECT_EQ(b[9], "8");
+    EXPECT_EQ(b[2], "1");
+}
+
+// Copies are flattened into a single buffer, moves carry the migration along
+TEST_F(IncrementalArrayListTest, CopyAndMove)
+{
+    IncrementalArrayList<int> a(1);
+    for (int i = 0; i < 40; ++i)
+        a.add(i);
+    EXPECT_TRUE(a.isMigrating());
+
+    IncrementalArrayList<int> copy(a);
+    EXPECT_FALSE(copy.isMigrating());
+    EXPECT_EQ(copy.size(), 40U);
+    EXPECT_EQ(copy.capacity(), 64U);
+    for (int i = 0; i < 40; ++i)
+        EXPECT_EQ(copy[i], i);
+
+    IncrementalArrayList<int> moved(std::move(a));
+    EXPECT_TRUE(moved.isMigrating());
+    EXPECT_TRUE(a.isEmpty());
+    moved.finishMigration();
+    EXPECT_FALSE(moved.isMigrating());
+    for (int i = 0; i < 40; ++i)
+        EXPECT_EQ(moved[i], i);
+
+    a = copy;
+    EXPECT_EQ(a.size(), 40U);
+    a.clear();
+    EXPECT_TRUE(a.isEmpty());
+    EXPECT_EQ(a.capacity(), 0U);
+}
+
+// Counts the live instances and default constructions of an element type
+struct Tracked {
+    static int live;
+    static int defaults;
+
+    Tracked() : value(0) {
+        ++live;
+        ++defaults;
+    }
+    explicit Tracked(int value) : value(value) {++live;}
+    Tracked(const Tracked& other) : value(other.value) {++live;}
+    Tracked& operator=(const Tracked& other) = default;
+    ~Tracked() {--live;}
+
+    int value;
+};
+
+int Tracked::live = 0;
+int Tracked::defaults = 0;
+
+// Counts the bytes held from the heap
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t held = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        held += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* memory, size_t bytes, size_t alignment) override {
+        held -= bytes;
+        std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Growing constructs no element up front, and every buffer comes from the list's resource
+TEST_F(IncrementalArrayListTest, RawBuffers)
+{
+    CountingResource resource;
+    {
+        IncrementalArrayList<Tracked> a(resource, 2);
+        for (int i = 0; i < 33; ++i)
+            a.add(Tracked(i));
+        EXPECT_TRUE(a.isMigrating());
+        EXPECT_EQ(Tracked::defaults, 0);
+        // The old buffer holds 32 elements, the new one the 2 migrated and the one added
+        EXPECT_EQ(Tracked::live, 32 + 3);
+        EXPECT_EQ(a.resource(), &resource);
+        EXPECT_EQ(a.memoryFootprint(), (64 + 32) * sizeof(Tracked));
+        EXPECT_EQ(resource.held, a.memoryFootprint());
+
+        IncrementalArrayList<Tracked> copy(a);
+        EXPECT_EQ(copy.resource(), &resource);
+        EXPECT_EQ(copy.memoryFootprint(), 64 * sizeof(Tracked));
+
+        a.finishMigration();
+        EXPECT_EQ(Tracked::live, 33 + 33);
+        EXPECT_EQ(resource.held, 2 * 64 * sizeof(Tracked));
+        a.add(40, Tracked(40));
+        EXPECT_EQ(Tracked::defaults, 7);
+        EXPECT_EQ(a[40].value, 40);
+        EXPECT_EQ(a.remove(0).value, 0);
+        EXPECT_EQ(a[0].value, 1);
+        EXPECT_EQ(Tracked::live, 40 + 33);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+    EXPECT_EQ(resource.held, 0U);
+}
+} // Namespace
@@ -0,0 +1,134 @@
+// Author: Mac-Noble Brako-Kusi
+// File: ingestPipelineTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the ingestFile pipeline
+
+#include "IngestPipeline.h"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <system_error>
+#include <unistd.h>
+
+namespace {
+// The fixture for testing ingestFile: a temporary file, removed after each test.
+class IngestPipelineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char name[] = "/tmp/ingestPipelineTestXXXXXX";
+        int descriptor = mkstemp(name);
+        ASSERT_GE(descriptor, 0);
+        close(descriptor);
+        mPath = name;
+    }
+
+    void TearDown() override {std::remove(mPath.c_str());}
+
+    void write(const std::string& contents) {
+        FILE* file = std::fopen(mPath.c_str(), "wb");
+        ASSERT_NE(file, nullptr);
+        std::fwrite(contents.data(), 1, contents.size(), file);
+        std::fclose(file);
+    }
+
+    std::string mPath;
+};
+
+// Parses one integer per line
+void parseLines(const char* begin, const char* end, ArrayList<long>& out) {
+    std::string text(begin, end);
+    const char* cursor = text.c_str();
+    char* next;
+    for (long value = std::strtol(cursor, &next, 10); next != cursor;
+         value = std::strtol(cursor, &next, 10)) {
+        out.add(value);
+        cursor = next;
+    }
+}
+
+// Small chunks, few buffers and several parsers still append every record in file order
+TEST_F(IngestPipelineTest, KeepsFileOrder)
+{
+    std::string contents;
+    for (long i = 0; i < 20000; ++i)
+        contents += std::to_string(i * 7) + "\n";
+    write(contents);
+
+    IngestOptions options;
+    options.chunkBytes = 100;
+    options.inFlightChunks = 3;
+    options.parseThreads = 4;
+    ArrayList<long> list;
+    list.add(-1);
+    IngestStats stats = ingestFile(mPath, list, parseLines, options);
+    EXPECT_EQ(stats.bytesRead, contents.size());
+    EXPECT_EQ(stats.elements, 20000U);
+    EXPECT_GT(stats.chunks, 100U);
+    ASSERT_EQ(list.size(), 20001U);
+    EXPECT_EQ(list[0], -1);
+    for (uint32_t i = 1; i < list.size(); ++i) {
+        if (list[i] != long(i - 1) * 7) {
+            ADD_FAILURE() << "element " << i << " is " << list[i];
+            break;
+        }
+    }
+}
+
+// A record longer than a chunk stays whole, and the last record needs no delimiter
+TEST_F(IngestPipelineTest, ChunkBoundaries)
+{
+    std::string longRecord(50, '1');
+    write("12\n" + longRecord + "\n34\n5");
+    IngestOptions options;
+    options.chunkBytes = 8;
+    options.inFlightChunks = 1;
+    options.parseThreads = 1;
+    ArrayList<std::string> records;
+    ingestFile(mPath, records, [](const char* begin, const char* end, ArrayList<std::string>& out) {
+        const char* start = begin;
+        for (const char* c = begin; c < end; ++c) {
+            if (*c == '\n') {
+                out.add(std::string(start, c));
+                start = c + 1;
+            }
+        }
+        if (start < end)
+            out.add(std::string(start, end));
+    }, options);
+    ASSERT_EQ(records.size(), 4U);
+    EXPECT_EQ(records[0], "12");
+    EXPECT_EQ(records[1], longRecord);
+    EXPECT_EQ(records[2], "34");
+    EXPECT_EQ(records[3], "5");
+
+    write("");
+    ArrayList<long> empty;
+    EXPECT_EQ(ingestFile(mPath, empty, parseLines).chunks, 0U);
+    EXPECT_TRUE(empty.isEmpty());
+}
+
+// A missing file and a failing parser are reported to the caller
+TEST_F(IngestPipelineTest, Errors)
+{
+    ArrayList<long> list;
+    EXPECT_THROW(ingestFile(mPath + ".missing", list, parseLines), std::system_error);
+
+    std::string contents;
+    for (int i = 0; i < 1000; ++i)
+        contents += i == 500 ? "bad\n" : "1\n";
+    write(contents);
+    IngestOptions options;
+    options.chunkBytes = 64;
+    options.inFlightChunks = 2;
+    auto strict = [](const char* begin, const char* end, ArrayList<long>& out) {
+        if (std::string(begin, end).find("bad") != std::string::npos)
+            throw std::invalid_argument("bad record");
+        parseLines(begin, end, out);
+    };
+    EXPECT_THROW(ingestFile(mPath, list, strict, options), std::invalid_argument);
+    EXPECT_LT(list.size(), 500U);
+    for (uint32_t i = 0; i < list.size(); ++i)
+        EXPECT_EQ(list[i], 1);
+}
+} // Namespace
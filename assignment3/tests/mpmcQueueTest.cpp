@@ -0,0 +1,114 @@
+// Author: Mac-Noble Brako-Kusi
+// File: mpmcQueueTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the MpmcQueue template class
+
+#include "MpmcQueue.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+// The fixture for testing MpmcQueue.
+class MpmcQueueTest : public ::testing::Test {
+};
+
+// Elements come out in order, and pushes fail only when the ring is full
+TEST_F(MpmcQueueTest, FifoAndBounds)
+{
+    EXPECT_THROW(MpmcQueue<int>(0), std::invalid_argument);
+    MpmcQueue<std::string> q(4);
+    EXPECT_EQ(q.capacity(), 4U);
+
+    std::string out;
+    EXPECT_FALSE(q.tryPop(out));
+    for (int lap = 0; lap < 3; ++lap) {
+        for (int i = 0; i < 4; ++i)
+            EXPECT_TRUE(q.tryPush(std::to_string(lap * 4 + i)));
+        EXPECT_FALSE(q.tryPush("full"));
+        EXPECT_EQ(q.size(), 4U);
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(q.tryPop(out));
+            EXPECT_EQ(out, std::to_string(lap * 4 + i));
+        }
+        EXPECT_TRUE(q.isEmpty());
+    }
+}
+
+// A batch that does not fit, or is not all ready, is cut to a run that is
+TEST_F(MpmcQueueTest, Batches)
+{
+    MpmcQueue<int> q(8);
+    int values[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    EXPECT_EQ(q.tryPushBatch(values, 6), 6U);
+    EXPECT_EQ(q.tryPushBatch(values + 6, 2), 2U);
+    EXPECT_EQ(q.tryPushBatch(values, 1), 0U);
+
+    int out[8] = {};
+    EXPECT_EQ(q.tryPopBatch(out, 3), 3U);
+    EXPECT_EQ(q.tryPushBatch(values, 8), 2U);
+    // Seven are ready, so the run is halved to four
+    EXPECT_EQ(q.tryPopBatch(out + 3, 8), 4U);
+    EXPECT_EQ(q.tryPopBatch(out + 7, 1), 1U);
+    for (int i = 0; i < 8; ++i)
+        EXPECT_EQ(out[i], i);
+    EXPECT_EQ(q.size(), 2U);
+}
+
+// Every message of every producer reaches exactly one consumer, in its producer's order
+TEST_F(MpmcQueueTest, Threads)
+{
+    const uint32_t kThreads = 4;
+    const uint64_t kPerProducer = 200000;
+    MpmcQueue<uint64_t> q(128);
+    std::vector<std::thread> threads;
+    for (uint64_t p = 0; p < kThreads; ++p) {
+        threads.emplace_back([&q, p]() {
+            uint64_t batch[8];
+            for (uint64_t i = 0; i < kPerProducer; ) {
+                for (uint32_t b = 0; b < 8; ++b)
+                    batch[b] = (p << 32) | (i + b);
+                uint32_t pushed = q.tryPushBatch(batch, static_cast<uint32_t>(
+                    std::min<uint64_t>(8, kPerProducer - i)));
+                if (pushed == 0)
+                    std::this_thread::yield();
+                i += pushed;
+            }
+        });
+    }
+
+    std::atomic<uint64_t> received(0);
+    std::atomic<uint64_t> sum(0);
+    std::atomic<bool> ordered(true);
+    for (uint32_t c = 0; c < kThreads; ++c) {
+        threads.emplace_back([&]() {
+            std::vector<uint64_t> last(kThreads, 0);
+            std::vector<bool> seen(kThreads, false);
+            uint64_t value;
+            while (received.load() < kThreads * kPerProducer) {
+                if (!q.tryPop(value)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                uint64_t producer = value >> 32;
+                uint64_t sequence = value & 0xFFFFFFFF;
+                if (seen[producer] && sequence <= last[producer])
+                    ordered = false;
+                seen[producer] = true;
+                last[producer] = sequence;
+                sum += sequence;
+                ++received;
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(received.load(), kThreads * kPerProducer);
+    EXPECT_EQ(sum.load(), kThreads * (kPerProducer * (kPerProducer - 1) / 2));
+    EXPECT_TRUE(q.isEmpty());
+}
+} // Namespace
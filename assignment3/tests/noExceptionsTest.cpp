@@ -0,0 +1,63 @@
+// Author: Mac-Noble Brako-Kusi
+// File: noExceptionsTest.cpp
+// Date: October 19, 2026
+// Purpose: Builds every container with -fno-exceptions and checks how errors are reported there
+
+#include "ArrayList.h"
+#include "BitArrayList.h"
+#include "FlatHashMap.h"
+#include "FlatMap.h"
+#include "FlatSet.h"
+#include "HugePageResource.h"
+#include "IncrementalArrayList.h"
+#include "PersistentArrayList.h"
+#include "PoolResource.h"
+#include "SoAArrayList.h"
+#include "StaticArrayList.h"
+#include <gtest/gtest.h>
+
+static_assert(!CONTAINER_EXCEPTIONS, "this test must be compiled with -fno-exceptions");
+
+namespace {
+// The fixture for testing the containers without exceptions.
+class NoExceptionsTest : public ::testing::Test {
+};
+
+// The try* accessors work without exceptions
+TEST_F(NoExceptionsTest, TryAccessors)
+{
+    ArrayList<int> a;
+    for (int i = 0; i < 10; ++i)
+        a.add(i);
+    EXPECT_EQ(*a.tryGet(9), 9);
+    EXPECT_EQ(a.tryGet(10), nullptr);
+    EXPECT_TRUE(a.trySet(9, 90));
+    EXPECT_FALSE(a.trySet(10, 100));
+    int removed = 0;
+    EXPECT_TRUE(a.tryRemove(9, removed));
+    EXPECT_EQ(removed, 90);
+    EXPECT_FALSE(a.tryRemove(9));
+
+    FlatMap<int, int> map;
+    EXPECT_TRUE(map.insert(1, 10));
+    EXPECT_EQ(*map.find(1), 10);
+}
+
+// Errors that would have been thrown abort with the exception's message
+TEST_F(NoExceptionsTest, ErrorsAbort)
+{
+    ArrayList<int> a(3, 1);
+    EXPECT_DEATH(a.get(3), "container error: 3");
+    EXPECT_DEATH(a.remove(5), "container error: 5");
+
+    BitArrayList bits(4);
+    EXPECT_DEATH(bits.addWord(0, 65), "count must not exceed 64");
+
+    FlatMap<int, int> map;
+    EXPECT_DEATH(map.at(1), "key not found");
+
+    StaticArrayList<int, 2> fixed(2);
+    EXPECT_FALSE(fixed.tryAdd(3));
+    EXPECT_DEATH(fixed.add(3), "StaticArrayList capacity exceeded");
+}
+} // Namespace
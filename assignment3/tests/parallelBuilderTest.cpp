@@ -0,0 +1,154 @@
+// Author: Mac-Noble Brako-Kusi
+// File: parallelBuilderTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the ParallelBuilder and SegmentedView template classes
+
+#include "ParallelBuilder.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+// The fixture for testing ParallelBuilder.
+class ParallelBuilderTest : public ::testing::Test {
+};
+
+// Numbered chunks are concatenated in worker order, and building empties the builder
+TEST_F(ParallelBuilderTest, NumberedChunks)
+{
+    const uint32_t kWorkers = 4;
+    const uint32_t kPerWorker = 50000;
+    ParallelBuilder<uint32_t> builder(kWorkers);
+    EXPECT_THROW(builder.chunk(kWorkers), std::out_of_range);
+
+    std::vector<std::thread> threads;
+    for (uint32_t w = 0; w < kWorkers; ++w) {
+        threads.emplace_back([&builder, w]() {
+            ArrayList<uint32_t>& chunk = builder.chunk(w);
+            for (uint32_t i = 0; i < kPerWorker; ++i)
+                chunk.add(w * kPerWorker + i);
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    EXPECT_EQ(builder.size(), uint64_t(kWorkers) * kPerWorker);
+
+    ArrayList<uint32_t> list = builder.build(3);
+    ASSERT_EQ(list.size(), kWorkers * kPerWorker);
+    for (uint32_t i = 0; i < list.size(); ++i) {
+        if (list[i] != i) {
+            ADD_FAILURE() << "element " << i << " is " << list[i];
+            break;
+        }
+    }
+    EXPECT_EQ(builder.size(), 0U);
+    EXPECT_TRUE(builder.build().isEmpty());
+}
+
+// Each thread gets one chunk from local(), however often it asks, and keeps it across builds
+TEST_F(ParallelBuilderTest, LocalChunks)
+{
+    ParallelBuilder<std::string> builder(1);
+    builder.chunk(0).add("first");
+    ArrayList<std::string>* mine = &builder.local();
+    EXPECT_EQ(&builder.local(), mine);
+    builder.local().add("main");
+
+    std::thread other([&builder]() {
+        builder.local().add("other");
+        builder.local().add("other");
+    });
+    other.join();
+
+    ArrayList<std::string> list = builder.build();
+    ASSERT_EQ(list.size(), 4U);
+    EXPECT_EQ(list[0], "first");
+    EXPECT_EQ(list[1], "main");
+    EXPECT_EQ(list[2], "other");
+    EXPECT_EQ(list[3], "other");
+
+    EXPECT_EQ(&builder.local(), mine);
+    builder.local().add("again");
+    ASSERT_EQ(builder.build().size(), 1U);
+
+    // A builder made after another is destroyed never sees the old one's cached chunk
+    ParallelBuilder<std::string> next;
+    next.local().add("next");
+    EXPECT_EQ(next.build()[0], "next");
+}
+
+// A view indexes across its segments without copying, and flattens to the same contents
+TEST_F(ParallelBuilderTest, SegmentedView)
+{
+    ParallelBuilder<int> builder(3);
+    for (int i = 0; i < 5; ++i)
+        builder.chunk(0).add(i);
+    for (int i = 5; i < 7; ++i)
+        builder.chunk(2).add(i);
+    const int* first = builder.chunk(0).data();
+
+    SegmentedView<int> view = builder.view();
+    EXPECT_EQ(builder.size(), 0U);
+    ASSERT_EQ(view.size(), 7U);
+    EXPECT_EQ(view.segments(), 2U);
+    EXPECT_EQ(view.segment(0).data(), first);
+    for (int i = 0; i < 7; ++i)
+        EXPECT_EQ(view.get(i), i);
+    EXPECT_EQ(view[6], 6);
+    EXPECT_THROW(view.get(7), std::out_of_range);
+
+    ArrayList<int> flat = view.flatten(4);
+    ASSERT_EQ(flat.size(), 7U);
+    for (int i = 0; i < 7; ++i)
+        EXPECT_EQ(flat[i], i);
+    EXPECT_EQ(view.size(), 7U);
+
+    SegmentedView<int> empty;
+    EXPECT_TRUE(empty.isEmpty());
+    EXPECT_THROW(empty.get(0), std::out_of_range);
+    EXPECT_TRUE(empty.flatten().isEmpty());
+}
+
+// Assigning the element numbered 'failAt' throws; with no move of its own, building must copy it
+struct Fragile {
+    static int failAt;
+
+    Fragile() = default;
+    explicit Fragile(int value) : value(value) {}
+    Fragile(const Fragile& other) = default;
+
+    Fragile& operator=(const Fragile& other) {
+        if (other.value == failAt)
+            throw std::runtime_error("copy failed");
+        value = other.value;
+        return *this;
+    }
+
+    int value = 0;
+};
+
+int Fragile::failAt = -1;
+
+// A throwing copy on a worker thread reaches the caller, and a failed build keeps every chunk
+TEST_F(ParallelBuilderTest, ThrowingCopy)
+{
+    const int kPerChunk = 100000;
+    ParallelBuilder<Fragile> builder(2);
+    for (int i = 0; i < 2 * kPerChunk; ++i)
+        builder.chunk(i / kPerChunk).add(Fragile(i));
+
+    Fragile::failAt = 2 * kPerChunk - 1;
+    EXPECT_THROW(builder.build(2), std::runtime_error);
+    ASSERT_EQ(builder.size(), uint64_t(2) * kPerChunk);
+    EXPECT_EQ(builder.chunk(1)[kPerChunk - 1].value, 2 * kPerChunk - 1);
+
+    SegmentedView<Fragile> view = builder.view();
+    EXPECT_THROW(view.flatten(2), std::runtime_error);
+    Fragile::failAt = -1;
+    ArrayList<Fragile> flat = view.flatten(2);
+    ASSERT_EQ(flat.size(), uint32_t(2 * kPerChunk));
+    EXPECT_EQ(flat[2 * kPerChunk - 1].value, 2 * kPerChunk - 1);
+}
+} // Namespace
@@ -0,0 +1,150 @@
+// Author: Mac-Noble Brako-Kusi
+// File: persistentArrayTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the PersistentArrayList template class
+
+#include "PersistentArrayList.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <type_traits>
+
+namespace {
+// The fixture for testing PersistentArrayList.
+class PersistentArrayListTest : public ::testing::Test {
+};
+
+// Versions built by add share structure but never change once created
+TEST_F(PersistentArrayListTest, AddKeepsOldVersions)
+{
+    PersistentArrayList<uint32_t> empty;
+    EXPECT_TRUE(empty.isEmpty());
+
+    PersistentArrayList<uint32_t> versions[2000];
+    PersistentArrayList<uint32_t> current;
+    for (uint32_t i = 0; i < 2000; ++i) {
+        versions[i] = current;
+        current = current.add(i);
+    }
+
+    EXPECT_EQ(current.size(), 2000U);
+    for (uint32_t i = 0; i < 2000; ++i)
+        EXPECT_EQ(current[i], i);
+
+    // Every snapshot still sees exactly the elements it was taken with
+    for (uint32_t v = 0; v < 2000; v += 97) {
+        EXPECT_EQ(versions[v].size(), v);
+        for (uint32_t i = 0; i < v; ++i)
+            EXPECT_EQ(versions[v].get(i), i);
+    }
+    EXPECT_TRUE(empty.isEmpty());
+}
+
+// Set and remove produce new versions
+TEST_F(PersistentArrayListTest, SetAndRemove)
+{
+    PersistentArrayList<uint32_t> a;
+    for (uint32_t i = 0; i < 1100; ++i)
+        a = a.add(i);
+
+    PersistentArrayList<uint32_t> b = a.set(5, 500U).set(1099, 7U).set(1050, 8U);
+    EXPECT_EQ(a[5], 5U);
+    EXPECT_EQ(a[1099], 1099U);
+    EXPECT_EQ(b[5], 500U);
+    EXPECT_EQ(b[1099], 7U);
+    EXPECT_EQ(b[1050], 8U);
+
+    PersistentArrayList<uint32_t> c = a;
+    for (uint32_t i = 0; i < 1100; ++i)
+        c = c.removeLast();
+    EXPECT_TRUE(c.isEmpty());
+    EXPECT_EQ(a.size(), 1100U);
+    for (uint32_t i = 0; i < 1100; ++i)
+        EXPECT_EQ(a[i], i);
+
+    PersistentArrayList<uint32_t> d = a.remove(10);
+    EXPECT_EQ(d.size(), 1099U);
+    EXPECT_EQ(d[9], 9U);
+    EXPECT_EQ(d[10], 11U);
+    EXPECT_EQ(d[1098], 1099U);
+
+    PersistentArrayList<uint32_t> e = a.add(10, 12345U);
+    EXPECT_EQ(e.size(), 1101U);
+    EXPECT_EQ(e[10], 12345U);
+    EXPECT_EQ(e[11], 10U);
+    EXPECT_EQ(e[1100], 1099U);
+
+    EXPECT_THROW(a.get(1100), std::out_of_range);
+    EXPECT_THROW(a.set(1100, 0U), std::out_of_range);
+    EXPECT_THROW(a.remove(1100), std::out_of_range);
+    EXPECT_THROW(PersistentArrayList<uint32_t>().removeLast(), std::out_of_range);
+}
+
+// Transient edits are not visible to the version they started from
+TEST_F(PersistentArrayListTest, Transient)
+{
+    PersistentArrayList<std::string> base;
+    base = base.add("a").add("b");
+
+    PersistentArrayList<std::string>::Transient edit = base.transient();
+    for (uint32_t i = 0; i < 5000; ++i)
+        edit.add(std::to_string(i));
+    edit.set(0, "z");
+    edit.removeLast();
+    PersistentArrayList<std::string> built = edit.persistent();
+
+    EXPECT_EQ(base.size(), 2U);
+    EXPECT_EQ(base[0], "a");
+    EXPECT_EQ(built.size(), 5001U);
+    EXPECT_EQ(built[0], "z");
+    EXPECT_EQ(built[1], "b");
+    EXPECT_EQ(built[5000], "4998");
+    EXPECT_THROW(edit.add("x"), std::logic_error);
+
+    // A frozen version is shared, so editing it again must copy
+    PersistentArrayList<std::string>::Transient again = built.transient();
+    again.set(4000, "changed");
+    EXPECT_EQ(built[4000], "3998");
+    EXPECT_EQ(again.persistent()[4000], "changed");
+}
+
+// A transient is move-only, so nothing can edit a version once it is frozen
+TEST_F(PersistentArrayListTest, FrozenVersionNeverChanges)
+{
+    static_assert(!std::is_copy_constructible<PersistentArrayList<int>::Transient>::value, "");
+    static_assert(!std::is_copy_assignable<PersistentArrayList<int>::Transient>::value, "");
+
+    PersistentArrayList<int>::Transient edit = PersistentArrayList<int>().transient();
+    for (int i = 0; i < 100; ++i)
+        edit.add(i);
+    PersistentArrayList<int>::Transient moved(std::move(edit));
+    EXPECT_THROW(edit.add(0), std::logic_error);
+
+    PersistentArrayList<int> frozen = moved.persistent();
+    EXPECT_THROW(moved.set(5, -1), std::logic_error);
+    EXPECT_THROW(moved.removeLast(), std::logic_error);
+
+    PersistentArrayList<int>::Transient reassigned = frozen.transient();
+    reassigned = std::move(moved);
+    EXPECT_THROW(reassigned.set(5, -1), std::logic_error);
+    EXPECT_EQ(frozen.size(), 100U);
+    EXPECT_EQ(frozen[5], 5);
+}
+
+// Conversions to and from ArrayList
+TEST_F(PersistentArrayListTest, ArrayListConversion)
+{
+    ArrayList<long> src(3000, 7L);
+    src[2999] = 9L;
+    PersistentArrayList<long> a(src);
+    EXPECT_EQ(a.size(), 3000U);
+    EXPECT_EQ(a[0], 7L);
+    EXPECT_EQ(a[2999], 9L);
+
+    ArrayList<long> back = a.set(100, 1L).toArrayList();
+    EXPECT_EQ(back.size(), 3000U);
+    EXPECT_EQ(back[100], 1L);
+    EXPECT_EQ(back[2999], 9L);
+    EXPECT_EQ(src[100], 7L);
+}
+
+} // Namespace
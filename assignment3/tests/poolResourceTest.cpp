@@ -0,0 +1,206 @@
+// Author: Mac-Noble Brako-Kusi
+// File: poolResourceTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the PoolResource class
+
+#include "ArrayList.h"
+#include "IncrementalArrayList.h"
+#include "PoolResource.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+// The fixture for testing PoolResource.
+class PoolResourceTest : public ::testing::Test {
+};
+
+// Requests are rounded up to power-of-two classes
+TEST_F(PoolResourceTest, SizeClasses)
+{
+    EXPECT_EQ(PoolResource::blockSize(0), 64U);
+    EXPECT_EQ(PoolResource::blockSize(64), 64U);
+    EXPECT_EQ(PoolResource::blockSize(65), 128U);
+    EXPECT_EQ(PoolResource::blockSize(4096), 4096U);
+    EXPECT_EQ(PoolResource::blockSize(5000), 8192U);
+
+    PoolResource pool;
+    void* a = pool.allocate(100, 8);
+    pool.deallocate(a, 100, 8);
+    void* b = pool.allocate(120, 8);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % PoolResource::kBlockAlignment, 0U);
+    pool.deallocate(b, 120, 8);
+    EXPECT_EQ(pool.upstreamAllocations(), 1U);
+
+    void* overAligned = pool.allocate(64, 128);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(overAligned) % 128, 0U);
+    pool.deallocate(overAligned, 64, 128);
+}
+
+// The buffers released by one growing list are reused by the next one
+TEST_F(PoolResourceTest, ArrayListReuse)
+{
+    PoolResource pool;
+    {
+        ArrayList<uint64_t> a(pool);
+        for (uint64_t i = 0; i < 100000; ++i)
+            a.add(i);
+    }
+    uint64_t upstream = pool.upstreamAllocations();
+    EXPECT_GT(upstream, 0U);
+
+    ArrayList<uint64_t> b(pool);
+    for (uint64_t i = 0; i < 100000; ++i)
+        b.add(i * 2);
+    EXPECT_EQ(pool.upstreamAllocations(), upstream);
+    for (uint64_t i = 0; i < 100000; ++i)
+        ASSERT_EQ(b[i], i * 2);
+
+    ArrayList<std::string> c(pool);
+    for (uint32_t i = 0; i < 1000; ++i)
+        c.add(std::to_string(i));
+    EXPECT_EQ(c.remove(10), "10");
+    EXPECT_EQ(c[10], "11");
+}
+
+// Assignment keeps the target's resource, whatever the source allocates from
+TEST_F(PoolResourceTest, AssignmentKeepsResource)
+{
+    PoolResource pool;
+    ArrayList<std::string> source;
+    for (uint32_t i = 0; i < 100; ++i)
+        source.add(std::to_string(i));
+
+    ArrayList<std::string> copied(pool);
+    copied = source;
+    EXPECT_EQ(copied.resource(), &pool);
+    EXPECT_EQ(source.resource(), nullptr);
+    EXPECT_EQ(copied.size(), 100U);
+    EXPECT_EQ(copied[99], "99");
+
+    ArrayList<std::string> moved(pool);
+    moved = std::move(source);
+    EXPECT_EQ(moved.resource(), &pool);
+    EXPECT_EQ(moved.size(), 100U);
+    EXPECT_EQ(moved[42], "42");
+    EXPECT_TRUE(source.isEmpty());
+    EXPECT_EQ(source.resource(), nullptr);
+
+    // Between lists of the same resource, moving hands the buffer over
+    const std::string* buffer = moved.data();
+    copied = std::move(moved);
+    EXPECT_EQ(copied.data(), buffer);
+    EXPECT_EQ(copied.resource(), &pool);
+    EXPECT_TRUE(moved.isEmpty());
+
+    source = copied;
+    EXPECT_EQ(source.resource(), nullptr);
+    EXPECT_EQ(source[7], "7");
+}
+
+// An IncrementalArrayList assigned to keeps its resource too, even from a migrating list
+TEST_F(PoolResourceTest, IncrementalAssignmentKeepsResource)
+{
+    PoolResource pool;
+    std::pmr::memory_resource* heap = std::pmr::new_delete_resource();
+    IncrementalArrayList<std::string> source(1);
+    for (uint32_t i = 0; i < 100; ++i)
+        source.add(std::to_string(i));
+    ASSERT_TRUE(source.isMigrating());
+
+    IncrementalArrayList<std::string> copied(pool);
+    copied = source;
+    EXPECT_EQ(copied.resource(), &pool);
+    EXPECT_EQ(source.resource(), heap);
+    EXPECT_EQ(copied.size(), 100U);
+    EXPECT_EQ(copied[99], "99");
+    EXPECT_FALSE(copied.isMigrating());
+
+    IncrementalArrayList<std::string> moved(pool);
+    moved = std::move(source);
+    EXPECT_EQ(moved.resource(), &pool);
+    EXPECT_EQ(moved.size(), 100U);
+    EXPECT_EQ(moved[42], "42");
+    EXPECT_TRUE(source.isEmpty());
+    EXPECT_EQ(source.resource(), heap);
+
+    // Between lists of the same resource, moving hands the buffers over
+    const std::string* element = &moved[0];
+    copied = std::move(moved);
+    EXPECT_EQ(&copied[0], element);
+    EXPECT_EQ(copied.resource(), &pool);
+    EXPECT_TRUE(moved.isEmpty());
+
+    source = copied;
+    EXPECT_EQ(source.resource(), heap);
+    EXPECT_EQ(source[7], "7");
+}
+
+// Blocks beyond the thread cache go to the shared pool, and beyond its cap back to the system
+TEST_F(PoolResourceTest, Caps)
+{
+    PoolOptions options;
+    options.threadCacheBytes = 0;
+    options.maxRetainedBytes = 4096;
+    PoolResource pool(options);
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < 8; ++i)
+        blocks.push_back(pool.allocate(1024, 8));
+    for (void* block : blocks)
+        pool.deallocate(block, 1024, 8);
+    EXPECT_EQ(pool.retainedBytes(), 4096U);
+
+    void* reused = pool.allocate(1000, 8);
+    EXPECT_EQ(pool.retainedBytes(), 3072U);
+    EXPECT_EQ(pool.upstreamAllocations(), 8U);
+    pool.deallocate(reused, 1000, 8);
+
+    pool.release();
+    EXPECT_EQ(pool.retainedBytes(), 0U);
+
+    PoolOptions unpooled;
+    unpooled.largestPooledBlock = 256;
+    PoolResource large(unpooled);
+    void* big = large.allocate(1024, 8);
+    large.deallocate(big, 1024, 8);
+    EXPECT_EQ(large.retainedBytes(), 0U);
+}
+
+// Thread caches return to the shared pool, where other threads pick them up
+TEST_F(PoolResourceTest, Threads)
+{
+    PoolResource pool;
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&pool, t]() {
+            for (uint32_t round = 0; round < 20; ++round) {
+                ArrayList<uint32_t> list(pool);
+                for (uint32_t i = 0; i < 5000; ++i)
+                    list.add(i + t);
+                for (uint32_t i = 0; i < 5000; ++i)
+                    ASSERT_EQ(list[i], i + t);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    EXPECT_GT(pool.retainedBytes(), 0U);
+
+    uint64_t upstream = pool.upstreamAllocations();
+    {
+        ArrayList<uint32_t> list(pool);
+        for (uint32_t i = 0; i < 5000; ++i)
+            list.add(i);
+    }
+    EXPECT_EQ(pool.upstreamAllocations(), upstream);
+
+    void* block = nullptr;
+    std::thread([&pool, &block]() {block = pool.allocate(300, 8);}).join();
+    pool.deallocate(block, 300, 8);
+    pool.flushThreadCache();
+    EXPECT_GT(pool.retainedBytes(), 0U);
+}
+} // Namespace
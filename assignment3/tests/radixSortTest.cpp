@@ -0,0 +1,94 @@
+// Author: Mac-Noble Brako-Kusi
+// File: radixSortTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the parallel LSD radix sort
+
+#include "RadixSort.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+struct Record {
+    int32_t key = 0;
+    uint32_t order = 0;
+};
+
+// The fixture for testing radixSort.
+class RadixSortTest : public ::testing::Test {
+protected:
+    template<typename T> static ArrayList<T> randomList(uint32_t size, T low, T high) {
+        std::mt19937_64 random(size);
+        std::uniform_int_distribution<T> distribution(low, high);
+        ArrayList<T> list;
+        for (uint32_t i = 0; i < size; ++i)
+            list.add(distribution(random));
+        return list;
+    }
+
+    template<typename T> static void expectSortedLike(ArrayList<T>& list, uint32_t threads) {
+        std::vector<T> expected(list.data(), list.data() + list.size());
+        std::sort(expected.begin(), expected.end());
+        radixSort(list, threads);
+        ASSERT_EQ(list.size(), expected.size());
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), list.data()));
+    }
+};
+
+// Unsigned keys of both widths, below and above the thresholds, on one and several threads
+TEST_F(RadixSortTest, UnsignedKeys)
+{
+    for (uint32_t size : {0U, 1U, 100U, kRadixSortThreshold + 1, kRadixSortParallelThreshold * 2}) {
+        for (uint32_t threads : {1U, 4U}) {
+            ArrayList<uint32_t> narrow = randomList<uint32_t>(size, 0, UINT32_MAX);
+            expectSortedLike(narrow, threads);
+            ArrayList<uint64_t> wide = randomList<uint64_t>(size, 0, UINT64_MAX);
+            expectSortedLike(wide, threads);
+        }
+    }
+
+    // Small keys in a wide type skip the passes for their constant high bytes
+    ArrayList<uint64_t> small = randomList<uint64_t>(100000, 0, 1000);
+    expectSortedLike(small, 0);
+}
+
+// Negative keys sort before positive ones
+TEST_F(RadixSortTest, SignedKeys)
+{
+    ArrayList<int64_t> wide = randomList<int64_t>(50000, INT64_MIN, INT64_MAX);
+    expectSortedLike(wide, 2);
+    ArrayList<int16_t> narrow = randomList<int16_t>(50000, INT16_MIN, INT16_MAX);
+    expectSortedLike(narrow, 2);
+}
+
+// Records are ordered by the extracted key, and equal keys keep their order
+TEST_F(RadixSortTest, KeyExtractorIsStable)
+{
+    for (uint32_t size : {500U, 300000U}) {
+        ArrayList<int32_t> keys = randomList<int32_t>(size, -50, 50);
+        ArrayList<Record> records;
+        for (uint32_t i = 0; i < size; ++i)
+            records.add(Record{keys[i], i});
+
+        radixSort(records, [](const Record& record) {return record.key;}, 4);
+        for (uint32_t i = 1; i < size; ++i) {
+            ASSERT_LE(records[i - 1].key, records[i].key);
+            if (records[i - 1].key == records[i].key) {
+                ASSERT_LT(records[i - 1].order, records[i].order);
+            }
+        }
+    }
+}
+
+// A list whose keys are all equal needs no pass and is left as it was
+TEST_F(RadixSortTest, EqualKeys)
+{
+    ArrayList<Record> records;
+    for (uint32_t i = 0; i < 100000; ++i)
+        records.add(Record{7, i});
+    radixSort(records, [](const Record& record) {return record.key;});
+    for (uint32_t i = 0; i < records.size(); ++i)
+        ASSERT_EQ(records[i].order, i);
+}
+} // Namespace
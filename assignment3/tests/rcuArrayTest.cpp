@@ -0,0 +1,111 @@
+// Author: Mac-Noble Brako-Kusi
+// File: rcuArrayTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the RcuArrayList template class
+
+#include "RcuArrayList.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+// The fixture for testing RcuArrayList.
+class RcuArrayListTest : public ::testing::Test {
+};
+
+// Writes behave like ArrayList's, and each one publishes a new version
+TEST_F(RcuArrayListTest, Writes)
+{
+    RcuArrayList<std::string> a;
+    EXPECT_EQ(a.size(), 0U);
+    a.add("b");
+    a.add(0, "a");
+    a.add(3, "d");
+    EXPECT_EQ(a.size(), 4U);
+    EXPECT_EQ(a.get(0), "a");
+    EXPECT_EQ(a.get(2), "");
+    a.set(2, "c");
+    EXPECT_EQ(a.remove(3), "d");
+    EXPECT_THROW(a.get(3), std::out_of_range);
+    EXPECT_THROW(a.set(3, "x"), std::out_of_range);
+    EXPECT_THROW(a.remove(3), std::out_of_range);
+
+    a.update([](ArrayList<std::string>& list) {
+        list.add("d");
+        list.add("e");
+    });
+    RcuArrayList<std::string>::Snapshot snapshot = a.snapshot();
+    std::string joined;
+    for (const std::string& value : snapshot)
+        joined += value;
+    EXPECT_EQ(joined, "abcde");
+
+    a.clear();
+    EXPECT_EQ(a.size(), 0U);
+}
+
+// A snapshot keeps seeing its version, which is freed only after the snapshot ends
+TEST_F(RcuArrayListTest, SnapshotIsolationAndReclamation)
+{
+    RcuArrayList<int> a;
+    a.add(1);
+    a.reclaim();
+    EXPECT_EQ(a.retiredVersions(), 0U);
+    {
+        RcuArrayList<int>::Snapshot before = a.snapshot();
+        a.set(0, 2);
+        a.add(3);
+        EXPECT_EQ(before.size(), 1U);
+        EXPECT_EQ(before[0], 1);
+        EXPECT_THROW(before.get(1), std::out_of_range);
+        EXPECT_EQ(a.get(0), 2);
+        EXPECT_EQ(a.retiredVersions(), 2U);
+
+        // Nested snapshots share the thread's epoch
+        RcuArrayList<int>::Snapshot after = a.snapshot();
+        EXPECT_EQ(after.size(), 2U);
+    }
+    a.reclaim();
+    EXPECT_EQ(a.retiredVersions(), 0U);
+}
+
+// Readers racing a writer always see a whole version
+TEST_F(RcuArrayListTest, ConcurrentReaders)
+{
+    const uint32_t kSize = 64;
+    RcuArrayList<uint32_t> a;
+    a.update([](ArrayList<uint32_t>& list) {
+        for (uint32_t i = 0; i < kSize; ++i)
+            list.add(0);
+    });
+
+    std::atomic<bool> done(false);
+    std::atomic<uint32_t> torn(0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&]() {
+            while (!done.load()) {
+                RcuArrayList<uint32_t>::Snapshot snapshot = a.snapshot();
+                for (uint32_t i = 1; i < snapshot.size(); ++i)
+                    torn += snapshot[i] != snapshot[0];
+            }
+        });
+    }
+    for (uint32_t version = 1; version <= 2000; ++version) {
+        a.update([version](ArrayList<uint32_t>& list) {
+            for (uint32_t i = 0; i < list.size(); ++i)
+                list[i] = version;
+        });
+    }
+    done = true;
+    for (std::thread& reader : readers)
+        reader.join();
+
+    EXPECT_EQ(torn.load(), 0U);
+    EXPECT_EQ(a.get(kSize - 1), 2000U);
+    a.reclaim();
+    EXPECT_EQ(a.retiredVersions(), 0U);
+}
+} // Namespace
@@ -0,0 +1,127 @@
+// Author: Mac-Noble Brako-Kusi
+// File: soaArrayTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the SoAArrayList template class
+
+#include "SoAArrayList.h"
+#include <gtest/gtest.h>
+#include <string>
+
+namespace {
+// The fixture for testing SoAArrayList.
+class SoAArrayListTest : public ::testing::Test {
+};
+
+// Rows stay aligned across columns while the list grows
+TEST_F(SoAArrayListTest, AddAndGet)
+{
+    SoAArrayList<uint32_t, double, std::string> a;
+    EXPECT_TRUE(a.isEmpty());
+    for (uint32_t i = 0; i < 1000; ++i)
+        a.add(i, i * 0.5, std::to_string(i));
+
+    EXPECT_EQ(a.size(), 1000U);
+    EXPECT_EQ(a.capacity(), 1024U);
+    for (uint32_t i = 0; i < 1000; ++i) {
+        auto [id, half, name] = a[i];
+        EXPECT_EQ(id, i);
+        EXPECT_EQ(half, i * 0.5);
+        EXPECT_EQ(name, std::to_string(i));
+    }
+
+    std::get<2>(a.get(7)) = "seven";
+    EXPECT_EQ(std::get<2>(a[7]), "seven");
+    EXPECT_THROW(a.get(1000), std::out_of_range);
+}
+
+// Inserting and removing rows shifts every column together
+TEST_F(SoAArrayListTest, InsertAndRemove)
+{
+    SoAArrayList<int, std::string> a;
+    a.add(1, "one");
+    a.add(3, "three");
+    a.add(1, 2, "two");
+    EXPECT_EQ(a.size(), 3U);
+    EXPECT_EQ(std::get<0>(a[1]), 2);
+    EXPECT_EQ(std::get<1>(a[2]), "three");
+
+    a.add(5, 6, "six");
+    EXPECT_EQ(a.size(), 6U);
+    EXPECT_EQ(std::get<0>(a[4]), 0);
+    EXPECT_EQ(std::get<1>(a[4]), "");
+    EXPECT_EQ(std::get<1>(a[5]), "six");
+
+    SoAArrayList<int, std::string>::Value removed = a.remove(0);
+    EXPECT_EQ(std::get<0>(removed), 1);
+    EXPECT_EQ(std::get<1>(removed), "one");
+    EXPECT_EQ(a.size(), 5U);
+    EXPECT_EQ(std::get<1>(a[0]), "two");
+    EXPECT_EQ(std::get<1>(a[4]), "six");
+
+    a.set(0, 20, "twenty");
+    EXPECT_EQ(std::get<0>(a.get(0)), 20);
+    EXPECT_THROW(a.remove(5), std::out_of_range);
+    EXPECT_THROW(a.set(5, 0, ""), std::out_of_range);
+}
+
+// An index that would take the list past UINT32_MAX rows is refused, leaving it unchanged
+TEST_F(SoAArrayListTest, AddPastMaximumSize)
+{
+    SoAArrayList<int, std::string> a;
+    a.add(7, "seven");
+    EXPECT_THROW(a.add(UINT32_MAX, 1, "one"), std::length_error);
+    EXPECT_EQ(a.size(), 1U);
+    EXPECT_EQ(a.capacity(), 1U);
+    EXPECT_EQ(std::get<1>(a[0]), "seven");
+}
+
+// Columns are exposed as contiguous spans for field-selective scans
+TEST_F(SoAArrayListTest, ColumnScan)
+{
+    SoAArrayList<uint64_t, float> a;
+    for (uint64_t i = 0; i < 100; ++i)
+        a.add(i, 1.0f);
+
+    uint64_t sum = 0;
+    for (uint64_t id : a.column<0>())
+        sum += id;
+    EXPECT_EQ(sum, 4950U);
+
+    ColumnSpan<float> weights = a.column<1>();
+    EXPECT_EQ(weights.size(), 100U);
+    for (float& weight : weights)
+        weight *= 2;
+    EXPECT_EQ(std::get<1>(a[50]), 2.0f);
+
+    const SoAArrayList<uint64_t, float>& constList = a;
+    EXPECT_EQ(constList.column<0>()[99], 99U);
+}
+
+// Rule of 5 methods
+TEST_F(SoAArrayListTest, CopyAndMove)
+{
+    SoAArrayList<int, std::string> a;
+    for (int i = 0; i < 20; ++i)
+        a.add(i, std::to_string(i));
+
+    SoAArrayList<int, std::string> b(a);
+    std::get<1>(b[0]) = "changed";
+    EXPECT_EQ(std::get<1>(a[0]), "0");
+
+    SoAArrayList<int, std::string> c(std::move(b));
+    EXPECT_TRUE(b.isEmpty());
+    EXPECT_EQ(c.size(), 20U);
+    EXPECT_EQ(std::get<1>(c[0]), "changed");
+
+    b = c;
+    a = std::move(c);
+    EXPECT_TRUE(c.isEmpty());
+    EXPECT_EQ(std::get<1>(a[0]), "changed");
+    EXPECT_EQ(std::get<0>(b[19]), 19);
+
+    a.clear();
+    EXPECT_TRUE(a.isEmpty());
+    EXPECT_EQ(a.capacity(), 0U);
+}
+
+} // Namespace
@@ -0,0 +1,149 @@
+// Author: Mac-Noble Brako-Kusi
+// File: sparseArrayTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the SparseArrayList template class
+
+#include "SparseArrayList.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+// The fixture for testing SparseArrayList.
+class SparseArrayTest : public ::testing::Test {
+protected:
+    // The populated indexes and elements, in the order forEach() visits them
+    template<typename T>
+    static std::vector<std::pair<uint32_t, T>> entries(const SparseArrayList<T>& list) {
+        std::vector<std::pair<uint32_t, T>> visited;
+        list.forEach([&visited](uint32_t index, const T& value) {
+            visited.emplace_back(index, value);
+        });
+        return visited;
+    }
+};
+
+// Writing far past the end allocates one page, not every element before it
+TEST_F(SparseArrayTest, WritesFarIndexes)
+{
+    SparseArrayList<uint64_t> list;
+    list.add(1000000000, 42);
+    EXPECT_EQ(list.size(), 1000000001U);
+    EXPECT_EQ(list.populated(), 1U);
+    EXPECT_LT(list.memoryFootprint(), 64U * 1024);
+    EXPECT_EQ(list.get(1000000000), 42U);
+    EXPECT_EQ(list.get(999999999), 0U);
+    EXPECT_EQ(list[5], 0U);
+    EXPECT_FALSE(list.contains(5));
+    EXPECT_TRUE(list.contains(1000000000));
+    EXPECT_THROW(list.get(1000000001), std::out_of_range);
+
+    list.add(7);
+    list.set(3, 9);
+    EXPECT_EQ(list.size(), 1000000002U);
+    EXPECT_EQ(list.get(1000000001), 7U);
+    std::vector<std::pair<uint32_t, uint64_t>> expected = {{3, 9}, {1000000000, 42},
+                                                           {1000000001, 7}};
+    EXPECT_EQ(entries(list), expected);
+    EXPECT_THROW(list.set(1000000002, 1), std::out_of_range);
+    EXPECT_THROW(list.add(UINT32_MAX, 1), std::length_error);
+}
+
+// Inserting and removing before the end shift only the populated indexes after it
+TEST_F(SparseArrayTest, ShiftsPopulatedIndexes)
+{
+    SparseArrayList<std::string> list;
+    list.add(10, "ten");
+    list.add(5000, "five thousand");
+    list.add(3000000, "three million");
+
+    list.add(7, "seven");
+    std::vector<std::pair<uint32_t, std::string>> expected = {
+        {7, "seven"}, {11, "ten"}, {5001, "five thousand"}, {3000001, "three million"}};
+    EXPECT_EQ(entries(list), expected);
+    EXPECT_EQ(list.size(), 3000002U);
+
+    EXPECT_EQ(list.remove(7), "seven");
+    EXPECT_EQ(list.remove(0), "");
+    expected = {{9, "ten"}, {4999, "five thousand"}, {2999999, "three million"}};
+    EXPECT_EQ(entries(list), expected);
+    EXPECT_EQ(list.size(), 3000000U);
+    EXPECT_EQ(list.populated(), 3U);
+
+    list.add(0, list[9]);
+    EXPECT_EQ(list.get(0), "ten");
+    EXPECT_EQ(list.get(10), "ten");
+}
+
+// reset() unpopulates an index and frees its page once the page empties
+TEST_F(SparseArrayTest, ResetsAndFreesPages)
+{
+    SparseArrayList<uint32_t> list;
+    list.add(0, 0);
+    size_t onePage = list.memoryFootprint();
+    for (uint32_t i = 1; i < 10; ++i)
+        list.add(i * 100000, i);
+    EXPECT_GT(list.memoryFootprint(), onePage);
+
+    for (uint32_t i = 1; i < 10; ++i)
+        list.reset(i * 100000);
+    EXPECT_EQ(list.populated(), 1U);
+    EXPECT_EQ(list.size(), 900001U);
+    EXPECT_EQ(list.get(500000), 0U);
+    EXPECT_LE(list.memoryFootprint(), onePage + 8 * sizeof(void*));
+    EXPECT_THROW(list.reset(900001), std::out_of_range);
+}
+
+// Dense lists convert both ways, with T() at unpopulated indexes
+TEST_F(SparseArrayTest, ConvertsToDense)
+{
+    ArrayList<int> dense;
+    for (int i = 0; i < 3000; ++i)
+        dense.add(i * 3);
+    SparseArrayList<int> list(dense);
+    EXPECT_EQ(list.size(), 3000U);
+    EXPECT_DOUBLE_EQ(list.density(), 1.0);
+
+    list.reset(1500);
+    list.add(5000, 1);
+    ArrayList<int> back = list.toArrayList();
+    ASSERT_EQ(back.size(), 5001U);
+    EXPECT_EQ(back[2999], 2999 * 3);
+    EXPECT_EQ(back[1500], 0);
+    EXPECT_EQ(back[4000], 0);
+    EXPECT_EQ(back[5000], 1);
+    EXPECT_NEAR(list.density(), 3000.0 / 5001, 1e-9);
+}
+
+// Copies are deep; a move leaves the source empty and usable
+TEST_F(SparseArrayTest, CopiesAndMoves)
+{
+    SparseArrayList<std::string> list;
+    list.add(70000, "a");
+    list.add(2000000, "b");
+
+    SparseArrayList<std::string> copy(list);
+    copy.set(70000, "changed");
+    EXPECT_EQ(list.get(70000), "a");
+    EXPECT_EQ(copy.get(70000), "changed");
+    EXPECT_EQ(copy.get(2000000), "b");
+
+    SparseArrayList<std::string> assigned;
+    assigned = copy;
+    EXPECT_EQ(assigned.get(70000), "changed");
+
+    SparseArrayList<std::string> moved(std::move(list));
+    EXPECT_EQ(moved.get(2000000), "b");
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.populated(), 0U);
+    list.add("again");
+    EXPECT_EQ(list.get(0), "again");
+
+    list = std::move(moved);
+    EXPECT_EQ(list.populated(), 2U);
+    list.clear();
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.memoryFootprint(), 0U);
+}
+} // Namespace
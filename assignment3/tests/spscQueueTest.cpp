@@ -0,0 +1,83 @@
+// Author: Mac-Noble Brako-Kusi
+// File: spscQueueTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the SpscQueue template class
+
+#include "SpscQueue.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+
+namespace {
+// The fixture for testing SpscQueue.
+class SpscQueueTest : public ::testing::Test {
+};
+
+// Elements come out in order, and pushes fail only when the ring is full
+TEST_F(SpscQueueTest, FifoAndBounds)
+{
+    EXPECT_THROW(SpscQueue<int>(0), std::invalid_argument);
+    SpscQueue<std::string> q(3);
+    EXPECT_EQ(q.capacity(), 4U);
+    EXPECT_TRUE(q.isEmpty());
+
+    std::string out;
+    EXPECT_FALSE(q.tryPop(out));
+    for (int lap = 0; lap < 3; ++lap) {
+        for (int i = 0; i < 4; ++i)
+            EXPECT_TRUE(q.tryPush(std::to_string(lap * 4 + i)));
+        EXPECT_FALSE(q.tryPush("full"));
+        EXPECT_EQ(q.size(), 4U);
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(q.tryPop(out));
+            EXPECT_EQ(out, std::to_string(lap * 4 + i));
+        }
+        EXPECT_FALSE(q.tryPop(out));
+    }
+}
+
+// Batches take what fits and what is there
+TEST_F(SpscQueueTest, Batches)
+{
+    SpscQueue<int> q(8);
+    int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(q.tryPushBatch(values, 5), 5U);
+    EXPECT_EQ(q.tryPushBatch(values + 5, 5), 3U);
+    int out[10] = {};
+    EXPECT_EQ(q.tryPopBatch(out, 6), 6U);
+    EXPECT_EQ(q.tryPopBatch(out + 6, 6), 2U);
+    for (int i = 0; i < 8; ++i)
+        EXPECT_EQ(out[i], i);
+    EXPECT_EQ(q.tryPopBatch(out, 6), 0U);
+}
+
+// A producer and a consumer thread pass a long sequence through a small ring intact
+TEST_F(SpscQueueTest, Threads)
+{
+    const uint64_t kMessages = 1000000;
+    SpscQueue<uint64_t> q(64);
+    std::thread producer([&q]() {
+        for (uint64_t i = 0; i < kMessages; ) {
+            if (q.tryPush(i))
+                ++i;
+            else
+                std::this_thread::yield();
+        }
+    });
+
+    uint64_t expected = 0;
+    uint64_t buffer[16];
+    while (expected < kMessages) {
+        uint32_t popped = q.tryPopBatch(buffer, 16);
+        if (popped == 0)
+            std::this_thread::yield();
+        for (uint32_t i = 0; i < popped; ++i) {
+            if (buffer[i] != expected)
+                FAIL() << "got " << buffer[i] << " instead of " << expected;
+            ++expected;
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(q.isEmpty());
+}
+} // Namespace
@@ -0,0 +1,139 @@
+// Author: Mac-Noble Brako-Kusi
+// File: staticArrayTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the StaticArrayList template class
+
+#include "StaticArrayList.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+
+namespace {
+constexpr StaticArrayList<uint32_t, 16> squares() {
+    StaticArrayList<uint32_t, 16> table;
+    for (uint32_t i = 0; i < 16; ++i)
+        table.add(i * i);
+    return table;
+}
+
+constexpr StaticArrayList<int, 8> edited() {
+    StaticArrayList<int, 8> list(3, 1);
+    list.add(1, 5);
+    list.add(6, 9);
+    list.set(0, 2);
+    list.remove(2);
+    list.tryAdd(10);
+    return list;
+}
+
+// Built at compile time and placed in read-only memory
+constexpr StaticArrayList<uint32_t, 16> kSquares = squares();
+static_assert(kSquares.size() == 16, "table is full");
+static_assert(kSquares[5] == 25 && kSquares.get(15) == 225, "table holds the squares");
+static_assert(std::is_trivially_copyable<StaticArrayList<uint32_t, 16>>::value,
+              "trivially copyable for trivial elements");
+
+constexpr StaticArrayList<int, 8> kEdited = edited();
+static_assert(kEdited.size() == 7 && kEdited[0] == 2 && kEdited[1] == 5 && kEdited[2] == 1 &&
+              kEdited[3] == 0 && kEdited[5] == 9 && kEdited[6] == 10, "edits apply in order");
+
+// The fixture for testing StaticArrayList.
+class StaticArrayListTest : public ::testing::Test {
+};
+
+// The compile-time table is usable at run time like any list
+TEST_F(StaticArrayListTest, ConstexprTable)
+{
+    EXPECT_EQ(std::accumulate(kSquares.begin(), kSquares.end(), 0U), 1240U);
+    EXPECT_EQ(kSquares.capacity(), 16U);
+    EXPECT_TRUE(kSquares.isFull());
+    EXPECT_EQ(sizeof(kSquares), 16 * sizeof(uint32_t) + sizeof(uint32_t));
+}
+
+// Overflow is reported and leaves the list unchanged
+TEST_F(StaticArrayListTest, Overflow)
+{
+    StaticArrayList<std::string, 4> a;
+    for (int i = 0; i < 4; ++i)
+        EXPECT_EQ(a.add(std::to_string(i)), 4U);
+    EXPECT_THROW(a.add("4"), std::length_error);
+    EXPECT_THROW(a.add(0, "x"), std::length_error);
+    EXPECT_FALSE(a.tryAdd("4"));
+    EXPECT_EQ(a.size(), 4U);
+    EXPECT_EQ(a[0], "0");
+    EXPECT_EQ(a[3], "3");
+
+    StaticArrayList<int, 4> b;
+    EXPECT_THROW(b.add(4, 1), std::length_error);
+    EXPECT_THROW((StaticArrayList<int, 4>(5)), std::length_error);
+    EXPECT_TRUE(b.isEmpty());
+}
+
+// Access, removal and swapping mirror ArrayList
+TEST_F(StaticArrayListTest, ArrayListInterface)
+{
+    StaticArrayList<std::string, 8> a;
+    a.add("b");
+    a.add("c");
+    a.add(0, a[1]);
+    EXPECT_EQ(a[0], "c");
+    EXPECT_THROW(a.get(3), std::out_of_range);
+    EXPECT_EQ(a.tryGet(3), nullptr);
+    EXPECT_EQ(*a.tryGet(1), "b");
+    EXPECT_FALSE(a.trySet(3, "x"));
+    EXPECT_EQ(a.remove(0), "c");
+    EXPECT_FALSE(a.tryRemove(2));
+    EXPECT_EQ(a.size(), 2U);
+
+    StaticArrayList<std::string, 8> b(5, "z");
+    a.swap(b);
+    EXPECT_EQ(a.size(), 5U);
+    EXPECT_EQ(b.size(), 2U);
+    EXPECT_EQ(b[1], "c");
+    for (const std::string& value : a)
+        EXPECT_EQ(value, "z");
+
+    StaticArrayList<std::string, 8> copy(a);
+    a.clear();
+    EXPECT_TRUE(a.isEmpty());
+    EXPECT_EQ(copy.size(), 5U);
+}
+
+// Holds a shared_ptr and, having no move operations, copies when moved, so the slot an element
+// is moved out of keeps sharing ownership
+struct Held {
+    Held() = default;
+    explicit Held(std::shared_ptr<int> owned) : mOwned(std::move(owned)) {}
+    Held(const Held&) = default;
+    Held& operator=(const Held&) = default;
+
+    std::shared_ptr<int> mOwned;
+};
+
+// Removing or clearing releases what the elements own instead of leaving it in vacated slots
+TEST_F(StaticArrayListTest, ReleasesVacatedSlots)
+{
+    std::shared_ptr<int> first = std::make_shared<int>(1);
+    std::shared_ptr<int> second = std::make_shared<int>(2);
+    StaticArrayList<Held, 4> a;
+    a.add(Held(first));
+    a.add(Held(second));
+    EXPECT_EQ(second.use_count(), 2);
+
+    a.remove(0);
+    EXPECT_EQ(first.use_count(), 1);
+    EXPECT_EQ(second.use_count(), 2);
+    EXPECT_EQ(a[0].mOwned, second);
+
+    a.add(Held(first));
+    EXPECT_TRUE(a.tryRemove(0));
+    EXPECT_EQ(second.use_count(), 1);
+    EXPECT_EQ(first.use_count(), 2);
+
+    a.clear();
+    EXPECT_EQ(first.use_count(), 1);
+    EXPECT_TRUE(a.isEmpty());
+}
+} // Namespace
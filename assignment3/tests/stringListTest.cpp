@@ -0,0 +1,164 @@
+// Author: Mac-Noble Brako-Kusi
+// File: stringListTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the StringList class
+
+#include "StringList.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+// The fixture for testing StringList.
+class StringListTest : public ::testing::Test {
+protected:
+    // Strings of varied lengths, including empty ones
+    static std::vector<std::string> words(uint32_t count) {
+        std::vector<std::string> values;
+        for (uint32_t i = 0; i < count; ++i)
+            values.push_back(std::string(i % 13, static_cast<char>('a' + i % 26)) +
+                             std::to_string(i * (i % 3)));
+        values[0].clear();
+        return values;
+    }
+
+    // Checks every way of reading the list against the expected strings
+    static void expectContents(const StringList& list, const std::vector<std::string>& values) {
+        ASSERT_EQ(list.size(), values.size());
+        uint64_t bytes = 0;
+        for (uint32_t i = 0; i < values.size(); ++i) {
+            bytes += values[i].size();
+            if (list.get(i) != values[i]) {
+                ADD_FAILURE() << "get(" << i << ") is " << list.get(i) << ", not " << values[i];
+                break;
+            }
+        }
+        EXPECT_EQ(list.byteSize(), bytes);
+        ArrayList<std::string> array = list.toArrayList();
+        ASSERT_EQ(array.size(), values.size());
+        EXPECT_TRUE(std::equal(values.begin(), values.end(), array.data()));
+    }
+};
+
+// Strings added one at a time or in bulk read back unchanged
+TEST_F(StringListTest, AddsAndReads)
+{
+    std::vector<std::string> values = words(5000);
+    StringList list;
+    EXPECT_TRUE(list.isEmpty());
+    for (const std::string& value : values)
+        list.add(value);
+    expectContents(list, values);
+
+    ArrayList<std::string> source;
+    for (const std::string& value : values)
+        source.add(value);
+    StringList bulk(source);
+    expectContents(bulk, values);
+    EXPECT_THROW(bulk.get(5000), std::out_of_range);
+}
+
+// Bulk appends of another list grow the arena once and keep both lists intact
+TEST_F(StringListTest, AppendsLists)
+{
+    std::vector<std::string> values = words(300);
+    StringList first;
+    StringList second;
+    for (uint32_t i = 0; i < values.size(); ++i)
+        (i < 100 ? first : second).add(values[i]);
+    second.remove(0);
+    values.erase(values.begin() + 100);
+
+    first.reserve(first.byteSize() + second.byteSize());
+    const char* arena = first[1].data();
+    first.addAll(second);
+    expectContents(first, values);
+    EXPECT_EQ(first[1].data(), arena);
+
+    first.addAll(first);
+    std::vector<std::string> twice(values);
+    values.insert(values.end(), twice.begin(), twice.end());
+    expectContents(first, values);
+}
+
+// Removals and shorter replacements leave dead bytes until compact() drops them
+TEST_F(StringListTest, CompactsDeadBytes)
+{
+    std::vector<std::string> values = words(1000);
+    StringList list;
+    for (const std::string& value : values)
+        list.add(value);
+
+    for (uint32_t i = 900; i > 0; i -= 3) {
+        list.remove(i);
+        values.erase(values.begin() + i);
+    }
+    list.set(1, "x");
+    values[1] = "x";
+    list.set(2, std::string(100, 'y'));
+    values[2] = std::string(100, 'y');
+    EXPECT_GT(list.deadBytes(), 0U);
+    expectContents(list, values);
+
+    size_t before = list.memoryFootprint();
+    list.compact();
+    EXPECT_EQ(list.deadBytes(), 0U);
+    EXPECT_LT(list.memoryFootprint(), before);
+    expectContents(list, values);
+    EXPECT_THROW(list.remove(list.size()), std::out_of_range);
+}
+
+// Growing into a longer empty slot moves the string out of element order
+TEST_F(StringListTest, SetsLongerStrings)
+{
+    StringList list;
+    list.add("");
+    list.add("b");
+    list.set(0, "aa");
+    EXPECT_EQ(list.deadBytes(), 0U);
+
+    StringList other;
+    other.addAll(list);
+    expectContents(other, {"aa", "b"});
+
+    // Adding an element of the list itself copies it before the arena can move
+    for (uint32_t i = 0; i < 100; ++i)
+        list.add(list[i % 2]);
+    EXPECT_EQ(list[101], "b");
+    list.set(3, list[0]);
+    EXPECT_EQ(list[3], "aa");
+}
+
+// Copies are compacted and independent; a move leaves the source empty and usable
+TEST_F(StringListTest, CopiesAndMoves)
+{
+    std::vector<std::string> values = words(200);
+    StringList list;
+    for (const std::string& value : values)
+        list.add(value);
+    list.remove(5);
+    values.erase(values.begin() + 5);
+
+    StringList copy(list);
+    EXPECT_EQ(copy.deadBytes(), 0U);
+    copy.set(0, "changed");
+    expectContents(list, values);
+    EXPECT_EQ(copy.get(0), "changed");
+
+    StringList assigned;
+    assigned = copy;
+    EXPECT_EQ(assigned.get(0), "changed");
+
+    StringList moved(std::move(list));
+    expectContents(moved, values);
+    EXPECT_TRUE(list.isEmpty());
+    list.add("again");
+    expectContents(list, {"again"});
+
+    list = std::move(moved);
+    expectContents(list, values);
+    list.clear();
+    EXPECT_EQ(list.memoryFootprint(), 0U);
+}
+} // Namespace
@@ -0,0 +1,91 @@
+// Author: Mac-Noble Brako-Kusi
+// File: taskTest.cpp
+// Date: October 19, 2026
+// Purpose: Tests for the Task coroutine type and ThreadPool, built as C++20
+
+#include "Task.h"
+#include "ThreadPool.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+// The fixture for testing Task and ThreadPool.
+class TaskTest : public ::testing::Test {
+};
+
+Task<int> constant(int value, bool& ran) {
+    ran = true;
+    co_return value;
+}
+
+// A task is lazy, runs inline when nothing moves it elsewhere, and syncWait returns its result
+TEST_F(TaskTest, LazyAndInline)
+{
+    bool ran = false;
+    Task<int> task = constant(7, ran);
+    EXPECT_FALSE(ran);
+    task.start();
+    EXPECT_TRUE(ran);
+    EXPECT_TRUE(task.isReady());
+    EXPECT_EQ(syncWait(std::move(task)), 7);
+}
+
+Task<std::thread::id> where(ThreadPool& pool) {
+    co_await pool.schedule();
+    co_return std::this_thread::get_id();
+}
+
+Task<std::string> squares(ThreadPool& pool, int count) {
+    std::vector<Task<int>> started;
+    for (int i = 0; i < count; ++i) {
+        started.push_back([](ThreadPool& pool, int x) -> Task<int> {
+            co_await pool.schedule();
+            co_return x * x;
+        }(pool, i));
+        started.back().start();
+    }
+    std::string result;
+    for (Task<int>& task : started)
+        result += std::to_string(co_await task) + " ";
+    co_return result;
+}
+
+// Scheduling moves a task onto the pool; started tasks run concurrently and are awaited in order
+TEST_F(TaskTest, RunsOnPool)
+{
+    ThreadPool pool(3, 16);
+    EXPECT_EQ(pool.size(), 3U);
+    EXPECT_NE(syncWait(where(pool)), std::this_thread::get_id());
+    EXPECT_EQ(syncWait(squares(pool, 6)), "0 1 4 9 16 25 ");
+}
+
+Task<int> failing(ThreadPool& pool) {
+    co_await pool.schedule();
+    throw std::invalid_argument("bad record");
+    co_return 0;
+}
+
+Task<int> survivesFailure(ThreadPool& pool, std::atomic<int>& caught) {
+    Task<int> task = failing(pool);
+    try {
+        co_await task;
+    } catch (const std::invalid_argument&) {
+        ++caught;
+    }
+    co_return caught.load();
+}
+
+// What a body throws reaches whoever awaits it, on any thread
+TEST_F(TaskTest, Exceptions)
+{
+    ThreadPool pool(2, 4);
+    EXPECT_THROW(syncWait(failing(pool)), std::invalid_argument);
+
+    std::atomic<int> caught(0);
+    EXPECT_EQ(syncWait(survivesFailure(pool, caught)), 1);
+}
+} // Namespace